@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/AnimatedSpritePool.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the animated sprite cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfAnimatedSprite **sprites;
+    size_t count;
+} sfAnimatedSpriteBench;
+
+////////////////////////////////////////////////////////////
+static void *sfAnimatedSpriteBench_setup(const size_t *params)
+{
+    sfAnimatedSpriteBench *bench = malloc(sizeof(sfAnimatedSpriteBench));
+    size_t grid = params[1];
+
+    bench->count = params[0];
+    bench->sprites = malloc(bench->count * sizeof(sfAnimatedSprite *));
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->sprites[i] = sfAnimatedSprite_create();
+        sfAnimatedSprite_setGridSize(bench->sprites[i], (sfVector2u){grid, grid});
+        sfAnimatedSprite_setFrameSize(bench->sprites[i], (sfVector2u){64, 64});
+        sfAnimatedSprite_setMaxFrame(bench->sprites[i], grid * grid);
+        sfAnimatedSprite_setFrameRate(bench->sprites[i], 1000);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_teardown(void *data)
+{
+    sfAnimatedSpriteBench *bench = data;
+
+    for (size_t i = 0; i < bench->count; i++)
+        sfAnimatedSprite_destroy(bench->sprites[i]);
+    free(bench->sprites);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_update(void *data, size_t iterations)
+{
+    sfAnimatedSpriteBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < bench->count; j++)
+            sfAnimatedSprite_update(bench->sprites[j]);
+    }
+    sfBench_sink = (float)bench->sprites[0]->currentFrame;
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_seek(void *data, size_t iterations)
+{
+    sfAnimatedSpriteBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < bench->count; j++)
+            sfAnimatedSprite_seek(bench->sprites[j], sfMicroseconds((sfInt64)(i + j) * 3600000000));
+    }
+    sfBench_sink = (float)bench->sprites[0]->currentFrame;
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_create(void *data, size_t iterations)
+{
+    (void)data;
+    for (size_t i = 0; i < iterations; i++)
+        sfAnimatedSprite_destroy(sfAnimatedSprite_create());
+}
+
+////////////////////////////////////////////////////////////
+static void *sfAnimatedSpriteBench_setupPool(const size_t *params)
+{
+    sfAnimatedSpritePool *pool = sfAnimatedSpritePool_create(params[0], NULL, (sfVector2u){64, 64}, (sfVector2u){params[1], params[1]}, 1000);
+
+    for (size_t i = 0; i < params[0]; i++)
+        sfAnimatedSpritePool_spawn(pool, (sfVector2f){(i % 100) * 10.f, (i / 100) * 10.f});
+    return (pool);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_teardownPool(void *data)
+{
+    sfAnimatedSpritePool_destroy(data);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_updatePool(void *data, size_t iterations)
+{
+    sfAnimatedSpritePool *pool = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfAnimatedSpritePool_advance(pool, (sfTime){1500});
+    sfBench_sink = (float)pool->instances[0].currentFrame;
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_drawPool(void *data, size_t iterations)
+{
+    sfAnimatedSpritePool *pool = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfRenderWindow_drawAnimatedSpritePool(NULL, pool, NULL);
+    sfBench_sink = pool->vertices[0].position.x;
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteBench_spawnPool(void *data, size_t iterations)
+{
+    sfAnimatedSpritePool *pool = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfAnimatedSpritePool_despawn(pool, sfAnimatedSpritePool_spawn(pool, (sfVector2f){0, 0}));
+    sfBench_sink = (float)pool->count;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerAnimatedSprite(void)
+{
+    const size_t sprites[] = {1, 100, 1000};
+    const size_t grids[] = {4, 16};
+
+    for (size_t i = 0; i < sizeof(sprites) / sizeof(*sprites); i++) {
+        for (size_t j = 0; j < sizeof(grids) / sizeof(*grids); j++) {
+            sfBench_register((sfBenchCase){"animatedSprite.update", {"sprites", "grid"}, {sprites[i], grids[j]}, sprites[i],
+                sfAnimatedSpriteBench_setup, sfAnimatedSpriteBench_update, sfAnimatedSpriteBench_teardown, NULL});
+            sfBench_register((sfBenchCase){"animatedSprite.seek", {"sprites", "grid"}, {sprites[i], grids[j]}, sprites[i],
+                sfAnimatedSpriteBench_setup, sfAnimatedSpriteBench_seek, sfAnimatedSpriteBench_teardown, NULL});
+            sfBench_register((sfBenchCase){"animatedSpritePool.update", {"sprites", "grid"}, {sprites[i], grids[j]}, sprites[i],
+                sfAnimatedSpriteBench_setupPool, sfAnimatedSpriteBench_updatePool, sfAnimatedSpriteBench_teardownPool, NULL});
+        }
+        sfBench_register((sfBenchCase){"animatedSpritePool.draw", {"sprites", "grid"}, {sprites[i], 4}, sprites[i],
+            sfAnimatedSpriteBench_setupPool, sfAnimatedSpriteBench_drawPool, sfAnimatedSpriteBench_teardownPool, NULL});
+    }
+    sfBench_register((sfBenchCase){"animatedSprite.createDestroy", {NULL}, {0}, 1, NULL, sfAnimatedSpriteBench_create, NULL, NULL});
+    sfBench_register((sfBenchCase){"animatedSpritePool.spawnDespawn", {"sprites", "grid"}, {1000, 4}, 1,
+        sfAnimatedSpriteBench_setupPool, sfAnimatedSpriteBench_spawnPool, sfAnimatedSpriteBench_teardownPool, NULL});
+}
@@ -0,0 +1,330 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <SFML/System/Clock.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+#define SF_BENCH_MAX_CASES 256
+#define SF_BENCH_REPETITIONS 5
+
+////////////////////////////////////////////////////////////
+/// Result of a benchmark case
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    char name[128];
+    size_t iterations;
+    double nsPerOp;
+    double allocationsPerOp;
+    double itemsPerSecond;
+    double baselineNsPerOp;
+    double metric;
+} sfBenchResult;
+
+////////////////////////////////////////////////////////////
+/// Command line options
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char *filter;
+    const char *output;
+    const char *baseline;
+    double threshold;
+    sfInt64 minTime;
+} sfBenchOptions;
+
+////////////////////////////////////////////////////////////
+volatile float sfBench_sink = 0;
+double sfBench_metric = 0;
+static sfBenchCase sfBench_cases[SF_BENCH_MAX_CASES];
+static size_t sfBench_caseCount = 0;
+static size_t sfBench_allocationCount = 0;
+
+////////////////////////////////////////////////////////////
+#ifdef SF_BENCH_WRAP_ALLOCATIONS
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    sfBench_allocationCount++;
+    return (__real_malloc(size));
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    sfBench_allocationCount++;
+    return (__real_calloc(count, size));
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+    sfBench_allocationCount++;
+    return (__real_realloc(pointer, size));
+}
+
+#endif
+
+////////////////////////////////////////////////////////////
+void sfBench_register(sfBenchCase benchCase)
+{
+    if (sfBench_caseCount == SF_BENCH_MAX_CASES) {
+        fprintf(stderr, "Too many benchmark cases, %s ignored\n", benchCase.name);
+        return;
+    }
+    sfBench_cases[sfBench_caseCount++] = benchCase;
+}
+
+////////////////////////////////////////////////////////////
+/// Build the full name of a case, with its parameters
+////////////////////////////////////////////////////////////
+static void sfBench_getName(const sfBenchCase *benchCase, char *name, size_t size)
+{
+    int length = snprintf(name, size, "%s", benchCase->name);
+
+    for (size_t i = 0; i < SF_BENCH_MAX_PARAMS && benchCase->paramNames[i] != NULL; i++) {
+        if (length < 0 || (size_t)length >= size)
+            return;
+        length += snprintf(name + length, size - length, "%c%s=%zu", i ? ',' : '/', benchCase->paramNames[i], benchCase->params[i]);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Run a case for a number of iterations and return the time it took
+////////////////////////////////////////////////////////////
+static sfInt64 sfBench_time(const sfBenchCase *benchCase, void *data, size_t iterations)
+{
+    sfClock *clock = sfClock_create();
+    sfInt64 elapsed = 0;
+
+    benchCase->run(data, iterations);
+    elapsed = sfClock_getElapsedTime(clock).microseconds;
+    sfClock_destroy(clock);
+    return (elapsed);
+}
+
+////////////////////////////////////////////////////////////
+/// Sort helper for the median
+////////////////////////////////////////////////////////////
+static int sfBench_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return ((x > y) - (x < y));
+}
+
+////////////////////////////////////////////////////////////
+/// Calibrate, then measure a case several times and keep the median
+////////////////////////////////////////////////////////////
+static sfBenchResult sfBench_runCase(const sfBenchCase *benchCase, const sfBenchOptions *options)
+{
+    sfBenchResult result = {{0}, 1, 0, -1, 0, -1, 0};
+    double samples[SF_BENCH_REPETITIONS];
+    void *data = NULL;
+    sfInt64 elapsed = 0;
+    size_t allocations = 0;
+
+    sfBench_metric = 0;
+    if (benchCase->setup)
+        data = benchCase->setup(benchCase->params);
+    elapsed = sfBench_time(benchCase, data, 1);
+    sfBench_getName(benchCase, result.name, sizeof(result.name));
+    while (elapsed < options->minTime / SF_BENCH_REPETITIONS && result.iterations < ((size_t)1 << 40)) {
+        result.iterations *= elapsed > 0 && options->minTime / elapsed < 8 ? 2 : 8;
+        elapsed = sfBench_time(benchCase, data, result.iterations);
+    }
+    for (size_t i = 0; i < SF_BENCH_REPETITIONS; i++) {
+        allocations = sfBench_allocationCount;
+        samples[i] = sfBench_time(benchCase, data, result.iterations) * 1000.0 / result.iterations;
+        allocations = sfBench_allocationCount - allocations;
+    }
+    qsort(samples, SF_BENCH_REPETITIONS, sizeof(double), sfBench_compare);
+    result.nsPerOp = samples[SF_BENCH_REPETITIONS / 2];
+#ifdef SF_BENCH_WRAP_ALLOCATIONS
+    result.allocationsPerOp = (double)allocations / result.iterations;
+#endif
+    if (result.nsPerOp > 0)
+        result.itemsPerSecond = benchCase->itemsPerOp * 1e9 / result.nsPerOp;
+    result.metric = sfBench_metric;
+    if (benchCase->teardown)
+        benchCase->teardown(data);
+    return (result);
+}
+
+////////////////////////////////////////////////////////////
+/// Load the content of a file in a string
+////////////////////////////////////////////////////////////
+static char *sfBench_readFile(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    char *content = NULL;
+    long size = 0;
+
+    if (file == NULL)
+        return (NULL);
+    if (fseek(file, 0, SEEK_END) == 0 && (size = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+        content = malloc(size + 1);
+    if (content != NULL) {
+        size = (long)fread(content, 1, size, file);
+        content[size] = '\0';
+    }
+    fclose(file);
+    return (content);
+}
+
+////////////////////////////////////////////////////////////
+/// Find the time of a case in a report written by this program
+////////////////////////////////////////////////////////////
+static double sfBench_findBaseline(const char *report, const char *name)
+{
+    char key[160];
+    const char *entry = NULL;
+    const char *value = NULL;
+
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    entry = strstr(report, key);
+    if (entry == NULL)
+        return (-1);
+    value = strstr(entry, "\"ns_per_op\":");
+    if (value == NULL)
+        return (-1);
+    return (strtod(value + strlen("\"ns_per_op\":"), NULL));
+}
+
+////////////////////////////////////////////////////////////
+/// Write the results as JSON
+////////////////////////////////////////////////////////////
+static void sfBench_writeJson(FILE *file, const sfBenchCase *cases, const sfBenchResult *results, size_t count)
+{
+    fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "    {\n      \"name\": \"%s\",\n      \"params\": {", results[i].name);
+        for (size_t j = 0; j < SF_BENCH_MAX_PARAMS && cases[i].paramNames[j] != NULL; j++)
+            fprintf(file, "%s\"%s\": %zu", j ? ", " : "", cases[i].paramNames[j], cases[i].params[j]);
+        fprintf(file, "},\n      \"iterations\": %zu,\n      \"ns_per_op\": %.3f,\n", results[i].iterations, results[i].nsPerOp);
+        if (results[i].allocationsPerOp < 0)
+            fprintf(file, "      \"allocs_per_op\": null,\n");
+        else
+            fprintf(file, "      \"allocs_per_op\": %.3f,\n", results[i].allocationsPerOp);
+        fprintf(file, "      \"items_per_second\": %.1f", results[i].itemsPerSecond);
+        if (results[i].baselineNsPerOp > 0)
+            fprintf(file, ",\n      \"baseline_ns_per_op\": %.3f", results[i].baselineNsPerOp);
+        if (cases[i].metricName != NULL)
+            fprintf(file, ",\n      \"%s\": %.3f", cases[i].metricName, results[i].metric);
+        fprintf(file, "\n    }%s\n", i + 1 < count ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+////////////////////////////////////////////////////////////
+/// Parse the command line
+////////////////////////////////////////////////////////////
+static sfBool sfBench_parseOptions(int argc, char **argv, sfBenchOptions *options)
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            options->filter = argv[++i];
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            options->output = argv[++i];
+        else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc)
+            options->baseline = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+            options->threshold = strtod(argv[++i], NULL);
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+            options->minTime = strtoll(argv[++i], NULL, 10) * 1000;
+        else {
+            fprintf(stderr, "Usage: %s [--filter text] [--output file.json] [--baseline file.json] [--threshold percent] [--min-time ms]\n", argv[0]);
+            return (sfFalse);
+        }
+    }
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+    sfBenchOptions options = {NULL, NULL, NULL, 10.0, 200000};
+    static sfBenchCase cases[SF_BENCH_MAX_CASES];
+    static sfBenchResult results[SF_BENCH_MAX_CASES];
+    char *baseline = NULL;
+    FILE *output = stdout;
+    size_t count = 0;
+    size_t regressions = 0;
+
+    if (!sfBench_parseOptions(argc, argv, &options))
+        return (2);
+    sfBench_registerBezierCurve();
+    sfBench_registerBezierIntersection();
+    sfBench_registerBroadphase();
+    sfBench_registerAnimatedSprite();
+    sfBench_registerCachedLayer();
+    sfBench_registerFrameStore();
+    sfBench_registerMouse();
+    sfBench_registerRasterizer();
+    sfBench_registerSnapshotBuffer();
+    sfBench_registerSpriteSheet();
+    sfBench_registerTessellator();
+    if (options.baseline != NULL && (baseline = sfBench_readFile(options.baseline)) == NULL)
+        fprintf(stderr, "Cannot read the baseline %s\n", options.baseline);
+    for (size_t i = 0; i < sfBench_caseCount; i++) {
+        if (options.filter != NULL && strstr(sfBench_cases[i].name, options.filter) == NULL)
+            continue;
+        cases[count] = sfBench_cases[i];
+        results[count] = sfBench_runCase(&cases[count], &options);
+        fprintf(stderr, "%-56s %14.1f ns/op", results[count].name, results[count].nsPerOp);
+        if (cases[count].metricName != NULL)
+            fprintf(stderr, " %s %.3f", cases[count].metricName, results[count].metric);
+        if (baseline != NULL)
+            results[count].baselineNsPerOp = sfBench_findBaseline(baseline, results[count].name);
+        if (results[count].baselineNsPerOp > 0) {
+            fprintf(stderr, " %+7.1f%%", (results[count].nsPerOp / results[count].baselineNsPerOp - 1) * 100);
+            if (results[count].nsPerOp > results[count].baselineNsPerOp * (1 + options.threshold / 100)) {
+                fprintf(stderr, " REGRESSION");
+                regressions++;
+            }
+        }
+        fprintf(stderr, "\n");
+        count++;
+    }
+    if (options.output != NULL && (output = fopen(options.output, "w")) == NULL) {
+        fprintf(stderr, "Cannot write %s\n", options.output);
+        output = stdout;
+    }
+    sfBench_writeJson(output, cases, results, count);
+    if (output != stdout)
+        fclose(output);
+    free(baseline);
+    if (regressions > 0)
+        fprintf(stderr, "%zu regression(s) over %.1f%%\n", regressions, options.threshold);
+    return (regressions > 0);
+}
@@ -0,0 +1,104 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_ADDITION_BENCHMARK_H
+    #define SFML_ADDITION_BENCHMARK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Maximum number of parameters of a benchmark case
+///
+////////////////////////////////////////////////////////////
+#define SF_BENCH_MAX_PARAMS 3
+
+////////////////////////////////////////////////////////////
+/// \brief Benchmark case
+///
+/// \a setup builds the data of the case from its parameters,
+/// \a run performs \a iterations operations on it and
+/// \a teardown releases it. \a itemsPerOp is the number of
+/// items (points, sprites, ...) processed by one operation,
+/// it is used to report the throughput. When \a metricName is
+/// set, the case stores a value of its own (a compression
+/// ratio, ...) in sfBench_metric, it is reported under this
+/// name.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char *name;
+    const char *paramNames[SF_BENCH_MAX_PARAMS];
+    size_t params[SF_BENCH_MAX_PARAMS];
+    size_t itemsPerOp;
+    void *(*setup)(const size_t *params);
+    void (*run)(void *data, size_t iterations);
+    void (*teardown)(void *data);
+    const char *metricName;
+} sfBenchCase;
+
+////////////////////////////////////////////////////////////
+/// \brief Sink used to keep the results of the benchmarks alive
+///
+////////////////////////////////////////////////////////////
+extern volatile float sfBench_sink;
+
+////////////////////////////////////////////////////////////
+/// \brief Value reported by the case being measured
+///
+/// It is reset before the setup of each case and read before
+/// its teardown.
+///
+////////////////////////////////////////////////////////////
+extern double sfBench_metric;
+
+////////////////////////////////////////////////////////////
+/// \brief Register a benchmark case
+///
+/// \param benchCase    Case to register, its strings must outlive the run
+///
+////////////////////////////////////////////////////////////
+void sfBench_register(sfBenchCase benchCase);
+
+////////////////////////////////////////////////////////////
+/// \brief Register the benchmark cases of each module
+///
+////////////////////////////////////////////////////////////
+void sfBench_registerBezierCurve(void);
+void sfBench_registerBezierIntersection(void);
+void sfBench_registerBroadphase(void);
+void sfBench_registerCachedLayer(void);
+void sfBench_registerFrameStore(void);
+void sfBench_registerAnimatedSprite(void);
+void sfBench_registerMouse(void);
+void sfBench_registerRasterizer(void);
+void sfBench_registerSnapshotBuffer(void);
+void sfBench_registerSpriteSheet(void);
+void sfBench_registerTessellator(void);
+
+#endif // SFML_ADDITION_BENCHMARK_H
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/BezierCurve.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the bezier curve cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBezierCurve *curve;
+    sfVertexArray *vertexArray;
+    sfArena *arena;
+    size_t sampleCount;
+} sfBezierCurveBench;
+
+////////////////////////////////////////////////////////////
+static void *sfBezierCurveBench_setup(const size_t *params)
+{
+    sfBezierCurveBench *bench = malloc(sizeof(sfBezierCurveBench));
+
+    bench->curve = sfBezierCurve_create();
+    bench->vertexArray = sfVertexArray_create();
+    bench->arena = sfArena_create(params[1] * sizeof(sfVertex));
+    bench->sampleCount = params[1];
+    sfBezierCurve_setCurveColor(bench->curve, sfWhite);
+    for (size_t i = 0; i < params[0]; i++)
+        sfBezierCurve_addPoint(bench->curve, (sfVector2f){i * 40.f, (i % 2) * 300.f});
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_teardown(void *data)
+{
+    sfBezierCurveBench *bench = data;
+
+    sfBezierCurve_destroy(bench->curve);
+    sfVertexArray_destroy(bench->vertexArray);
+    sfArena_destroy(bench->arena);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_calculatePoint(void *data, size_t iterations)
+{
+    sfBezierCurveBench *bench = data;
+    float sum = 0;
+
+    for (size_t i = 0; i < iterations; i++)
+        sum += sfBezierCurve_calculatePoint(bench->curve, (float)(i & 1023) / 1024).x;
+    sfBench_sink = sum;
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_calculatePointGeneric(void *data, size_t iterations)
+{
+    sfBezierCurveBench *bench = data;
+    float sum = 0;
+
+    for (size_t i = 0; i < iterations; i++)
+        sum += sfBezierCurve_calculatePointGeneric(bench->curve, (float)(i & 1023) / 1024).x;
+    sfBench_sink = sum;
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_getBounds(void *data, size_t iterations)
+{
+    sfBezierCurveBench *bench = data;
+    float sum = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        bench->curve->points[1].y = (float)(i & 255);
+        sum += sfBezierCurve_getBounds(bench->curve).height;
+    }
+    sfBench_sink = sum;
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_tessellate(void *data, size_t iterations)
+{
+    sfBezierCurveBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sfVertexArray_clear(bench->vertexArray);
+        sfBezierCurve_tessellate(bench->curve, bench->vertexArray, bench->sampleCount);
+    }
+    sfBench_sink = sfVertexArray_getVertex(bench->vertexArray, 0)->position.x;
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveBench_sample(void *data, size_t iterations)
+{
+    sfBezierCurveBench *bench = data;
+    sfVertex *vertices = NULL;
+
+    sfAllocator_setFrameArena(bench->arena);
+    for (size_t i = 0; i < iterations; i++) {
+        sfArena_reset(bench->arena);
+        vertices = sfArena_allocate(bench->arena, bench->sampleCount * sizeof(sfVertex));
+        sfBezierCurve_sample(bench->curve, vertices, bench->sampleCount);
+    }
+    sfBench_sink = vertices[0].position.x;
+    sfAllocator_setFrameArena(NULL);
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerBezierCurve(void)
+{
+    const size_t points[] = {3, 4, 5, 8, 16};
+    const size_t samples[] = {100, 1000, SF_BEZIERCURVE_SAMPLE_COUNT};
+
+    for (size_t i = 0; i < sizeof(points) / sizeof(*points); i++) {
+        sfBench_register((sfBenchCase){"bezier.calculatePoint", {"points"}, {points[i], 0}, 1,
+            sfBezierCurveBench_setup, sfBezierCurveBench_calculatePoint, sfBezierCurveBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"bezier.calculatePointGeneric", {"points"}, {points[i], 0}, 1,
+            sfBezierCurveBench_setup, sfBezierCurveBench_calculatePointGeneric, sfBezierCurveBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"bezier.getBounds", {"points"}, {points[i], 0}, 1,
+            sfBezierCurveBench_setup, sfBezierCurveBench_getBounds, sfBezierCurveBench_teardown, NULL});
+        for (size_t j = 0; j < sizeof(samples) / sizeof(*samples); j++) {
+            sfBench_register((sfBenchCase){"bezier.tessellate", {"points", "samples"}, {points[i], samples[j]}, samples[j],
+                sfBezierCurveBench_setup, sfBezierCurveBench_tessellate, sfBezierCurveBench_teardown, NULL});
+            sfBench_register((sfBenchCase){"bezier.sample", {"points", "samples"}, {points[i], samples[j]}, samples[j],
+                sfBezierCurveBench_setup, sfBezierCurveBench_sample, sfBezierCurveBench_teardown, NULL});
+        }
+    }
+}
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/BezierIntersection.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Largest number of crossings kept for a pair of curves
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS 32
+
+////////////////////////////////////////////////////////////
+/// Data of the bezier intersection cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBezierCurve **curves;
+    size_t count;
+    size_t samples;
+    sfVector2f *pointsA;
+    sfVector2f *pointsB;
+} sfBezierIntersectionBench;
+
+////////////////////////////////////////////////////////////
+/// Scatter curves of params[1] points over a 200x200 square,
+/// where most of them cross each other
+////////////////////////////////////////////////////////////
+static void *sfBezierIntersectionBench_setup(const size_t *params)
+{
+    sfBezierIntersectionBench *bench = malloc(sizeof(sfBezierIntersectionBench));
+    sfUint32 seed = 7;
+
+    bench->count = params[0] * 2;
+    bench->samples = params[2];
+    bench->curves = malloc(bench->count * sizeof(sfBezierCurve *));
+    bench->pointsA = malloc((bench->samples + 1) * sizeof(sfVector2f));
+    bench->pointsB = malloc((bench->samples + 1) * sizeof(sfVector2f));
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->curves[i] = sfBezierCurve_create();
+        for (size_t j = 0; j < params[1]; j++) {
+            seed = seed * 1664525 + 1013904223;
+            sfBezierCurve_addPoint(bench->curves[i], (sfVector2f){(seed >> 8) % 4096 * 200.f / 4096, (seed >> 20) * 200.f / 4096});
+        }
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionBench_teardown(void *data)
+{
+    sfBezierIntersectionBench *bench = data;
+
+    for (size_t i = 0; i < bench->count; i++)
+        sfBezierCurve_destroy(bench->curves[i]);
+    free(bench->curves);
+    free(bench->pointsA);
+    free(bench->pointsB);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionBench_intersectCurve(void *data, size_t iterations)
+{
+    sfBezierIntersectionBench *bench = data;
+    sfBezierIntersection intersections[SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS];
+    size_t crossings = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        crossings = 0;
+        for (size_t j = 0; j < bench->count; j += 2) {
+            crossings += sfBezierCurve_intersectCurve(bench->curves[j], bench->curves[j + 1], 0.01f,
+                intersections, SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS);
+        }
+    }
+    sfBench_metric = (double)crossings;
+}
+
+////////////////////////////////////////////////////////////
+/// Sample both curves and cross every pair of segments, what
+/// route editors do without intersection queries
+////////////////////////////////////////////////////////////
+static size_t sfBezierIntersectionBench_crossSampled(sfBezierIntersectionBench *bench, const sfBezierCurve *a, const sfBezierCurve *b)
+{
+    size_t crossings = 0;
+
+    for (size_t i = 0; i <= bench->samples; i++) {
+        bench->pointsA[i] = sfBezierCurve_calculatePoint(a, (float)i / bench->samples);
+        bench->pointsB[i] = sfBezierCurve_calculatePoint(b, (float)i / bench->samples);
+    }
+    for (size_t i = 0; i < bench->samples; i++) {
+        sfVector2f r = {bench->pointsA[i + 1].x - bench->pointsA[i].x, bench->pointsA[i + 1].y - bench->pointsA[i].y};
+
+        for (size_t j = 0; j < bench->samples; j++) {
+            sfVector2f s = {bench->pointsB[j + 1].x - bench->pointsB[j].x, bench->pointsB[j + 1].y - bench->pointsB[j].y};
+            sfVector2f q = {bench->pointsB[j].x - bench->pointsA[i].x, bench->pointsB[j].y - bench->pointsA[i].y};
+            float denominator = r.x * s.y - r.y * s.x;
+            float t = (q.x * s.y - q.y * s.x) / denominator;
+            float u = (q.x * r.y - q.y * r.x) / denominator;
+
+            crossings += (t >= 0) & (t < 1) & (u >= 0) & (u < 1);
+        }
+    }
+    return (crossings);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionBench_sampled(void *data, size_t iterations)
+{
+    sfBezierIntersectionBench *bench = data;
+    size_t crossings = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        crossings = 0;
+        for (size_t j = 0; j < bench->count; j += 2)
+            crossings += sfBezierIntersectionBench_crossSampled(bench, bench->curves[j], bench->curves[j + 1]);
+    }
+    sfBench_metric = (double)crossings;
+}
+
+////////////////////////////////////////////////////////////
+/// Cross every curve with the lines of a grid of 20x20 cells
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionBench_intersectLine(void *data, size_t iterations)
+{
+    sfBezierIntersectionBench *bench = data;
+    sfBezierIntersection intersections[SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS];
+    size_t crossings = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        crossings = 0;
+        for (size_t j = 0; j < bench->count; j += 2) {
+            for (float line = 0; line <= 200; line += 20) {
+                crossings += sfBezierCurve_intersectLine(bench->curves[j], (sfVector2f){line, 0}, (sfVector2f){line, 200},
+                    0.01f, intersections, SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS);
+                crossings += sfBezierCurve_intersectLine(bench->curves[j], (sfVector2f){0, line}, (sfVector2f){200, line},
+                    0.01f, intersections, SF_BEZIERINTERSECTIONBENCH_MAX_CROSSINGS);
+            }
+        }
+    }
+    sfBench_metric = (double)crossings;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerBezierIntersection(void)
+{
+    const size_t points[] = {3, 4};
+    const size_t samples[] = {64, 256};
+
+    for (size_t i = 0; i < sizeof(points) / sizeof(*points); i++) {
+        sfBench_register((sfBenchCase){"bezierIntersection.intersectCurve", {"pairs", "points"}, {1000, points[i]}, 1000,
+            sfBezierIntersectionBench_setup, sfBezierIntersectionBench_intersectCurve, sfBezierIntersectionBench_teardown, "crossings"});
+        for (size_t j = 0; j < sizeof(samples) / sizeof(*samples); j++) {
+            sfBench_register((sfBenchCase){"bezierIntersection.sampled", {"pairs", "points", "samples"}, {1000, points[i], samples[j]}, 1000,
+                sfBezierIntersectionBench_setup, sfBezierIntersectionBench_sampled, sfBezierIntersectionBench_teardown, "crossings"});
+        }
+        sfBench_register((sfBenchCase){"bezierIntersection.intersectLine", {"curves", "points"}, {1000, points[i]}, 1000 * 22,
+            sfBezierIntersectionBench_setup, sfBezierIntersectionBench_intersectLine, sfBezierIntersectionBench_teardown, "crossings"});
+    }
+}
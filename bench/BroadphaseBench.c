@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <SFML/Addition/Broadphase.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the broadphase cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBroadphase *broadphase;
+    sfSprite **sprites;
+    sfFloatRect *bounds;
+    size_t count;
+    float step;
+} sfBroadphaseBench;
+
+////////////////////////////////////////////////////////////
+/// Scatter rotated 16x16 sprites over a square sized so that
+/// each sprite overlaps about one other
+////////////////////////////////////////////////////////////
+static void *sfBroadphaseBench_setup(const size_t *params)
+{
+    sfBroadphaseBench *bench = malloc(sizeof(sfBroadphaseBench));
+    float size = sqrtf(512.f * params[0]);
+    sfUint32 seed = 42;
+
+    bench->count = params[0];
+    bench->step = 1;
+    bench->sprites = malloc(bench->count * sizeof(sfSprite *));
+    bench->bounds = malloc(bench->count * sizeof(sfFloatRect));
+    bench->broadphase = sfBroadphase_create(bench->count);
+    sfBroadphase_setNarrowPhase(bench->broadphase, params[1] != 0);
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->sprites[i] = sfSprite_create();
+        sfSprite_setTextureRect(bench->sprites[i], (sfIntRect){0, 0, 16, 16});
+        seed = seed * 1664525 + 1013904223;
+        sfSprite_setPosition(bench->sprites[i], (sfVector2f){(seed >> 8) % 4096 * size / 4096, (seed >> 20) * size / 4096});
+        sfSprite_setRotation(bench->sprites[i], (float)(i % 90));
+        sfBroadphase_addSprite(bench->broadphase, bench->sprites[i], NULL);
+    }
+    sfBroadphase_update(bench->broadphase);
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBroadphaseBench_teardown(void *data)
+{
+    sfBroadphaseBench *bench = data;
+
+    for (size_t i = 0; i < bench->count; i++)
+        sfSprite_destroy(bench->sprites[i]);
+    sfBroadphase_destroy(bench->broadphase);
+    free(bench->sprites);
+    free(bench->bounds);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+/// Move every sprite a pixel back and forth
+////////////////////////////////////////////////////////////
+static void sfBroadphaseBench_move(sfBroadphaseBench *bench)
+{
+    for (size_t i = 0; i < bench->count; i++)
+        sfSprite_move(bench->sprites[i], (sfVector2f){i % 2 ? bench->step : -bench->step, 0});
+    bench->step = -bench->step;
+}
+
+////////////////////////////////////////////////////////////
+static void sfBroadphaseBench_update(void *data, size_t iterations)
+{
+    sfBroadphaseBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sfBroadphaseBench_move(bench);
+        sfBench_metric = (double)sfBroadphase_update(bench->broadphase);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Test every sprite against every other, as gameplay code
+/// does without a broadphase
+////////////////////////////////////////////////////////////
+static void sfBroadphaseBench_bruteForce(void *data, size_t iterations)
+{
+    sfBroadphaseBench *bench = data;
+    size_t pairs = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sfBroadphaseBench_move(bench);
+        pairs = 0;
+        for (size_t j = 0; j < bench->count; j++)
+            bench->bounds[j] = sfSprite_getGlobalBounds(bench->sprites[j]);
+        for (size_t j = 0; j < bench->count; j++) {
+            for (size_t k = j + 1; k < bench->count; k++)
+                pairs += sfFloatRect_intersects(&bench->bounds[j], &bench->bounds[k], NULL);
+        }
+        sfBench_metric = (double)pairs;
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Count the pairs found by an update, so that the throughput
+/// is reported in pairs per second
+////////////////////////////////////////////////////////////
+static size_t sfBroadphaseBench_countPairs(size_t count, size_t narrowPhase)
+{
+    const size_t params[] = {count, narrowPhase};
+    sfBroadphaseBench *bench = sfBroadphaseBench_setup(params);
+    size_t pairs = bench->broadphase->pairCount;
+
+    sfBroadphaseBench_teardown(bench);
+    return (pairs);
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerBroadphase(void)
+{
+    const size_t sprites[] = {1000, 5000, 20000};
+
+    for (size_t i = 0; i < sizeof(sprites) / sizeof(*sprites); i++) {
+        for (size_t narrow = 0; narrow < 2; narrow++) {
+            sfBench_register((sfBenchCase){"broadphase.update", {"sprites", "narrow"}, {sprites[i], narrow},
+                sfBroadphaseBench_countPairs(sprites[i], narrow), sfBroadphaseBench_setup, sfBroadphaseBench_update,
+                sfBroadphaseBench_teardown, "pairs"});
+        }
+        if (sprites[i] > 5000)
+            continue;
+        sfBench_register((sfBenchCase){"broadphase.bruteForce", {"sprites"}, {sprites[i]},
+            sfBroadphaseBench_countPairs(sprites[i], 0), sfBroadphaseBench_setup, sfBroadphaseBench_bruteForce,
+            sfBroadphaseBench_teardown, "pairs"});
+    }
+}
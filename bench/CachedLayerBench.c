@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/CachedLayer.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the cached layer cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfCachedLayer *layer;
+    sfBezierCurve **curves;
+    size_t count;
+    size_t moving;
+} sfCachedLayerBench;
+
+////////////////////////////////////////////////////////////
+static void *sfCachedLayerBench_setup(const size_t *params)
+{
+    sfCachedLayerBench *bench = malloc(sizeof(sfCachedLayerBench));
+
+    bench->layer = sfCachedLayer_create((sfFloatRect){0, 0, 1920, 1080});
+    bench->count = params[0];
+    bench->moving = params[1];
+    bench->curves = malloc(bench->count * sizeof(sfBezierCurve *));
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->curves[i] = sfBezierCurve_create();
+        sfBezierCurve_setCurveColor(bench->curves[i], sfWhite);
+        for (size_t j = 0; j < 4; j++)
+            sfBezierCurve_addPoint(bench->curves[i], (sfVector2f){(i % 8) * 240.f + j * 60, (i / 8 % 8) * 135.f + (j % 2) * 100});
+        sfCachedLayer_addBezierCurve(bench->layer, bench->curves[i]);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfCachedLayerBench_teardown(void *data)
+{
+    sfCachedLayerBench *bench = data;
+
+    sfCachedLayer_destroy(bench->layer);
+    for (size_t i = 0; i < bench->count; i++)
+        sfBezierCurve_destroy(bench->curves[i]);
+    free(bench->curves);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfCachedLayerBench_drawDirect(void *data, size_t iterations)
+{
+    sfCachedLayerBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < bench->count; j++)
+            sfRenderWindow_drawBezierCurve(NULL, bench->curves[j], NULL);
+    }
+    sfBench_sink = bench->curves[0]->points[0].x;
+}
+
+////////////////////////////////////////////////////////////
+static void sfCachedLayerBench_drawCached(void *data, size_t iterations)
+{
+    sfCachedLayerBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < bench->moving; j++)
+            sfBezierCurve_move(bench->curves[j], (sfVector2f){i % 2 ? 1.f : -1.f, 0});
+        sfRenderWindow_drawCachedLayer(NULL, bench->layer, NULL);
+    }
+    sfBench_sink = sfCachedLayer_getStats(bench->layer).redrawFraction;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerCachedLayer(void)
+{
+    const size_t curves[] = {16, 64};
+
+    for (size_t i = 0; i < sizeof(curves) / sizeof(*curves); i++) {
+        sfBench_register((sfBenchCase){"cachedLayer.drawDirect", {"curves"}, {curves[i]}, curves[i],
+            sfCachedLayerBench_setup, sfCachedLayerBench_drawDirect, sfCachedLayerBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"cachedLayer.drawCached", {"curves", "moving"}, {curves[i], 0}, curves[i],
+            sfCachedLayerBench_setup, sfCachedLayerBench_drawCached, sfCachedLayerBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"cachedLayer.drawCached", {"curves", "moving"}, {curves[i], 1}, curves[i],
+            sfCachedLayerBench_setup, sfCachedLayerBench_drawCached, sfCachedLayerBench_teardown, NULL});
+    }
+}
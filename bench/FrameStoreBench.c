@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/FrameStore.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Number of frames of the animation sheets
+////////////////////////////////////////////////////////////
+#define SF_FRAMESTOREBENCH_FRAMES 64
+
+////////////////////////////////////////////////////////////
+/// Data of the frame store cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfImage *image;
+    sfFrameStore *frameStore;
+    sfTexture *texture;
+    sfUint8 *pixels;
+    sfVector2u frameSize;
+} sfFrameStoreBench;
+
+////////////////////////////////////////////////////////////
+/// Draw a sheet of frames of a ball growing on a transparent
+/// background, shaded with a gradient, or flat with 12 colors
+/// when the palette parameter is set
+////////////////////////////////////////////////////////////
+static void *sfFrameStoreBench_setup(const size_t *params)
+{
+    sfFrameStoreBench *bench = malloc(sizeof(sfFrameStoreBench));
+    unsigned int size = (unsigned int)params[0];
+    sfVector2u sheetSize = {size * 8, size * SF_FRAMESTOREBENCH_FRAMES / 8};
+
+    bench->frameSize = (sfVector2u){size, size};
+    bench->image = sfImage_createFromColor(sheetSize.x, sheetSize.y, sfTransparent);
+    for (unsigned int y = 0; y < sheetSize.y; y++) {
+        for (unsigned int x = 0; x < sheetSize.x; x++) {
+            int dx = (int)(x % size) - (int)size / 2;
+            int dy = (int)(y % size) - (int)size / 2;
+            int radius = (int)(size / 4 + (x / size + y / size * 8) * size / 4 / SF_FRAMESTOREBENCH_FRAMES);
+            unsigned int shade = (unsigned int)(dx + dy + (int)size) * 255 / (size * 2);
+
+            if (dx * dx + dy * dy >= radius * radius)
+                continue;
+            if (params[1])
+                shade = shade / 22 * 22;
+            sfImage_setPixel(bench->image, x, y, (sfColor){(sfUint8)shade, (sfUint8)(255 - shade), 96, 255});
+        }
+    }
+    bench->frameStore = sfFrameStore_createFromImage(bench->image, bench->frameSize, 4);
+    bench->texture = sfTexture_create(sheetSize.x, sheetSize.y);
+    bench->pixels = malloc((size_t)size * size * 4);
+    sfBench_metric = sfFrameStore_getCompressionRatio(bench->frameStore);
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfFrameStoreBench_teardown(void *data)
+{
+    sfFrameStoreBench *bench = data;
+
+    free(bench->pixels);
+    sfTexture_destroy(bench->texture);
+    sfFrameStore_destroy(bench->frameStore);
+    sfImage_destroy(bench->image);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfFrameStoreBench_compress(void *data, size_t iterations)
+{
+    sfFrameStoreBench *bench = data;
+    sfFrameStore *frameStore = NULL;
+
+    for (size_t i = 0; i < iterations; i++) {
+        frameStore = sfFrameStore_createFromImage(bench->image, bench->frameSize, 1);
+        sfBench_sink = (float)frameStore->dataSize;
+        sfFrameStore_destroy(frameStore);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfFrameStoreBench_decompress(void *data, size_t iterations)
+{
+    sfFrameStoreBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfFrameStore_decompressFrame(bench->frameStore, i % SF_FRAMESTOREBENCH_FRAMES, bench->pixels);
+    sfBench_sink = bench->pixels[0];
+}
+
+////////////////////////////////////////////////////////////
+static void sfFrameStoreBench_rebuildTexture(void *data, size_t iterations)
+{
+    sfFrameStoreBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfBench_sink = (float)sfFrameStore_updateTexture(bench->frameStore, bench->texture, 0, SF_FRAMESTOREBENCH_FRAMES);
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerFrameStore(void)
+{
+    const size_t sizes[] = {32, 128};
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+        for (size_t palette = 0; palette < 2; palette++) {
+            size_t pixels = sizes[i] * sizes[i];
+
+            sfBench_register((sfBenchCase){"frameStore.compress", {"size", "palette"}, {sizes[i], palette},
+                pixels * SF_FRAMESTOREBENCH_FRAMES, sfFrameStoreBench_setup, sfFrameStoreBench_compress,
+                sfFrameStoreBench_teardown, "compression_ratio"});
+            sfBench_register((sfBenchCase){"frameStore.decompressFrame", {"size", "palette"}, {sizes[i], palette},
+                pixels, sfFrameStoreBench_setup, sfFrameStoreBench_decompress,
+                sfFrameStoreBench_teardown, "compression_ratio"});
+            sfBench_register((sfBenchCase){"frameStore.updateTexture", {"size", "palette"}, {sizes[i], palette},
+                pixels * SF_FRAMESTOREBENCH_FRAMES, sfFrameStoreBench_setup, sfFrameStoreBench_rebuildTexture,
+                sfFrameStoreBench_teardown, "compression_ratio"});
+        }
+    }
+}
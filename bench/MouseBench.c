@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/HitMask.h>
+#include <SFML/Addition/HitTester.h>
+#include <SFML/Addition/Mouse.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the hit test cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfImage *image;
+    sfHitMask *hitMask;
+    sfSprite **sprites;
+    sfHitTester *hitTester;
+    sfUint8 *results;
+    size_t count;
+} sfMouseBench;
+
+////////////////////////////////////////////////////////////
+static void *sfMouseBench_setup(const size_t *params)
+{
+    sfMouseBench *bench = malloc(sizeof(sfMouseBench));
+
+    bench->count = params[0];
+    bench->image = sfImage_createFromColor(64, 64, sfWhite);
+    bench->hitMask = sfHitMask_createFromImage(bench->image, 0);
+    bench->sprites = malloc(bench->count * sizeof(sfSprite *));
+    bench->hitTester = sfHitTester_create(bench->count);
+    bench->results = malloc(bench->count);
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->sprites[i] = sfSprite_create();
+        sfSprite_setTextureRect(bench->sprites[i], (sfIntRect){0, 0, 64, 64});
+        sfSprite_setPosition(bench->sprites[i], (sfVector2f){(i % 100) * 19.f, (i / 100 % 100) * 11.f});
+        sfSprite_setOrigin(bench->sprites[i], (sfVector2f){32, 32});
+        sfSprite_setRotation(bench->sprites[i], (i % 360) * 1.f);
+        sfHitTester_addSprite(bench->hitTester, bench->sprites[i]);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseBench_teardown(void *data)
+{
+    sfMouseBench *bench = data;
+
+    for (size_t i = 0; i < bench->count; i++)
+        sfSprite_destroy(bench->sprites[i]);
+    sfHitTester_destroy(bench->hitTester);
+    sfHitMask_destroy(bench->hitMask);
+    sfImage_destroy(bench->image);
+    free(bench->sprites);
+    free(bench->results);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+/// Point tested at a given iteration
+////////////////////////////////////////////////////////////
+static sfVector2f sfMouseBench_point(size_t iteration)
+{
+    return ((sfVector2f){(float)(iteration * 37 % 1920), (float)(iteration * 17 % 1080)});
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseBench_globalBounds(void *data, size_t iterations)
+{
+    sfMouseBench *bench = data;
+    size_t hits = 0;
+    sfFloatRect bounds;
+    sfVector2f point;
+
+    for (size_t i = 0; i < iterations; i++) {
+        point = sfMouseBench_point(i);
+        for (size_t j = 0; j < bench->count; j++) {
+            bounds = sfSprite_getGlobalBounds(bench->sprites[j]);
+            hits += sfFloatRect_contains(&bounds, point.x, point.y);
+        }
+    }
+    sfBench_sink = (float)hits;
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseBench_hitTester(void *data, size_t iterations)
+{
+    sfMouseBench *bench = data;
+    size_t hits = 0;
+
+    for (size_t i = 0; i < iterations; i++)
+        hits += sfHitTester_testPoint(bench->hitTester, sfMouseBench_point(i), bench->results);
+    sfBench_sink = (float)hits;
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseBench_hitMask(void *data, size_t iterations)
+{
+    sfMouseBench *bench = data;
+    size_t hits = 0;
+    sfTransform inverse;
+    sfVector2f point;
+
+    for (size_t i = 0; i < iterations; i++) {
+        point = sfMouseBench_point(i);
+        for (size_t j = 0; j < bench->count; j++) {
+            inverse = sfSprite_getInverseTransform(bench->sprites[j]);
+            hits += sfHitMask_containsLocalPoint(bench->hitMask, sfSprite_getTextureRect(bench->sprites[j]), sfTransform_transformPoint(&inverse, point));
+        }
+    }
+    sfBench_sink = (float)hits;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerMouse(void)
+{
+    const size_t sprites[] = {100, 10000};
+
+    for (size_t i = 0; i < sizeof(sprites) / sizeof(*sprites); i++) {
+        sfBench_register((sfBenchCase){"mouse.globalBounds", {"sprites"}, {sprites[i]}, sprites[i],
+            sfMouseBench_setup, sfMouseBench_globalBounds, sfMouseBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"mouse.hitTester", {"sprites"}, {sprites[i]}, sprites[i],
+            sfMouseBench_setup, sfMouseBench_hitTester, sfMouseBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"mouse.hitMask", {"sprites"}, {sprites[i]}, sprites[i],
+            sfMouseBench_setup, sfMouseBench_hitMask, sfMouseBench_teardown, NULL});
+    }
+}
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Rasterizer.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the rasterizer cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfImage *image;
+    sfImage *sheet;
+    sfRasterizer *rasterizer;
+    sfBezierCurve *curve;
+    sfAnimatedSprite **sprites;
+    size_t count;
+    float thickness;
+} sfRasterizerBench;
+
+////////////////////////////////////////////////////////////
+static sfRasterizerBench *sfRasterizerBench_create(size_t threadCount, size_t count, float thickness)
+{
+    sfRasterizerBench *bench = malloc(sizeof(sfRasterizerBench));
+
+    bench->image = sfImage_createFromColor(1024, 1024, sfBlack);
+    bench->sheet = sfImage_createFromColor(256, 256, (sfColor){255, 255, 255, 128});
+    bench->rasterizer = sfRasterizer_create(threadCount);
+    bench->curve = sfBezierCurve_create();
+    bench->count = count;
+    bench->thickness = thickness;
+    bench->sprites = malloc(bench->count * sizeof(sfAnimatedSprite *));
+    sfBezierCurve_setCurveColor(bench->curve, (sfColor){255, 255, 255, 16});
+    sfBezierCurve_addPoint(bench->curve, (sfVector2f){0, 0});
+    sfBezierCurve_addPoint(bench->curve, (sfVector2f){1024, 0});
+    sfBezierCurve_addPoint(bench->curve, (sfVector2f){0, 1024});
+    sfBezierCurve_addPoint(bench->curve, (sfVector2f){1024, 1024});
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->sprites[i] = sfAnimatedSprite_create();
+        sfSprite_setTextureRect(bench->sprites[i]->sprite, (sfIntRect){(i % 4) * 64, (i / 4 % 4) * 64, 64, 64});
+        sfSprite_setOrigin(bench->sprites[i]->sprite, (sfVector2f){32, 32});
+        sfSprite_setPosition(bench->sprites[i]->sprite, (sfVector2f){(i % 10) * 100.f + 50, (i / 10 % 10) * 100.f + 50});
+        sfSprite_setRotation(bench->sprites[i]->sprite, (i % 360) * 1.f);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void *sfRasterizerBench_setupCurve(const size_t *params)
+{
+    return (sfRasterizerBench_create(params[0], 0, params[1]));
+}
+
+////////////////////////////////////////////////////////////
+static void *sfRasterizerBench_setupSprites(const size_t *params)
+{
+    return (sfRasterizerBench_create(params[0], params[1], 1));
+}
+
+////////////////////////////////////////////////////////////
+static void sfRasterizerBench_teardown(void *data)
+{
+    sfRasterizerBench *bench = data;
+
+    for (size_t i = 0; i < bench->count; i++)
+        sfAnimatedSprite_destroy(bench->sprites[i]);
+    sfBezierCurve_destroy(bench->curve);
+    sfRasterizer_destroy(bench->rasterizer);
+    sfImage_destroy(bench->sheet);
+    sfImage_destroy(bench->image);
+    free(bench->sprites);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfRasterizerBench_drawBezierCurve(void *data, size_t iterations)
+{
+    sfRasterizerBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfRasterizer_drawBezierCurve(bench->rasterizer, bench->image, bench->curve, bench->thickness, NULL);
+    sfBench_sink = sfImage_getPixelsPtr(bench->image)[0];
+}
+
+////////////////////////////////////////////////////////////
+static void sfRasterizerBench_drawAnimatedSprite(void *data, size_t iterations)
+{
+    sfRasterizerBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t j = 0; j < bench->count; j++)
+            sfRasterizer_drawAnimatedSprite(bench->rasterizer, bench->image, bench->sprites[j], bench->sheet);
+    }
+    sfBench_sink = sfImage_getPixelsPtr(bench->image)[0];
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerRasterizer(void)
+{
+    const size_t threads[] = {1, 4};
+    const size_t thicknesses[] = {1, 8};
+
+    for (size_t i = 0; i < sizeof(threads) / sizeof(*threads); i++) {
+        for (size_t j = 0; j < sizeof(thicknesses) / sizeof(*thicknesses); j++) {
+            sfBench_register((sfBenchCase){"rasterizer.bezierCurve", {"threads", "thickness"}, {threads[i], thicknesses[j]}, 1,
+                sfRasterizerBench_setupCurve, sfRasterizerBench_drawBezierCurve, sfRasterizerBench_teardown, NULL});
+        }
+        sfBench_register((sfBenchCase){"rasterizer.animatedSprite", {"threads", "sprites"}, {threads[i], 100}, 100,
+            sfRasterizerBench_setupSprites, sfRasterizerBench_drawAnimatedSprite, sfRasterizerBench_teardown, NULL});
+    }
+}
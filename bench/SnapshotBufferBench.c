@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/SnapshotBuffer.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the snapshot buffer cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSnapshotBuffer *snapshotBuffer;
+    sfBezierCurve **curves;
+    sfAnimatedSprite **sprites;
+    size_t curveCount;
+    size_t spriteCount;
+} sfSnapshotBufferBench;
+
+////////////////////////////////////////////////////////////
+static void *sfSnapshotBufferBench_setup(const size_t *params)
+{
+    sfSnapshotBufferBench *bench = malloc(sizeof(sfSnapshotBufferBench));
+
+    bench->snapshotBuffer = sfSnapshotBuffer_create();
+    bench->curveCount = params[0];
+    bench->spriteCount = params[1];
+    bench->curves = malloc(bench->curveCount * sizeof(sfBezierCurve *));
+    bench->sprites = malloc(bench->spriteCount * sizeof(sfAnimatedSprite *));
+    for (size_t i = 0; i < bench->curveCount; i++) {
+        bench->curves[i] = sfBezierCurve_create();
+        for (size_t j = 0; j < 4; j++)
+            sfBezierCurve_addPoint(bench->curves[i], (sfVector2f){j * 40.f, i * 2.f});
+        sfSnapshotBuffer_addBezierCurve(bench->snapshotBuffer, bench->curves[i]);
+    }
+    for (size_t i = 0; i < bench->spriteCount; i++) {
+        bench->sprites[i] = sfAnimatedSprite_create();
+        sfAnimatedSprite_setGridSize(bench->sprites[i], (sfVector2u){4, 4});
+        sfAnimatedSprite_setFrameSize(bench->sprites[i], (sfVector2u){64, 64});
+        sfAnimatedSprite_setMaxFrame(bench->sprites[i], 16);
+        sfAnimatedSprite_setFrameRate(bench->sprites[i], 12);
+        sfAnimatedSprite_setPosition(bench->sprites[i], (sfVector2f){(i % 100) * 19.f, (i / 100) * 11.f});
+        sfAnimatedSprite_setRotation(bench->sprites[i], (i % 360) * 1.f);
+        sfSnapshotBuffer_addAnimatedSprite(bench->snapshotBuffer, bench->sprites[i]);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSnapshotBufferBench_teardown(void *data)
+{
+    sfSnapshotBufferBench *bench = data;
+
+    for (size_t i = 0; i < bench->curveCount; i++)
+        sfBezierCurve_destroy(bench->curves[i]);
+    for (size_t i = 0; i < bench->spriteCount; i++)
+        sfAnimatedSprite_destroy(bench->sprites[i]);
+    sfSnapshotBuffer_destroy(bench->snapshotBuffer);
+    free(bench->curves);
+    free(bench->sprites);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSnapshotBufferBench_publish(void *data, size_t iterations)
+{
+    sfSnapshotBufferBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sfSnapshotBuffer_publish(bench->snapshotBuffer);
+        sfBench_sink = (float)sfSnapshotBuffer_acquire(bench->snapshotBuffer)->sequence;
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerSnapshotBuffer(void)
+{
+    const size_t counts[] = {100, 1000, 10000};
+
+    for (size_t i = 0; i < sizeof(counts) / sizeof(*counts); i++) {
+        sfBench_register((sfBenchCase){"snapshotBuffer.publish", {"curves", "sprites"}, {counts[i] / 10, counts[i]},
+            counts[i] + counts[i] / 10, sfSnapshotBufferBench_setup, sfSnapshotBufferBench_publish, sfSnapshotBufferBench_teardown, NULL});
+    }
+}
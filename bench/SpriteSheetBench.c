@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the sprite sheet cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    char *json;
+    size_t size;
+    sfSpriteSheet *spriteSheet;
+    sfAnimatedSprite *animatedSprite;
+} sfSpriteSheetBench;
+
+////////////////////////////////////////////////////////////
+/// Write a TexturePacker sheet of packed 32x32 frames, with a
+/// tag every 8 frames
+////////////////////////////////////////////////////////////
+static void *sfSpriteSheetBench_setup(const size_t *params)
+{
+    sfSpriteSheetBench *bench = malloc(sizeof(sfSpriteSheetBench));
+    size_t capacity = params[0] * 320 + 256;
+    size_t length = 0;
+
+    bench->json = malloc(capacity);
+    length += snprintf(bench->json + length, capacity - length, "{\"frames\": {\n");
+    for (size_t i = 0; i < params[0]; i++) {
+        length += snprintf(bench->json + length, capacity - length,
+            "\t\"frame_%05zu.png\": {\"frame\": {\"x\": %zu, \"y\": %zu, \"w\": 30, \"h\": 31}, \"rotated\": %s, "
+            "\"trimmed\": true, \"spriteSourceSize\": {\"x\": 1, \"y\": 0, \"w\": 30, \"h\": 31}, "
+            "\"sourceSize\": {\"w\": 32, \"h\": 32}, \"duration\": %zu}%s\n", i, i % 128 * 32, i / 128 * 32,
+            i % 3 ? "false" : "true", 50 + i % 4 * 25, i + 1 < params[0] ? "," : "");
+    }
+    length += snprintf(bench->json + length, capacity - length, "},\n\"meta\": {\"image\": \"sheet.png\", \"frameTags\": [");
+    for (size_t i = 0; i + 8 <= params[0] && i < 8 * 32; i += 8) {
+        length += snprintf(bench->json + length, capacity - length, "%s{\"name\": \"tag%zu\", \"from\": %zu, \"to\": %zu}",
+            i ? ", " : "", i / 8, i, i + 7);
+    }
+    length += snprintf(bench->json + length, capacity - length, "]}}\n");
+    bench->size = length;
+    bench->spriteSheet = sfSpriteSheet_createFromMemory(bench->json, bench->size);
+    bench->animatedSprite = sfAnimatedSprite_create();
+    sfAnimatedSprite_setSpriteSheet(bench->animatedSprite, bench->spriteSheet, NULL);
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetBench_teardown(void *data)
+{
+    sfSpriteSheetBench *bench = data;
+
+    sfAnimatedSprite_destroy(bench->animatedSprite);
+    sfSpriteSheet_destroy(bench->spriteSheet);
+    free(bench->json);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetBench_load(void *data, size_t iterations)
+{
+    sfSpriteSheetBench *bench = data;
+    sfSpriteSheet *spriteSheet = NULL;
+
+    for (size_t i = 0; i < iterations; i++) {
+        spriteSheet = sfSpriteSheet_createFromMemory(bench->json, bench->size);
+        sfBench_sink = (float)spriteSheet->frameCount;
+        sfSpriteSheet_destroy(spriteSheet);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetBench_seek(void *data, size_t iterations)
+{
+    sfSpriteSheetBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfAnimatedSprite_seek(bench->animatedSprite, sfMicroseconds((sfInt64)i * 16667));
+    sfBench_sink = (float)bench->animatedSprite->currentFrame;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerSpriteSheet(void)
+{
+    const size_t frames[] = {100, 1000, 10000};
+
+    for (size_t i = 0; i < sizeof(frames) / sizeof(*frames); i++) {
+        sfBench_register((sfBenchCase){"spriteSheet.load", {"frames"}, {frames[i]}, frames[i],
+            sfSpriteSheetBench_setup, sfSpriteSheetBench_load, sfSpriteSheetBench_teardown, NULL});
+        sfBench_register((sfBenchCase){"spriteSheet.seek", {"frames"}, {frames[i]}, 1,
+            sfSpriteSheetBench_setup, sfSpriteSheetBench_seek, sfSpriteSheetBench_teardown, NULL});
+    }
+}
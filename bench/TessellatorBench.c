@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Tessellator.h>
+#include "Benchmark.h"
+
+////////////////////////////////////////////////////////////
+/// Data of the tessellator cases
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTessellator *tessellator;
+    sfBezierCurve **curves;
+    size_t count;
+} sfTessellatorBench;
+
+////////////////////////////////////////////////////////////
+static void *sfTessellatorBench_setup(const size_t *params)
+{
+    sfTessellatorBench *bench = malloc(sizeof(sfTessellatorBench));
+
+    bench->tessellator = sfTessellator_create(params[1]);
+    bench->count = params[0];
+    bench->curves = malloc(bench->count * sizeof(sfBezierCurve *));
+    for (size_t i = 0; i < bench->count; i++) {
+        bench->curves[i] = sfBezierCurve_create();
+        for (size_t j = 0; j < 4; j++)
+            sfBezierCurve_addPoint(bench->curves[i], (sfVector2f){(i % 32) * 60.f + j * 20, (i / 32 % 32) * 34.f + (j % 2) * 30});
+        sfTessellator_addCurve(bench->tessellator, bench->curves[i]);
+    }
+    return (bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfTessellatorBench_teardown(void *data)
+{
+    sfTessellatorBench *bench = data;
+
+    sfTessellator_destroy(bench->tessellator);
+    for (size_t i = 0; i < bench->count; i++)
+        sfBezierCurve_destroy(bench->curves[i]);
+    free(bench->curves);
+    free(bench);
+}
+
+////////////////////////////////////////////////////////////
+static void sfTessellatorBench_run(void *data, size_t iterations)
+{
+    sfTessellatorBench *bench = data;
+
+    for (size_t i = 0; i < iterations; i++)
+        sfTessellator_run(bench->tessellator, 100);
+    sfBench_sink = bench->tessellator->vertices[0].position.x;
+}
+
+////////////////////////////////////////////////////////////
+void sfBench_registerTessellator(void)
+{
+    const size_t curves[] = {100, 1000};
+    const size_t threads[] = {1, 2, 4, 8};
+
+    for (size_t i = 0; i < sizeof(curves) / sizeof(*curves); i++) {
+        for (size_t j = 0; j < sizeof(threads) / sizeof(*threads); j++) {
+            sfBench_register((sfBenchCase){"tessellator.run", {"curves", "threads"}, {curves[i], threads[j]}, curves[i] * 100,
+                sfTessellatorBench_setup, sfTessellatorBench_run, sfTessellatorBench_teardown, NULL});
+        }
+    }
+}
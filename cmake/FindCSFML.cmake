@@ -0,0 +1,63 @@
+# Locate the CSFML headers and libraries
+#
+# Set CSFML_ROOT to the install prefix of CSFML if it is not in a standard location.
+#
+# Imported targets, one per requested component:
+#   CSFML::graphics, CSFML::window, CSFML::system, CSFML::audio, CSFML::network
+#
+# Result variables:
+#   CSFML_FOUND, CSFML_INCLUDE_DIR, CSFML_<COMPONENT>_LIBRARY
+
+set(CSFML_SEARCH_PATHS ${CSFML_ROOT} $ENV{CSFML_ROOT})
+
+find_path(CSFML_INCLUDE_DIR SFML/Config.h
+    HINTS ${CSFML_SEARCH_PATHS}
+    PATH_SUFFIXES include
+)
+
+if(CSFML_INCLUDE_DIR AND EXISTS ${CSFML_INCLUDE_DIR}/SFML/Config.h)
+    file(STRINGS ${CSFML_INCLUDE_DIR}/SFML/Config.h CSFML_CONFIG_LINES REGEX "#define CSFML_VERSION_(MAJOR|MINOR|PATCH) ")
+    foreach(CSFML_PART MAJOR MINOR PATCH)
+        string(REGEX MATCH "CSFML_VERSION_${CSFML_PART} ([0-9]+)" CSFML_MATCH "${CSFML_CONFIG_LINES}")
+        set(CSFML_VERSION_${CSFML_PART} "${CMAKE_MATCH_1}")
+    endforeach()
+    if(NOT "${CSFML_VERSION_MAJOR}" STREQUAL "")
+        set(CSFML_VERSION "${CSFML_VERSION_MAJOR}.${CSFML_VERSION_MINOR}.${CSFML_VERSION_PATCH}")
+    endif()
+endif()
+
+set(CSFML_LIBRARY_VARIABLES)
+foreach(CSFML_COMPONENT ${CSFML_FIND_COMPONENTS})
+    string(TOUPPER ${CSFML_COMPONENT} CSFML_COMPONENT_UPPER)
+    find_library(CSFML_${CSFML_COMPONENT_UPPER}_LIBRARY
+        NAMES csfml-${CSFML_COMPONENT}
+        HINTS ${CSFML_SEARCH_PATHS}
+        PATH_SUFFIXES lib lib64
+    )
+    if(CSFML_${CSFML_COMPONENT_UPPER}_LIBRARY)
+        set(CSFML_${CSFML_COMPONENT}_FOUND TRUE)
+    endif()
+    list(APPEND CSFML_LIBRARY_VARIABLES CSFML_${CSFML_COMPONENT_UPPER}_LIBRARY)
+endforeach()
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(CSFML
+    REQUIRED_VARS CSFML_INCLUDE_DIR ${CSFML_LIBRARY_VARIABLES}
+    VERSION_VAR CSFML_VERSION
+    HANDLE_COMPONENTS
+)
+
+if(CSFML_FOUND)
+    foreach(CSFML_COMPONENT ${CSFML_FIND_COMPONENTS})
+        string(TOUPPER ${CSFML_COMPONENT} CSFML_COMPONENT_UPPER)
+        if(NOT TARGET CSFML::${CSFML_COMPONENT})
+            add_library(CSFML::${CSFML_COMPONENT} UNKNOWN IMPORTED)
+            set_target_properties(CSFML::${CSFML_COMPONENT} PROPERTIES
+                IMPORTED_LOCATION ${CSFML_${CSFML_COMPONENT_UPPER}_LIBRARY}
+                INTERFACE_INCLUDE_DIRECTORIES ${CSFML_INCLUDE_DIR}
+            )
+        endif()
+    endforeach()
+endif()
+
+mark_as_advanced(CSFML_INCLUDE_DIR ${CSFML_LIBRARY_VARIABLES})
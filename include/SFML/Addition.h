@@ -28,8 +28,23 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <SFML/Addition/Allocator.h>
 #include <SFML/Addition/BezierCurve.h>
+#include <SFML/Addition/BezierIntersection.h>
+#include <SFML/Addition/CachedLayer.h>
 #include <SFML/Addition/Mouse.h>
+#include <SFML/Addition/MouseDispatcher.h>
+#include <SFML/Addition/Profiler.h>
 #include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/AnimatedSpritePool.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include <SFML/Addition/FrameStore.h>
+#include <SFML/Addition/HitMask.h>
+#include <SFML/Addition/HitTester.h>
+#include <SFML/Addition/Broadphase.h>
+#include <SFML/Addition/LevelOfDetail.h>
+#include <SFML/Addition/Rasterizer.h>
+#include <SFML/Addition/SnapshotBuffer.h>
+#include <SFML/Addition/Tessellator.h>
 
 #endif // SFML_ADDITION_H
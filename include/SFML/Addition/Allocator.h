@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_ALLOCATOR_H
+    #define SFML_ALLOCATOR_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <SFML/Config.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Memory callbacks used by every object of the library
+///
+/// The callbacks follow the semantics of malloc, realloc
+/// and free, and receive \a userData as last argument.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    void *(*allocate)(size_t size, void *userData);
+    void *(*reallocate)(void *pointer, size_t size, void *userData);
+    void (*deallocate)(void *pointer, void *userData);
+    void *userData;
+} sfAllocator;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of fixed-size blocks
+///
+/// Blocks are carved from chunks obtained from the allocator
+/// and recycled through a free list, the chunks are only
+/// released when the pool is destroyed. The pool can be used
+/// from several threads.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t blockSize;
+    size_t blocksPerChunk;
+    void *freeList;
+    void *chunks;
+    atomic_flag lock;
+} sfPool;
+
+////////////////////////////////////////////////////////////
+/// \brief Bump allocator for transient memory
+///
+/// Allocations only move an offset forward, everything is
+/// released at once by sfArena_reset, typically every frame.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfUint8 *memory;
+    size_t size;
+    size_t offset;
+    size_t peak;
+} sfArena;
+
+////////////////////////////////////////////////////////////
+/// \brief Static initializer of a pool
+///
+/// A blocksPerChunk of zero is taken as one block per chunk.
+///
+////////////////////////////////////////////////////////////
+#define SF_POOL_INIT(blockSize, blocksPerChunk) {(blockSize), (blocksPerChunk), NULL, NULL, ATOMIC_FLAG_INIT}
+
+////////////////////////////////////////////////////////////
+/// \brief Change the allocator used by the library
+///
+/// This function must be called before any object of the
+/// library is created, memory allocated with one allocator
+/// cannot be released by another.
+///
+/// \param allocator    New allocator, NULL to restore malloc, realloc and free
+///
+////////////////////////////////////////////////////////////
+void sfAllocator_set(const sfAllocator *allocator);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory with the allocator of the library
+///
+/// \param size Size of the memory block, in bytes
+///
+/// \return Pointer to the memory block, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+void *sfAllocator_malloc(size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate zeroed memory with the allocator of the library
+///
+/// \param count    Number of elements
+/// \param size     Size of an element, in bytes
+///
+/// \return Pointer to the memory block, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+void *sfAllocator_calloc(size_t count, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Resize memory with the allocator of the library
+///
+/// \param pointer  Memory block to resize, can be NULL
+/// \param size     New size of the memory block, in bytes
+///
+/// \return Pointer to the memory block, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+void *sfAllocator_realloc(void *pointer, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Release memory with the allocator of the library
+///
+/// \param pointer  Memory block to release, can be NULL
+///
+////////////////////////////////////////////////////////////
+void sfAllocator_free(void *pointer);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the arena used for transient memory by the calling thread
+///
+/// The library takes its scratch memory, such as the vertices
+/// of a curve being drawn, from this arena instead of the heap.
+/// The arena must be reset regularly by the caller, usually once
+/// per frame, and stays owned by the caller.
+///
+/// \param arena    Arena to use, NULL to go back to the heap
+///
+////////////////////////////////////////////////////////////
+void sfAllocator_setFrameArena(sfArena *arena);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the arena used for transient memory by the calling thread
+///
+/// \return The arena, or NULL if none is set
+///
+////////////////////////////////////////////////////////////
+sfArena *sfAllocator_getFrameArena(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Get transient memory for the calling thread
+///
+/// The memory is taken from the frame arena of the thread
+/// when there is one with enough room left, from the heap
+/// otherwise. It must be given back with sfAllocator_releaseScratch,
+/// in the reverse order of the calls to this function.
+///
+/// \param size Size of the memory block, in bytes
+/// \param mark Receives the value to give to sfAllocator_releaseScratch
+///
+/// \return Pointer to the memory block, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+void *sfAllocator_getScratch(size_t size, size_t *mark);
+
+////////////////////////////////////////////////////////////
+/// \brief Give back transient memory
+///
+/// \param pointer  Memory returned by sfAllocator_getScratch
+/// \param mark     Mark returned by sfAllocator_getScratch
+///
+////////////////////////////////////////////////////////////
+void sfAllocator_releaseScratch(void *pointer, size_t mark);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate a block from a pool
+///
+/// \param pool Pool object
+///
+/// \return Pointer to the block, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+void *sfPool_allocate(sfPool *pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Give a block back to its pool
+///
+/// \param pool     Pool object
+/// \param block    Block to give back, can be NULL
+///
+////////////////////////////////////////////////////////////
+void sfPool_free(sfPool *pool, void *block);
+
+////////////////////////////////////////////////////////////
+/// \brief Make sure a pool holds a number of free blocks
+///
+/// \param pool     Pool object
+/// \param count    Number of free blocks wanted
+///
+/// \return sfTrue if the blocks are available, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfPool_reserve(sfPool *pool, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Release every chunk of a pool
+///
+/// Every block of the pool must have been given back.
+///
+/// \param pool Pool object
+///
+////////////////////////////////////////////////////////////
+void sfPool_clear(sfPool *pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new arena
+///
+/// \param size Capacity of the arena, in bytes
+///
+/// \return A new sfArena object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfArena *sfArena_create(size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing arena
+///
+/// \param arena    Arena to destroy
+///
+////////////////////////////////////////////////////////////
+void sfArena_destroy(sfArena *arena);
+
+////////////////////////////////////////////////////////////
+/// \brief Allocate memory from an arena
+///
+/// The memory is aligned for any type.
+///
+/// \param arena    Arena object
+/// \param size     Size of the memory block, in bytes
+///
+/// \return Pointer to the memory block, or NULL if the arena is full
+///
+////////////////////////////////////////////////////////////
+void *sfArena_allocate(sfArena *arena, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Release every allocation of an arena
+///
+/// \param arena    Arena object
+///
+////////////////////////////////////////////////////////////
+void sfArena_reset(sfArena *arena);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the current offset of an arena
+///
+/// \param arena    Arena object
+///
+/// \return Offset to give to sfArena_rewind
+///
+////////////////////////////////////////////////////////////
+size_t sfArena_getOffset(const sfArena *arena);
+
+////////////////////////////////////////////////////////////
+/// \brief Release the allocations made after an offset
+///
+/// \param arena    Arena object
+/// \param offset   Offset returned by sfArena_getOffset
+///
+////////////////////////////////////////////////////////////
+void sfArena_rewind(sfArena *arena, size_t offset);
+
+#endif // SFML_ALLOCATOR_H
@@ -31,6 +31,8 @@
 #include <stdlib.h>
 #include <SFML/Graphics.h>
 #include <SFML/System/Clock.h>
+#include <SFML/Addition/HitMask.h>
+#include <SFML/Addition/SpriteSheet.h>
 
 ////////////////////////////////////////////////////////////
 /// \brief Utility class for manipulating animated sprites
@@ -46,6 +48,18 @@ typedef struct
     sfVector2u frameSize;
     sfVector2u gridSize;
     size_t frameRate;
+    sfUint32 frameRateDenominator;
+    sfInt64 elapsed;
+    sfInt64 fixedStep;
+    sfInt64 *frameEnds;
+    size_t frameEndCount;
+    const sfSpriteSheetFrame *sheetFrames;
+    size_t sheetFrameCount;
+    sfHitMask *hitMask;
+    sfTexture **lodTextures;
+    size_t lodCount;
+    size_t lodTick;
+    size_t lodSkipped;
 } sfAnimatedSprite;
 
 ////////////////////////////////////////////////////////////
@@ -62,6 +76,20 @@ typedef struct
     sfIntRect *area;
 } sfAnimation;
 
+////////////////////////////////////////////////////////////
+/// \brief Reserve room for animated sprites in the handle pool
+///
+/// Animated sprites are allocated from a pool of fixed-size
+/// blocks, reserving them up front avoids any allocation of
+/// handles when they are spawned later.
+///
+/// \param count    Number of animated sprites to reserve room for
+///
+/// \return sfTrue if the room was reserved, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_reserve(size_t count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Create a new animated sprite
 ///
@@ -300,7 +328,9 @@ sfColor sfAnimatedSprite_getColor(const sfAnimatedSprite *animatedSprite);
 /// that it ignores the transformations (translation, rotation,
 /// scale, ...) that are applied to the entity.
 /// In other words, this function returns the bounds of the
-/// entity in the entity's coordinate system.
+/// entity in the entity's coordinate system. It encloses the
+/// quad of sfAnimatedSprite_getVertices, so frames of a sprite
+/// sheet are moved by their trim offset.
 ///
 /// \param animatedSprite   Animated sprite object
 ///
@@ -317,6 +347,8 @@ sfFloatRect sfAnimatedSprite_getLocalBounds(const sfAnimatedSprite *animatedSpri
 /// rotation, scale, ...) that are applied to the entity.
 /// In other words, this function returns the bounds of the
 /// animated sprite in the global 2D world's coodinate system.
+/// It encloses the quad of sfAnimatedSprite_getVertices once
+/// transformed.
 ///
 /// \param animatedSprite   Animated sprite object
 ///
@@ -344,6 +376,147 @@ void sfAnimatedSprite_setFrameRate(sfAnimatedSprite *animatedSprite, size_t fram
 ////////////////////////////////////////////////////////////
 size_t sfAnimatedSprite_getFrameRate(const sfAnimatedSprite *animatedSprite);
 
+////////////////////////////////////////////////////////////
+/// \brief Set a fractional frame rate of an animated sprite
+///
+/// The rate is numerator / denominator frames per second,
+/// kept as an exact ratio: 30000 / 1001 plays at 29.97 fps
+/// without drifting. The product of both terms must stay
+/// under 2^43.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param numerator        Number of frames
+/// \param denominator      Number of seconds they last
+///
+/// \return sfTrue if the rate was set, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setFrameRateRatio(sfAnimatedSprite *animatedSprite, sfUint32 numerator, sfUint32 denominator);
+
+////////////////////////////////////////////////////////////
+/// \brief Give each frame of an animated sprite its own duration
+///
+/// The durations replace the frame rate and the max frame:
+/// the animation loops over count frames. The durations are
+/// copied. Pass NULL to go back to the frame rate.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param durations        Duration of each frame, or NULL
+/// \param count            Number of frames
+///
+/// \return sfTrue if the durations were set, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setFrameDurations(sfAnimatedSprite *animatedSprite, const sfTime *durations, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Play the frames of a packed sprite sheet
+///
+/// The frames of the tag, or all of them, replace the grid:
+/// each frame uses its own area of the texture, and its own
+/// duration when the sheet has some. Trimmed and rotated
+/// frames are put back in place by
+/// sfRenderWindow_drawAnimatedSprite. The sheet is not copied
+/// and must outlive the animated sprite. Pass NULL to go back
+/// to the grid.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param spriteSheet      Sprite sheet to play, or NULL
+/// \param tag              Name of the tag to play (NULL to play every frame)
+///
+/// \return sfTrue if the frames were set, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setSpriteSheet(sfAnimatedSprite *animatedSprite, const sfSpriteSheet *spriteSheet, const char *tag);
+
+////////////////////////////////////////////////////////////
+/// \brief Set the number of frames of an animated sprite
+///
+/// \param animatedSprite   Animated sprite object
+/// \param maxFrame         Number of frames of the animation
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_setMaxFrame(sfAnimatedSprite *animatedSprite, size_t maxFrame);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of frames of an animated sprite
+///
+/// \param animatedSprite   Animated sprite object
+///
+/// \return Number of frames of the animation
+///
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSprite_getMaxFrame(const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Play an animated sprite with a fixed time step
+///
+/// With a step, each sfAnimatedSprite_update advances the
+/// animation by exactly that time instead of reading the
+/// clock, so the frame shown after n updates is always
+/// sfAnimatedSprite_getFrameAt(sprite, n * step), whatever
+/// the rendering frame rate.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param step             Time of one update, or zero to follow the clock
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_setFixedStep(sfAnimatedSprite *animatedSprite, sfTime step);
+
+////////////////////////////////////////////////////////////
+/// \brief Advance the animation of an animated sprite by a duration
+///
+/// \param animatedSprite   Animated sprite object
+/// \param elapsed          Time to advance by
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_advance(sfAnimatedSprite *animatedSprite, sfTime elapsed);
+
+////////////////////////////////////////////////////////////
+/// \brief Move the animation of an animated sprite to a time
+///
+/// The time is counted from the first frame of the animation,
+/// the frame is computed directly so seeking costs the same
+/// for any time.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param time             Time since the start of the animation
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_seek(sfAnimatedSprite *animatedSprite, sfTime time);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the time of the animation of an animated sprite
+///
+/// With frame durations, from a sprite sheet, the time wraps
+/// around at the end of every loop. With a frame rate of
+/// numerator / denominator frames per second, a loop does not
+/// always last a whole number of microseconds, so the time
+/// wraps around every numerator loops instead, after exactly
+/// maxFrame * denominator seconds. The frame shown is the
+/// same either way.
+///
+/// \param animatedSprite   Animated sprite object
+///
+/// \return Time since the start of the current wrap period
+///
+////////////////////////////////////////////////////////////
+sfTime sfAnimatedSprite_getElapsedTime(const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the frame an animated sprite shows at a time
+///
+/// The result only depends on the time and on the timing of
+/// the animation, never on the previous updates.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param time             Time since the start of the animation
+///
+/// \return Index of the frame
+///
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSprite_getFrameAt(const sfAnimatedSprite *animatedSprite, sfTime time);
+
 ////////////////////////////////////////////////////////////
 /// \brief Set the frame size of an animated sprite
 ///
@@ -388,6 +561,156 @@ void sfAnimatedSprite_setGridSize(sfAnimatedSprite *animatedSprite, sfVector2u s
 ////////////////////////////////////////////////////////////
 sfVector2u sfAnimatedSprite_getGridSize(const sfAnimatedSprite *animatedSprite);
 
+////////////////////////////////////////////////////////////
+/// \brief Build reduced-resolution sprite sheets of an animated sprite
+///
+/// Each level halves the resolution of the previous one with
+/// a box filter, like a mipmap, but per sheet so frames never
+/// bleed into each other. The frame size should be divisible
+/// by 2 to the power of levelCount. Any previous sheet is
+/// destroyed.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param levelCount       Number of reduced levels to build
+///
+/// \return sfTrue if the sheets were built, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_createLodTextures(sfAnimatedSprite *animatedSprite, size_t levelCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the sprite sheet of an animated sprite at a level of detail
+///
+/// \param animatedSprite   Animated sprite object
+/// \param level            Level of detail, 0 being the full resolution
+///
+/// \return The sprite sheet of the closest level that exists
+///
+////////////////////////////////////////////////////////////
+const sfTexture *sfAnimatedSprite_getLodTexture(const sfAnimatedSprite *animatedSprite, size_t level);
+
+////////////////////////////////////////////////////////////
+/// \brief Build the hit mask of an animated sprite
+///
+/// The mask is built once from the whole texture of the
+/// animated sprite, so it covers every frame of the animation.
+/// Any previous mask is destroyed.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param alphaThreshold   Alpha value under which a pixel is ignored
+///
+/// \return sfTrue if the mask was built, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_createHitMask(sfAnimatedSprite *animatedSprite, sfUint8 alphaThreshold);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the hit mask of an animated sprite
+///
+/// \param animatedSprite   Animated sprite object
+///
+/// \return The hit mask, or NULL if none was built
+///
+////////////////////////////////////////////////////////////
+const sfHitMask *sfAnimatedSprite_getHitMask(const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if two animated sprites overlap using their hit masks
+///
+/// The current frame of both animated sprites is used.
+///
+/// \param animatedSpriteA  First animated sprite object
+/// \param animatedSpriteB  Second animated sprite object
+///
+/// \return sfTrue if at least one solid pixel overlaps
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isPixelCollision(const sfAnimatedSprite *animatedSpriteA, const sfAnimatedSprite *animatedSpriteB);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if a point hits a solid pixel of an animated sprite
+///
+/// The current frame is tested through its area, see
+/// sfAnimatedSprite_getFrameArea, so trimmed and rotated
+/// frames of a sprite sheet are hit where they are drawn.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param point            Point to test, in global coordinates
+///
+/// \return sfTrue if the point hits a solid pixel, sfFalse if it does not or there is no hit mask
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isPixelHit(const sfAnimatedSprite *animatedSprite, sfVector2f point);
+
+////////////////////////////////////////////////////////////
+/// \brief Advance the animation of an animated sprite
+///
+/// The animation is advanced by the time since the last update,
+/// or by the fixed step if one is set, and the texture rect of
+/// the sprite is updated. This is the
+/// CPU part of sfRenderWindow_drawAnimatedSprite, it needs no window.
+///
+/// \param animatedSprite   Animated sprite object
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_update(sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the quad of the current frame of an animated sprite
+///
+/// The vertices are in local coordinates, sfAnimatedSprite_getTransform
+/// places them in the scene. Frames of a sprite sheet are
+/// moved by their trim offset and turned back when rotated.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param vertices         Receives the 4 vertices of the quad
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_getVertices(const sfAnimatedSprite *animatedSprite, sfVertex vertices[4]);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the texture area shown by the current frame of an animated sprite
+///
+/// The area is the rectangle of the frame as stored in the
+/// texture, so a rotated frame of a sprite sheet is still
+/// turned. \a transform receives the transform placing the
+/// area, from (0, 0) to its size, in the scene: the transform
+/// of the animated sprite, the trim offset of the frame and
+/// the rotation turning it back. The hit mask is tested
+/// against this area.
+///
+/// \param animatedSprite   Animated sprite object
+/// \param transform        Receives the transform of the area (can be NULL)
+///
+/// \return Area of the texture shown by the current frame
+///
+////////////////////////////////////////////////////////////
+sfIntRect sfAnimatedSprite_getFrameArea(const sfAnimatedSprite *animatedSprite, sfTransform *transform);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw the current frame of an animated sprite to the render-target
+///
+/// The animation is not advanced. Frames of a sprite sheet are
+/// drawn as the quad of sfAnimatedSprite_getVertices, other
+/// frames as the underlying sprite.
+///
+/// \param renderWindow     render window object
+/// \param animatedSprite   Object to draw
+/// \param states           Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpriteFrame(sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, const sfRenderStates *states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw the current frame of an animated sprite to the render-texture
+///
+/// \param renderTexture    render texture object
+/// \param animatedSprite   Object to draw
+/// \param states           Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawAnimatedSpriteFrame(sfRenderTexture *renderTexture, const sfAnimatedSprite *animatedSprite, const sfRenderStates *states);
+
 ////////////////////////////////////////////////////////////
 /// \brief Draw a drawable object to the render-target
 ///
@@ -396,6 +719,6 @@ sfVector2u sfAnimatedSprite_getGridSize(const sfAnimatedSprite *animatedSprite);
 /// \param states           Render states to use for drawing (NULL to use the default states)
 ///
 ////////////////////////////////////////////////////////////
-void sfRenderWindow_drawAnimatedSprite(const sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfRenderStates *states);
+void sfRenderWindow_drawAnimatedSprite(sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfRenderStates *states);
 
 #endif // SFML_ANIMATEDSPRITE_H
@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_ANIMATEDSPRITEPOOL_H
+    #define SFML_ANIMATEDSPRITEPOOL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Handle of an animated sprite of a pool
+///
+/// The low 32 bits are the index of the slot, the high 32
+/// bits its generation, which changes every time the slot is
+/// spawned or despawned so stale handles are detected. Live
+/// slots have odd generations, so a handle naming a free slot
+/// is never valid.
+///
+////////////////////////////////////////////////////////////
+typedef sfUint64 sfAnimatedSpriteHandle;
+
+////////////////////////////////////////////////////////////
+/// \brief Handle that never refers to an animated sprite
+///
+////////////////////////////////////////////////////////////
+#define SF_ANIMATEDSPRITEHANDLE_INVALID ((sfAnimatedSpriteHandle)0)
+
+////////////////////////////////////////////////////////////
+/// \brief Animated sprite living in a pool
+///
+/// Unlike sfAnimatedSprite it owns no CSFML object, the
+/// texture, frame size and grid are shared by the pool.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfVector2f position;
+    sfVector2f origin;
+    sfVector2f scale;
+    float rotation;
+    sfColor color;
+    size_t currentFrame;
+    size_t maxFrame;
+    size_t frameRate;
+    sfInt64 elapsed;            ///< Progress to the next frame, elapsed microseconds times frameRate, a frame every 1000000
+} sfAnimatedSpriteInstance;
+
+////////////////////////////////////////////////////////////
+/// \brief Slot of an animated sprite pool
+///
+/// A live slot stores the index of its instance in the dense
+/// array, a free slot the index of the next free slot.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfUint32 generation;
+    sfUint32 index;
+} sfAnimatedSpriteSlot;
+
+////////////////////////////////////////////////////////////
+/// \brief Pool of animated sprites sharing a sprite sheet
+///
+/// The live instances are packed at the start of the instances
+/// array, so they are updated and drawn in one dense loop and
+/// one draw call. Spawning and despawning are O(1) and do not
+/// allocate until the capacity is exceeded.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfAnimatedSpriteInstance *instances;
+    sfUint32 *owners;
+    sfAnimatedSpriteSlot *slots;
+    sfVertex *vertices;
+    size_t count;
+    size_t capacity;
+    sfUint32 freeSlot;
+    const sfTexture *texture;
+    sfVector2u frameSize;
+    sfVector2u gridSize;
+    size_t frameRate;
+    sfClock *clock;
+} sfAnimatedSpritePool;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new animated sprite pool
+///
+/// \param capacity     Number of animated sprites to preallocate
+/// \param texture      Sprite sheet shared by the animated sprites (not owned)
+/// \param frameSize    Size of a frame of the sprite sheet
+/// \param gridSize     Number of frames per row and column of the sprite sheet
+/// \param frameRate    Frame rate given to the spawned animated sprites
+///
+/// \return A new sfAnimatedSpritePool object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfAnimatedSpritePool *sfAnimatedSpritePool_create(size_t capacity, const sfTexture *texture, sfVector2u frameSize, sfVector2u gridSize, size_t frameRate);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing animated sprite pool
+///
+/// \param pool Animated sprite pool to destroy
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_destroy(sfAnimatedSpritePool *pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Grow the storage of an animated sprite pool
+///
+/// \param pool     Animated sprite pool object
+/// \param capacity Number of animated sprites to make room for
+///
+/// \return sfTrue if the room was made, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_reserve(sfAnimatedSpritePool *pool, size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Spawn an animated sprite in a pool
+///
+/// The animated sprite starts on the first frame, with a
+/// scale of 1, a white color and the frame rate of the pool.
+///
+/// \param pool     Animated sprite pool object
+/// \param position Position of the animated sprite
+///
+/// \return Handle of the animated sprite, or SF_ANIMATEDSPRITEHANDLE_INVALID if it failed
+///
+////////////////////////////////////////////////////////////
+sfAnimatedSpriteHandle sfAnimatedSpritePool_spawn(sfAnimatedSpritePool *pool, sfVector2f position);
+
+////////////////////////////////////////////////////////////
+/// \brief Despawn an animated sprite of a pool
+///
+/// The last live instance is moved in place of the removed
+/// one, pointers returned by sfAnimatedSpritePool_get are
+/// invalidated.
+///
+/// \param pool     Animated sprite pool object
+/// \param handle   Handle of the animated sprite
+///
+/// \return sfTrue if the animated sprite was despawned, sfFalse if the handle is stale
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_despawn(sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if a handle refers to a live animated sprite
+///
+/// \param pool     Animated sprite pool object
+/// \param handle   Handle to check
+///
+/// \return sfTrue if the animated sprite is alive, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_isAlive(const sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle);
+
+////////////////////////////////////////////////////////////
+/// \brief Get an animated sprite of a pool
+///
+/// The pointer stays valid until the next spawn or despawn.
+///
+/// \param pool     Animated sprite pool object
+/// \param handle   Handle of the animated sprite
+///
+/// \return The animated sprite, or NULL if the handle is stale
+///
+////////////////////////////////////////////////////////////
+sfAnimatedSpriteInstance *sfAnimatedSpritePool_get(sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the number of live animated sprites of a pool
+///
+/// \param pool Animated sprite pool object
+///
+/// \return Number of live animated sprites
+///
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSpritePool_getCount(const sfAnimatedSpritePool *pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Advance the animations of a pool by a given time
+///
+/// \param pool     Animated sprite pool object
+/// \param elapsed  Time to advance the animations by
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_advance(sfAnimatedSpritePool *pool, sfTime elapsed);
+
+////////////////////////////////////////////////////////////
+/// \brief Advance the animations of a pool by the time elapsed since the last update
+///
+/// \param pool Animated sprite pool object
+///
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_update(sfAnimatedSpritePool *pool);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw every live animated sprite of a pool
+///
+/// The animated sprites are batched in a single draw call
+/// using the sprite sheet of the pool. The animations are not
+/// advanced, see sfAnimatedSpritePool_update.
+///
+/// \param renderWindow render window object
+/// \param pool         Animated sprite pool to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpritePool(sfRenderWindow *renderWindow, sfAnimatedSpritePool *pool, const sfRenderStates *states);
+
+#endif // SFML_ANIMATEDSPRITEPOOL_H
@@ -32,7 +32,17 @@
 #include <stdlib.h>
 
 ////////////////////////////////////////////////////////////
-/// \brief
+/// \brief Number of points sampled to draw a bezier curve
+///
+////////////////////////////////////////////////////////////
+#define SF_BEZIERCURVE_SAMPLE_COUNT 10000
+
+////////////////////////////////////////////////////////////
+/// \brief Bezier curve of any degree
+///
+/// bounds caches sfBezierCurve_getBounds, it is kept up to date
+/// by sfBezierCurve_addPoint and sfBezierCurve_move. Call
+/// sfBezierCurve_updateBounds after changing points directly.
 ///
 ////////////////////////////////////////////////////////////
 typedef struct
@@ -40,8 +50,23 @@ typedef struct
     sfVector2f *points;
     size_t pointCount;
     sfColor color;
+    sfFloatRect bounds;
 } sfBezierCurve;
 
+////////////////////////////////////////////////////////////
+/// \brief Reserve room for bezier curves in the handle pool
+///
+/// Bezier curves are allocated from a pool of fixed-size
+/// blocks, reserving them up front avoids any allocation of
+/// handles when they are created later.
+///
+/// \param count    Number of bezier curves to reserve room for
+///
+/// \return sfTrue if the room was reserved, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfBezierCurve_reserve(size_t count);
+
 ////////////////////////////////////////////////////////////
 /// \brief Construct a new bezier curve
 ///
@@ -79,21 +104,105 @@ void sfBezierCurve_addPoint(sfBezierCurve *bezierCurve, sfVector2f point);
 ////////////////////////////////////////////////////////////
 /// \brief Calculate current point based with time in percent from 0 to 1
 ///
+/// Linear, quadratic, cubic and quartic curves use unrolled
+/// kernels picked from the number of points, higher degrees
+/// use sfBezierCurve_calculatePointGeneric. The kernels do
+/// the same steps as the generic path, in the same order.
+///
 /// \param bezierCurve  Bezier curve object
 /// \param time         Time from 0 to 1 for point offset
 ///
 ////////////////////////////////////////////////////////////
 sfVector2f sfBezierCurve_calculatePoint(const sfBezierCurve *bezierCurve, float time);
 
+////////////////////////////////////////////////////////////
+/// \brief Calculate a point of a curve of any degree
+///
+/// De Casteljau's algorithm over all the points of the curve,
+/// the path of sfBezierCurve_calculatePoint for the degrees
+/// without a kernel.
+///
+/// \param bezierCurve  Bezier curve object
+/// \param time         Time from 0 to 1 for point offset
+///
+////////////////////////////////////////////////////////////
+sfVector2f sfBezierCurve_calculatePointGeneric(const sfBezierCurve *bezierCurve, float time);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the bounding rectangle of a bezier curve
+///
+/// The rectangle is exact for quadratic and cubic curves,
+/// from their ends and the extrema of each axis. For other
+/// degrees it encloses the control points, the curve always
+/// lies inside of it.
+///
+/// \param bezierCurve  Bezier curve object
+///
+/// \return Bounding rectangle of the bezier curve
+///
+////////////////////////////////////////////////////////////
+sfFloatRect sfBezierCurve_getBounds(const sfBezierCurve *bezierCurve);
+
+////////////////////////////////////////////////////////////
+/// \brief Refresh the cached bounds of a bezier curve
+///
+/// \param bezierCurve  Bezier curve object
+///
+////////////////////////////////////////////////////////////
+void sfBezierCurve_updateBounds(sfBezierCurve *bezierCurve);
+
+////////////////////////////////////////////////////////////
+/// \brief Sample the points of a curve into a vertex array
+///
+/// The points are evaluated at the times i / sampleCount for
+/// i going from 0 to sampleCount - 1, and appended to the
+/// vertex array with the color of the curve. This is the CPU
+/// part of sfRenderWindow_drawBezierCurve, it needs no window.
+///
+/// \param bezierCurve  Bezier curve object
+/// \param vertexArray  Vertex array receiving the points
+/// \param sampleCount  Number of points to sample
+///
+////////////////////////////////////////////////////////////
+void sfBezierCurve_tessellate(const sfBezierCurve *bezierCurve, sfVertexArray *vertexArray, size_t sampleCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Sample the points of a curve into a vertex buffer
+///
+/// Same as sfBezierCurve_tessellate, but the vertices are
+/// written to a buffer of at least \a sampleCount vertices
+/// provided by the caller, so no memory is allocated.
+///
+/// \param bezierCurve  Bezier curve object
+/// \param vertices     Buffer receiving the points
+/// \param sampleCount  Number of points to sample
+///
+////////////////////////////////////////////////////////////
+void sfBezierCurve_sample(const sfBezierCurve *bezierCurve, sfVertex *vertices, size_t sampleCount);
+
 ////////////////////////////////////////////////////////////
 /// \brief Draw a drawable object to the render-target
 ///
+/// The vertices are taken from the frame arena of the calling
+/// thread when one is set (see sfAllocator_setFrameArena), so
+/// drawing a curve does not touch the heap in steady state.
+///
 /// \param renderWindow render window object
 /// \param bezierCurve  Object to draw
 /// \param states       Render states to use for drawing (NULL to use the default states)
 ///
 ////////////////////////////////////////////////////////////
-void sfRenderWindow_drawBezierCurve(const sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, const sfRenderStates *states);
+void sfRenderWindow_drawBezierCurve(sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, const sfRenderStates *states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a drawable object to a render texture
+///
+/// \param renderTexture    render texture object
+/// \param bezierCurve      Object to draw
+/// \param states           Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawBezierCurve(sfRenderTexture *renderTexture, const sfBezierCurve *bezierCurve, const sfRenderStates *states);
 
 ////////////////////////////////////////////////////////////
 /// \brief Move a bezier curve by a given offset
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_BEZIERINTERSECTION_H
+    #define SFML_BEZIERINTERSECTION_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Largest number of points of the curves that can be intersected
+///
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTION_MAX_POINTS 16
+
+////////////////////////////////////////////////////////////
+/// \brief Point where two curves, or a curve and a line, cross
+///
+/// timeA is the time of the point on the first curve, timeB
+/// its time on the second curve or on the line, both from 0
+/// to 1.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float timeA;
+    float timeB;
+    sfVector2f point;
+} sfBezierIntersection;
+
+////////////////////////////////////////////////////////////
+/// \brief Find the points where two bezier curves cross
+///
+/// Both curves are split in halves until the pieces are flat
+/// within the tolerance, skipping the pairs of pieces whose
+/// boxes or sides do not meet, then the flat pieces are
+/// crossed as segments. The cached bounds of the curves reject
+/// most pairs of curves before any split. Crossings closer
+/// than the tolerance are reported once; curves that overlap
+/// along a stretch give crossings spread along it, up to
+/// maxCount.
+///
+/// \param bezierCurveA     First bezier curve
+/// \param bezierCurveB     Second bezier curve
+/// \param tolerance        Distance under which a piece of curve is flat
+/// \param intersections    Receives the crossings, by increasing timeA
+/// \param maxCount         Number of crossings the array can hold
+///
+/// \return The number of crossings found
+///
+////////////////////////////////////////////////////////////
+size_t sfBezierCurve_intersectCurve(const sfBezierCurve *bezierCurveA, const sfBezierCurve *bezierCurveB, float tolerance, sfBezierIntersection *intersections, size_t maxCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Find the points where a bezier curve crosses a segment
+///
+/// \param bezierCurve      Bezier curve object
+/// \param start            Start of the segment
+/// \param end              End of the segment
+/// \param tolerance        Distance under which a piece of curve is flat
+/// \param intersections    Receives the crossings, by increasing timeA
+/// \param maxCount         Number of crossings the array can hold
+///
+/// \return The number of crossings found
+///
+////////////////////////////////////////////////////////////
+size_t sfBezierCurve_intersectLine(const sfBezierCurve *bezierCurve, sfVector2f start, sfVector2f end, float tolerance, sfBezierIntersection *intersections, size_t maxCount);
+
+#endif // SFML_BEZIERINTERSECTION_H
@@ -0,0 +1,218 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_BROADPHASE_H
+    #define SFML_BROADPHASE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Sprite tracked by a broadphase
+///
+/// corners is the oriented box of the sprite in the scene, as
+/// of the last update. Removed proxies are chained by next.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const sfSprite *sprite;
+    const sfAnimatedSprite *animatedSprite;
+    void *userData;
+    sfVector2f corners[4];
+    size_t entry;
+    size_t next;
+} sfBroadphaseProxy;
+
+////////////////////////////////////////////////////////////
+/// \brief Bounding box of a proxy in the sorted list of a broadphase
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float left;
+    float right;
+    float top;
+    float bottom;
+    size_t proxy;
+} sfBroadphaseEntry;
+
+////////////////////////////////////////////////////////////
+/// \brief Pair of overlapping proxies, first < second
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t first;
+    size_t second;
+} sfBroadphasePair;
+
+////////////////////////////////////////////////////////////
+/// \brief Overlapping pairs among many sprites
+///
+/// The bounding boxes of the sprites are kept sorted by their
+/// left side. Sprites move little from one frame to the next,
+/// so the list is almost sorted at each update and sorting it
+/// again takes a linear time. The overlapping pairs are then
+/// found in a single sweep over the list.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBroadphaseProxy *proxies;
+    size_t proxyCount;
+    size_t proxyCapacity;
+    size_t freeProxy;
+    sfBroadphaseEntry *entries;
+    size_t entryCount;
+    size_t entryCapacity;
+    sfBroadphasePair *pairs;
+    size_t pairCount;
+    size_t pairCapacity;
+    sfBool narrowPhase;
+} sfBroadphase;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new broadphase
+///
+/// \param capacity Number of sprites to reserve room for
+///
+/// \return A new sfBroadphase object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfBroadphase *sfBroadphase_create(size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing broadphase
+///
+/// \param broadphase   Broadphase to destroy
+///
+////////////////////////////////////////////////////////////
+void sfBroadphase_destroy(sfBroadphase *broadphase);
+
+////////////////////////////////////////////////////////////
+/// \brief Track a sprite in a broadphase
+///
+/// The sprite must outlive the broadphase or be removed first.
+///
+/// \param broadphase   Broadphase object
+/// \param sprite       Sprite to track
+/// \param userData     Pointer kept with the sprite
+///
+/// \return Identifier of the proxy of the sprite, or -1 if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_addSprite(sfBroadphase *broadphase, const sfSprite *sprite, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Track an animated sprite in a broadphase
+///
+/// The bounds follow the current frame of the animation, trim
+/// offsets of sprite sheets included.
+///
+/// \param broadphase       Broadphase object
+/// \param animatedSprite   Animated sprite to track
+/// \param userData         Pointer kept with the animated sprite
+///
+/// \return Identifier of the proxy of the animated sprite, or -1 if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_addAnimatedSprite(sfBroadphase *broadphase, const sfAnimatedSprite *animatedSprite, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Stop tracking a sprite
+///
+/// The identifier can be given to another sprite afterwards.
+///
+/// \param broadphase   Broadphase object
+/// \param proxy        Identifier returned when the sprite was added
+///
+////////////////////////////////////////////////////////////
+void sfBroadphase_remove(sfBroadphase *broadphase, size_t proxy);
+
+////////////////////////////////////////////////////////////
+/// \brief Enable or disable the narrow phase
+///
+/// When enabled, pairs whose bounding boxes overlap but whose
+/// oriented boxes do not are left out. Disabled by default.
+///
+/// \param broadphase   Broadphase object
+/// \param enabled      sfTrue to test the oriented boxes
+///
+////////////////////////////////////////////////////////////
+void sfBroadphase_setNarrowPhase(sfBroadphase *broadphase, sfBool enabled);
+
+////////////////////////////////////////////////////////////
+/// \brief Read the bounds of every sprite and find the overlapping pairs
+///
+/// Call it once per frame, after the sprites moved and were
+/// animated.
+///
+/// \param broadphase   Broadphase object
+///
+/// \return The number of overlapping pairs
+///
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_update(sfBroadphase *broadphase);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the pairs found by the last update
+///
+/// \param broadphase   Broadphase object
+/// \param count        Receives the number of pairs
+///
+/// \return The pairs, valid until the next update
+///
+////////////////////////////////////////////////////////////
+const sfBroadphasePair *sfBroadphase_getPairs(const sfBroadphase *broadphase, size_t *count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the pointer kept with a sprite
+///
+/// \param broadphase   Broadphase object
+/// \param proxy        Identifier of the proxy of the sprite
+///
+/// \return The pointer given when the sprite was added
+///
+////////////////////////////////////////////////////////////
+void *sfBroadphase_getUserData(const sfBroadphase *broadphase, size_t proxy);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if two oriented boxes overlap
+///
+/// Each box is given by its 4 corners, in order around the box.
+///
+/// \param cornersA First box
+/// \param cornersB Second box
+///
+/// \return sfTrue if the boxes overlap, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfOrientedBox_intersects(const sfVector2f cornersA[4], const sfVector2f cornersB[4]);
+
+#endif // SFML_BROADPHASE_H
@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_CACHEDLAYER_H
+    #define SFML_CACHEDLAYER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Identifier returned when an item could not be added
+///
+////////////////////////////////////////////////////////////
+#define SF_CACHEDLAYER_NO_ITEM ((size_t)-1)
+
+////////////////////////////////////////////////////////////
+/// \brief Maximum number of dirty rectangles kept per frame
+///
+/// Past this number the dirty rectangles are merged into
+/// their bounding rectangle.
+///
+////////////////////////////////////////////////////////////
+#define SF_CACHEDLAYER_MAX_DIRTY_RECTS 16
+
+////////////////////////////////////////////////////////////
+/// \brief Object cached in a layer
+///
+/// Exactly one of bezierCurve and animatedSprite is set for
+/// a used item, none for a removed one. The other fields keep
+/// the state the item had when it was last rendered, the hash
+/// covers the control points of a curve or the transform of
+/// an animated sprite.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const sfBezierCurve *bezierCurve;
+    sfAnimatedSprite *animatedSprite;
+    sfFloatRect bounds;
+    sfIntRect textureRect;
+    const sfTexture *texture;
+    size_t pointCount;
+    sfColor color;
+    sfUint64 hash;
+} sfCachedLayerItem;
+
+////////////////////////////////////////////////////////////
+/// \brief Statistics of a cached layer
+///
+/// A cache hit is a frame where nothing had to be rendered
+/// again. The redraw fractions are the area rendered again
+/// divided by the area of the layer.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t frames;
+    size_t cacheHits;
+    size_t redrawnPixels;
+    float redrawFraction;
+    float averageRedrawFraction;
+} sfCachedLayerStats;
+
+////////////////////////////////////////////////////////////
+/// \brief Group of static objects rendered once into a texture
+///
+/// The curves and animated sprites of the layer are rendered
+/// into a render texture, which is then drawn as a single
+/// textured quad. Only the rectangles touched by an item that
+/// moved, changed or advanced its animation are rendered again.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfRenderTexture *renderTexture;
+    sfSprite *sprite;
+    sfView *view;
+    sfFloatRect area;
+    sfCachedLayerItem *items;
+    size_t itemCount;
+    size_t itemCapacity;
+    sfFloatRect dirtyRects[SF_CACHEDLAYER_MAX_DIRTY_RECTS];
+    size_t dirtyCount;
+    sfCachedLayerStats stats;
+} sfCachedLayer;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new cached layer
+///
+/// \param area Area of the scene covered by the layer
+///
+/// \return A new sfCachedLayer object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfCachedLayer *sfCachedLayer_create(sfFloatRect area);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing cached layer
+///
+/// The items of the layer are not destroyed.
+///
+/// \param layer    Cached layer to destroy
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_destroy(sfCachedLayer *layer);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a bezier curve to a cached layer
+///
+/// Changes of the color and of the control points of the
+/// curve are detected, even when its bounds stay the same.
+///
+/// \param layer        Cached layer object
+/// \param bezierCurve  Bezier curve to add
+///
+/// \return Identifier of the item, or SF_CACHEDLAYER_NO_ITEM if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfCachedLayer_addBezierCurve(sfCachedLayer *layer, const sfBezierCurve *bezierCurve);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an animated sprite to a cached layer
+///
+/// The animation of the animated sprite is advanced by the
+/// layer, it must not be drawn elsewhere. Changes of its
+/// frame, texture, color and transform are detected, call
+/// sfCachedLayer_invalidate when the pixels of its texture
+/// are updated.
+///
+/// \param layer            Cached layer object
+/// \param animatedSprite   Animated sprite to add
+///
+/// \return Identifier of the item, or SF_CACHEDLAYER_NO_ITEM if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfCachedLayer_addAnimatedSprite(sfCachedLayer *layer, sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove an item from a cached layer
+///
+/// \param layer    Cached layer object
+/// \param item     Identifier returned when the item was added
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_remove(sfCachedLayer *layer, size_t item);
+
+////////////////////////////////////////////////////////////
+/// \brief Render an item of a cached layer again on the next frame
+///
+/// \param layer    Cached layer object
+/// \param item     Identifier returned when the item was added
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_invalidate(sfCachedLayer *layer, size_t item);
+
+////////////////////////////////////////////////////////////
+/// \brief Render an area of a cached layer again on the next frame
+///
+/// \param layer    Cached layer object
+/// \param rect     Area to render again, in scene coordinates
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_invalidateRect(sfCachedLayer *layer, sfFloatRect rect);
+
+////////////////////////////////////////////////////////////
+/// \brief Advance the animations and detect the changes of the items
+///
+/// \param layer    Cached layer object
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_update(sfCachedLayer *layer);
+
+////////////////////////////////////////////////////////////
+/// \brief Render the dirty rectangles of a cached layer
+///
+/// \param layer    Cached layer object
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_render(sfCachedLayer *layer);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the statistics of a cached layer
+///
+/// \param layer    Cached layer object
+///
+/// \return Statistics since the creation or the last reset
+///
+////////////////////////////////////////////////////////////
+sfCachedLayerStats sfCachedLayer_getStats(const sfCachedLayer *layer);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the statistics of a cached layer
+///
+/// \param layer    Cached layer object
+///
+////////////////////////////////////////////////////////////
+void sfCachedLayer_resetStats(sfCachedLayer *layer);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a drawable object to the render-target
+///
+/// The layer is updated and its dirty rectangles rendered,
+/// then the cached texture is drawn as a single quad.
+///
+/// \param renderWindow render window object
+/// \param layer        Object to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawCachedLayer(sfRenderWindow *renderWindow, sfCachedLayer *layer, const sfRenderStates *states);
+
+#endif // SFML_CACHEDLAYER_H
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_FRAMESTORE_H
+    #define SFML_FRAMESTORE_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Way a frame is stored in a frame store
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfFrameRaw,         ///< Pixels stored as they are
+    sfFrameLz,          ///< Runs of pixels and copies of previous pixels
+    sfFramePalette      ///< Palette of up to 256 colors and packed indices
+} sfFrameEncoding;
+
+////////////////////////////////////////////////////////////
+/// \brief Compressed frame of a frame store
+///
+/// offset and size locate the frame in the data of the store.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t offset;
+    size_t size;
+    sfFrameEncoding encoding;
+} sfCompressedFrame;
+
+////////////////////////////////////////////////////////////
+/// \brief Decompressed frame kept in the cache of a frame store
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    size_t frame;
+    size_t lastUse;
+    sfUint8 *pixels;
+} sfFrameCacheSlot;
+
+////////////////////////////////////////////////////////////
+/// \brief Frames of an animation sheet kept compressed in memory
+///
+/// The sheet is cut in a grid of frames of frameSize pixels,
+/// read from left to right and from top to bottom. Each frame
+/// is compressed on its own, so that a single frame can be
+/// decompressed when it is needed. The last decompressed
+/// frames are kept in a small cache, the least recently used
+/// one being replaced first.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfVector2u frameSize;
+    sfVector2u gridSize;
+    sfCompressedFrame *frames;
+    size_t frameCount;
+    sfUint8 *data;
+    size_t dataSize;
+    sfFrameCacheSlot *cache;
+    size_t cacheSize;
+    size_t tick;
+    size_t hits;
+    size_t misses;
+} sfFrameStore;
+
+////////////////////////////////////////////////////////////
+/// \brief Compress the frames of an image
+///
+/// The image can be destroyed once the store is created.
+///
+/// \param image        Animation sheet to compress
+/// \param frameSize    Size of a frame, in pixels
+/// \param cacheSize    Number of decompressed frames kept in memory
+///
+/// \return A new frame store, or NULL if it could not be created
+///
+////////////////////////////////////////////////////////////
+sfFrameStore *sfFrameStore_createFromImage(const sfImage *image, sfVector2u frameSize, size_t cacheSize);
+
+////////////////////////////////////////////////////////////
+/// \brief Load an animation sheet from a file and compress its frames
+///
+/// \param filename     Path of the image file to load
+/// \param frameSize    Size of a frame, in pixels
+/// \param cacheSize    Number of decompressed frames kept in memory
+///
+/// \return A new frame store, or NULL if it could not be created
+///
+////////////////////////////////////////////////////////////
+sfFrameStore *sfFrameStore_createFromFile(const char *filename, sfVector2u frameSize, size_t cacheSize);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing frame store
+///
+/// \param frameStore   Frame store to delete
+///
+////////////////////////////////////////////////////////////
+void sfFrameStore_destroy(sfFrameStore *frameStore);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the pixels of a frame, decompressing it if needed
+///
+/// The pixels stay valid until the frame is evicted from the
+/// cache, that is until cacheSize other frames are requested.
+///
+/// \param frameStore   Frame store object
+/// \param frame        Index of the frame
+///
+/// \return The RGBA pixels of the frame, or NULL if there is no such frame
+///
+////////////////////////////////////////////////////////////
+const sfUint8 *sfFrameStore_getFrame(sfFrameStore *frameStore, size_t frame);
+
+////////////////////////////////////////////////////////////
+/// \brief Decompress a frame without going through the cache
+///
+/// The store is not modified, so several threads can
+/// decompress frames of the same store at once.
+///
+/// \param frameStore   Frame store object
+/// \param frame        Index of the frame
+/// \param pixels       Receives the frameSize.x * frameSize.y RGBA pixels
+///
+/// \return sfTrue if the frame was decompressed, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfFrameStore_decompressFrame(const sfFrameStore *frameStore, size_t frame, sfUint8 *pixels);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the area of a frame in the animation sheet
+///
+/// \param frameStore   Frame store object
+/// \param frame        Index of the frame
+///
+/// \return The area of the frame, in pixels
+///
+////////////////////////////////////////////////////////////
+sfIntRect sfFrameStore_getFrameRect(const sfFrameStore *frameStore, size_t frame);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a texture holding every frame of the store
+///
+/// The texture has the layout of the animation sheet, so it
+/// can be given to an animated sprite as is.
+///
+/// \param frameStore   Frame store object
+///
+/// \return A new texture, or NULL if it could not be created
+///
+////////////////////////////////////////////////////////////
+sfTexture *sfFrameStore_createTexture(const sfFrameStore *frameStore);
+
+////////////////////////////////////////////////////////////
+/// \brief Upload frames of the store to a texture
+///
+/// Used to rebuild a texture page after it was lost, a few
+/// frames at a time to stay within the budget of a frame.
+///
+/// \param frameStore   Frame store object
+/// \param texture      Texture with the layout of the animation sheet
+/// \param first        Index of the first frame to upload
+/// \param count        Number of frames to upload
+///
+/// \return The number of frames uploaded
+///
+////////////////////////////////////////////////////////////
+size_t sfFrameStore_updateTexture(const sfFrameStore *frameStore, sfTexture *texture, size_t first, size_t count);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the ratio between the decompressed and compressed sizes
+///
+/// \param frameStore   Frame store object
+///
+/// \return The compression ratio of the store
+///
+////////////////////////////////////////////////////////////
+float sfFrameStore_getCompressionRatio(const sfFrameStore *frameStore);
+
+#endif // SFML_FRAMESTORE_H
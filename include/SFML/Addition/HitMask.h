@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_HITMASK_H
+    #define SFML_HITMASK_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+
+////////////////////////////////////////////////////////////
+/// \brief 1-bit alpha mask of an image, packed in 64-bit words
+///
+/// Bit `x % 64` of word `y * wordsPerRow + x / 64` is set
+/// when the pixel (x, y) is opaque enough to be hit.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfUint64 *bits;
+    sfVector2u size;
+    size_t wordsPerRow;
+} sfHitMask;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new hit mask from an image
+///
+/// A pixel is considered solid when its alpha is strictly
+/// greater than \a alphaThreshold.
+///
+/// \param image            Source image
+/// \param alphaThreshold   Alpha value under which a pixel is ignored
+///
+/// \return A new sfHitMask object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfHitMask *sfHitMask_createFromImage(const sfImage *image, sfUint8 alphaThreshold);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new hit mask from a texture
+///
+/// The texture is copied back to the CPU once, this function
+/// is meant to be called at load time, not every frame.
+///
+/// \param texture          Source texture
+/// \param alphaThreshold   Alpha value under which a pixel is ignored
+///
+/// \return A new sfHitMask object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfHitMask *sfHitMask_createFromTexture(const sfTexture *texture, sfUint8 alphaThreshold);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing hit mask
+///
+/// \param hitMask  Hit mask to destroy
+///
+////////////////////////////////////////////////////////////
+void sfHitMask_destroy(sfHitMask *hitMask);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the state of a pixel of a hit mask
+///
+/// \param hitMask  Hit mask object
+/// \param x        X coordinate of the pixel
+/// \param y        Y coordinate of the pixel
+///
+/// \return sfTrue if the pixel is solid, sfFalse if it is transparent or out of the mask
+///
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_getPixel(const sfHitMask *hitMask, unsigned int x, unsigned int y);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if a point in local coordinates hits a hit mask
+///
+/// The point is expressed in the local coordinate system of
+/// the entity (see sfSprite_getInverseTransform), and
+/// \a textureRect is the area of the mask currently displayed,
+/// which is the current frame for an animated sprite. A
+/// negative width or height flips the area, as it does the
+/// texture of a sprite.
+///
+/// \param hitMask      Hit mask object
+/// \param textureRect  Area of the mask displayed by the entity
+/// \param point        Point to test, in local coordinates
+///
+/// \return sfTrue if the point hits a solid pixel
+///
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_containsLocalPoint(const sfHitMask *hitMask, sfIntRect textureRect, sfVector2f point);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if two hit masks overlap
+///
+/// When both transforms are integer translations and neither
+/// area is flipped, the masks are compared 64 pixels at a time.
+/// Otherwise each pixel of the intersection of the global bounds
+/// is mapped back into both masks.
+///
+/// \param hitMaskA     First hit mask
+/// \param rectA        Area of the first mask displayed by the first entity
+/// \param transformA   Transform of the first entity
+/// \param hitMaskB     Second hit mask
+/// \param rectB        Area of the second mask displayed by the second entity
+/// \param transformB   Transform of the second entity
+///
+/// \return sfTrue if at least one solid pixel overlaps
+///
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_intersects(const sfHitMask *hitMaskA, sfIntRect rectA, const sfTransform *transformA, const sfHitMask *hitMaskB, sfIntRect rectB, const sfTransform *transformB);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if two sprites overlap using their hit masks
+///
+/// \param spriteA  First sprite object
+/// \param hitMaskA Hit mask of the texture of the first sprite
+/// \param spriteB  Second sprite object
+/// \param hitMaskB Hit mask of the texture of the second sprite
+///
+/// \return sfTrue if at least one solid pixel overlaps
+///
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isPixelCollision(const sfSprite *spriteA, const sfHitMask *hitMaskA, const sfSprite *spriteB, const sfHitMask *hitMaskB);
+
+#endif // SFML_HITMASK_H
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_HITTESTER_H
+    #define SFML_HITTESTER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Batch of oriented hit tests
+///
+/// The inverse transforms and local bounds of the registered
+/// sprites are stored in separate contiguous arrays, so testing
+/// one point against every sprite is a branchless loop the
+/// compiler can vectorize. A point (x, y) maps to the local point
+/// (a * x + b * y + c, d * x + e * y + f).
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float *a;
+    float *b;
+    float *c;
+    float *d;
+    float *e;
+    float *f;
+    float *left;
+    float *top;
+    float *right;
+    float *bottom;
+    size_t count;
+    size_t capacity;
+} sfHitTester;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new hit tester
+///
+/// \param capacity Number of sprites to reserve room for
+///
+/// \return A new sfHitTester object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfHitTester *sfHitTester_create(size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing hit tester
+///
+/// \param hitTester    Hit tester to destroy
+///
+////////////////////////////////////////////////////////////
+void sfHitTester_destroy(sfHitTester *hitTester);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove every sprite of a hit tester
+///
+/// The memory is kept for the next sprites.
+///
+/// \param hitTester    Hit tester object
+///
+////////////////////////////////////////////////////////////
+void sfHitTester_clear(sfHitTester *hitTester);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a sprite to a hit tester
+///
+/// The transform of the sprite is copied, call
+/// sfHitTester_setSprite when the sprite moves.
+///
+/// \param hitTester    Hit tester object
+/// \param sprite       Sprite to add
+///
+/// \return Index of the sprite in the hit tester, or -1 if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfHitTester_addSprite(sfHitTester *hitTester, const sfSprite *sprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an animated sprite to a hit tester
+///
+/// The quad of the current frame is stored, see
+/// sfAnimatedSprite_getLocalBounds, so trimmed frames of a
+/// sprite sheet are only hit where they are drawn.
+///
+/// \param hitTester        Hit tester object
+/// \param animatedSprite   Animated sprite to add
+///
+/// \return Index of the animated sprite in the hit tester, or -1 if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfHitTester_addAnimatedSprite(sfHitTester *hitTester, const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Refresh the transform and bounds stored for a sprite
+///
+/// \param hitTester    Hit tester object
+/// \param index        Index returned when the sprite was added
+/// \param sprite       Sprite to read the transform and bounds from
+///
+////////////////////////////////////////////////////////////
+void sfHitTester_setSprite(sfHitTester *hitTester, size_t index, const sfSprite *sprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Refresh the transform and bounds stored for an animated sprite
+///
+/// Call it when the animated sprite moved or its frame changed.
+///
+/// \param hitTester        Hit tester object
+/// \param index            Index returned when the animated sprite was added
+/// \param animatedSprite   Animated sprite to read the transform and bounds from
+///
+////////////////////////////////////////////////////////////
+void sfHitTester_setAnimatedSprite(sfHitTester *hitTester, size_t index, const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Test one point against every sprite of a hit tester
+///
+/// \param hitTester    Hit tester object
+/// \param point        Point to test, in global coordinates
+/// \param results      Array of at least count bytes receiving 1 for each hit sprite, 0 otherwise
+///
+/// \return Number of sprites hit by the point
+///
+////////////////////////////////////////////////////////////
+size_t sfHitTester_testPoint(const sfHitTester *hitTester, sfVector2f point, sfUint8 *results);
+
+////////////////////////////////////////////////////////////
+/// \brief Find the last added sprite hit by a point
+///
+/// \param hitTester    Hit tester object
+/// \param point        Point to test, in global coordinates
+///
+/// \return Index of the sprite, or -1 if no sprite is hit
+///
+////////////////////////////////////////////////////////////
+size_t sfHitTester_findTop(const sfHitTester *hitTester, sfVector2f point);
+
+#endif // SFML_HITTESTER_H
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_LEVELOFDETAIL_H
+    #define SFML_LEVELOFDETAIL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Number of levels of detail
+///
+////////////////////////////////////////////////////////////
+#define SF_LEVELOFDETAIL_COUNT 4
+
+////////////////////////////////////////////////////////////
+/// \brief Rules and statistics of level of detail selection
+///
+/// The level of an object is chosen from its size on screen,
+/// the largest side in pixels of its bounds once transformed
+/// by the render states and the current view: level i + 1 is
+/// used below thresholds[i]. At level i, curves are sampled
+/// with curveSamples[i] points, animated sprites use their
+/// sheet reduced i times and update their animation once
+/// every updateIntervals[i] draws. With a fixed step, such an
+/// update advances the animation by one step per draw since
+/// the previous one, so it plays at the same speed at every
+/// level. counts[i] is the number of objects drawn at level i.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float thresholds[SF_LEVELOFDETAIL_COUNT - 1];
+    size_t curveSamples[SF_LEVELOFDETAIL_COUNT];
+    size_t updateIntervals[SF_LEVELOFDETAIL_COUNT];
+    size_t counts[SF_LEVELOFDETAIL_COUNT];
+} sfLevelOfDetail;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the default level of detail rules
+///
+/// The thresholds are 128, 48 and 16 pixels, the curves are
+/// sampled with 10000, 2500, 600 and 150 points and animations
+/// are updated every 1, 2, 4 and 8 draws.
+///
+/// \return Default rules, with counts set to zero
+///
+////////////////////////////////////////////////////////////
+sfLevelOfDetail sfLevelOfDetail_getDefault(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Select the level of detail of a size on screen
+///
+/// \param lod          Level of detail rules
+/// \param screenSize   Size on screen, in pixels
+///
+/// \return Level of detail, from 0 to SF_LEVELOFDETAIL_COUNT - 1
+///
+////////////////////////////////////////////////////////////
+size_t sfLevelOfDetail_select(const sfLevelOfDetail *lod, float screenSize);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the number of objects drawn at each level
+///
+/// \param lod  Level of detail object
+///
+////////////////////////////////////////////////////////////
+void sfLevelOfDetail_resetCounts(sfLevelOfDetail *lod);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the size on screen of a rectangle of the scene
+///
+/// \param renderWindow render window object
+/// \param bounds       Rectangle in scene coordinates
+/// \param transform    Transform applied to the rectangle (NULL for none)
+///
+/// \return Largest side of the rectangle on screen, in pixels
+///
+////////////////////////////////////////////////////////////
+float sfRenderWindow_getScreenSize(const sfRenderWindow *renderWindow, sfFloatRect bounds, const sfTransform *transform);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a bezier curve with a level of detail
+///
+/// \param renderWindow render window object
+/// \param bezierCurve  Object to draw
+/// \param lod          Level of detail rules, its counts are updated
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawBezierCurveLod(sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, sfLevelOfDetail *lod, const sfRenderStates *states);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw an animated sprite with a level of detail
+///
+/// The reduced sheets are built by sfAnimatedSprite_createLodTextures,
+/// without them the full resolution sheet is used at every level.
+///
+/// \param renderWindow     render window object
+/// \param animatedSprite   Object to draw
+/// \param lod              Level of detail rules, its counts are updated
+/// \param states           Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpriteLod(sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfLevelOfDetail *lod, const sfRenderStates *states);
+
+#endif // SFML_LEVELOFDETAIL_H
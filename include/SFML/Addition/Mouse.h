@@ -41,6 +41,8 @@
 /// \param sprite       Sprite object
 /// \param mouseButton  Button to check
 ///
+/// \return sfTrue if the button is pressed while the mouse is over the sprite
+///
 ////////////////////////////////////////////////////////////
 sfBool sfSprite_isMouseButtonPressed(const sfRenderWindow *renderWindow, const sfSprite *sprite, sfMouseButton mouseButton);
 
@@ -50,6 +52,8 @@ sfBool sfSprite_isMouseButtonPressed(const sfRenderWindow *renderWindow, const s
 /// \param renderWindow Render window object
 /// \param sprite       Sprite object
 ///
+/// \return sfTrue if the mouse is over the global bounds of the sprite
+///
 ////////////////////////////////////////////////////////////
 sfBool sfSprite_isMouseHover(const sfRenderWindow *renderWindow, const sfSprite *sprite);
 
@@ -60,16 +64,130 @@ sfBool sfSprite_isMouseHover(const sfRenderWindow *renderWindow, const sfSprite
 /// \param animatedSprite   Sprite object
 /// \param mouseButton      Button to check
 ///
+/// \return sfTrue if the button is pressed while the mouse is over the animated sprite
+///
 ////////////////////////////////////////////////////////////
 sfBool sfAnimatedSprite_isMouseButtonPressed(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, sfMouseButton mouseButton);
 
 ////////////////////////////////////////////////////////////
 /// \brief Check if the mouse is hover an animated sprite
 ///
+/// The mouse is tested against sfAnimatedSprite_getGlobalBounds,
+/// which follow the trimmed frames of a sprite sheet.
+///
 /// \param renderWindow     Render window object
 /// \param animatedSprite   Animated sprite object
 ///
+/// \return sfTrue if the mouse is over the global bounds of the animated sprite
+///
 ////////////////////////////////////////////////////////////
 sfBool sfAnimatedSprite_isMouseHover(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite);
 
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover a solid pixel of a sprite
+///
+/// The mouse position is mapped into the local space of the
+/// sprite with its inverse transform, so rotation, scale and
+/// transparent areas are taken into account.
+///
+/// \param renderWindow Render window object
+/// \param sprite       Sprite object
+/// \param hitMask      Hit mask of the texture of the sprite
+///
+/// \return sfTrue if the mouse is over a solid pixel of the sprite
+///
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverPixel(const sfRenderWindow *renderWindow, const sfSprite *sprite, const sfHitMask *hitMask);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover a solid pixel of an animated sprite
+///
+/// The hit mask built with sfAnimatedSprite_createHitMask is
+/// used with the current frame of the animation, placed as it
+/// is drawn (see sfAnimatedSprite_isPixelHit). Without hit
+/// mask, this function always returns sfFalse.
+///
+/// \param renderWindow     Render window object
+/// \param animatedSprite   Animated sprite object
+///
+/// \return sfTrue if the mouse is over a solid pixel of the current frame
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverPixel(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover the oriented bounds of a sprite
+///
+/// Unlike sfSprite_isMouseHover, the mouse position is mapped
+/// into the local space of the sprite and tested against its
+/// local bounds, so a rotated sprite is not hit in the corners
+/// of its axis-aligned global bounds.
+///
+/// \param renderWindow Render window object
+/// \param sprite       Sprite object
+///
+/// \return sfTrue if the mouse is inside the oriented bounds of the sprite
+///
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverOriented(const sfRenderWindow *renderWindow, const sfSprite *sprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover a custom polygon of a sprite
+///
+/// The polygon is expressed in the local coordinates of the
+/// sprite, it can be concave but must not be self-intersecting.
+///
+/// \param renderWindow Render window object
+/// \param sprite       Sprite object
+/// \param points       Vertices of the polygon, in local coordinates
+/// \param pointCount   Number of vertices of the polygon
+///
+/// \return sfTrue if the mouse is inside the polygon
+///
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverPolygon(const sfRenderWindow *renderWindow, const sfSprite *sprite, const sfVector2f *points, size_t pointCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover the oriented bounds of an animated sprite
+///
+/// The mouse is tested against sfAnimatedSprite_getLocalBounds,
+/// so only the trimmed quad of a sprite sheet frame is hit.
+///
+/// \param renderWindow     Render window object
+/// \param animatedSprite   Animated sprite object
+///
+/// \return sfTrue if the mouse is inside the quad of the current frame
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverOriented(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if the mouse is hover a custom polygon of an animated sprite
+///
+/// The polygon is in the local coordinates of the untrimmed
+/// frame, only its part inside the quad of the current frame
+/// (see sfAnimatedSprite_getLocalBounds) can be hit.
+///
+/// \param renderWindow     Render window object
+/// \param animatedSprite   Animated sprite object
+/// \param points           Vertices of the polygon, in local coordinates
+/// \param pointCount       Number of vertices of the polygon
+///
+/// \return sfTrue if the mouse is inside the polygon and the quad of the current frame
+///
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverPolygon(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, const sfVector2f *points, size_t pointCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Check if a point in local coordinates is inside a polygon
+///
+/// \param points       Vertices of the polygon
+/// \param pointCount   Number of vertices of the polygon
+/// \param point        Point to test
+///
+/// \return sfTrue if the point is inside the polygon
+///
+////////////////////////////////////////////////////////////
+sfBool sfPolygon_contains(const sfVector2f *points, size_t pointCount, sfVector2f point);
+
 #endif // SFML_MOUSE_ADDITION_H
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_MOUSEDISPATCHER_H
+    #define SFML_MOUSEDISPATCHER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+#include <SFML/Window/Event.h>
+#include <SFML/Window/Mouse.h>
+#include <SFML/Addition/AnimatedSprite.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Type of the events emitted to a mouse target
+///
+////////////////////////////////////////////////////////////
+typedef enum
+{
+    sfMouseTargetEnter,     ///< The mouse entered the target
+    sfMouseTargetLeave,     ///< The mouse left the target
+    sfMouseTargetPress,     ///< A button was pressed on the target
+    sfMouseTargetRelease,   ///< A button pressed on the target was released
+    sfMouseTargetClick,     ///< A button was pressed and released on the target
+    sfMouseTargetDrag       ///< The mouse moved while a button pressed on the target is held
+} sfMouseTargetEventType;
+
+////////////////////////////////////////////////////////////
+/// \brief Event emitted to a mouse target
+///
+/// The button is sfMouseButtonCount for enter and leave
+/// events, the delta is only set for drag events.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfMouseTargetEventType type;
+    sfMouseButton button;
+    sfVector2i position;
+    sfVector2i delta;
+} sfMouseTargetEvent;
+
+////////////////////////////////////////////////////////////
+/// \brief Callback receiving the events of a mouse target
+///
+////////////////////////////////////////////////////////////
+typedef void (*sfMouseTargetCallback)(const sfMouseTargetEvent *event, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Identifier of a target of a mouse dispatcher
+///
+/// The low 32 bits are the index of the slot, the high 32
+/// bits its generation, which changes every time the slot is
+/// added to or removed so the identifiers of removed targets
+/// never refer to the targets reusing their slot.
+///
+////////////////////////////////////////////////////////////
+typedef sfUint64 sfMouseTargetId;
+
+////////////////////////////////////////////////////////////
+/// \brief Identifier that never refers to a target
+///
+////////////////////////////////////////////////////////////
+#define SF_MOUSETARGETID_INVALID ((sfMouseTargetId)0)
+
+////////////////////////////////////////////////////////////
+/// \brief Sprite or animated sprite registered in a dispatcher
+///
+/// Free slots have no callback and an even generation.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const sfSprite *sprite;
+    const sfAnimatedSprite *animatedSprite;
+    sfMouseTargetCallback callback;
+    void *userData;
+    sfBool hovered;
+    sfUint32 generation;
+} sfMouseTarget;
+
+////////////////////////////////////////////////////////////
+/// \brief Event-driven mouse dispatcher
+///
+/// The dispatcher consumes the mouse events of a window and
+/// only queries its targets when the mouse moved or a button
+/// changed, idle frames cost nothing.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfMouseTarget *targets;
+    size_t targetCount;
+    size_t targetCapacity;
+    sfVector2i position;
+    sfBool inside;
+    size_t pressedTarget[sfMouseButtonCount];
+} sfMouseDispatcher;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new mouse dispatcher
+///
+/// \return A new sfMouseDispatcher object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfMouseDispatcher *sfMouseDispatcher_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing mouse dispatcher
+///
+/// The registered sprites are not destroyed.
+///
+/// \param dispatcher   Mouse dispatcher to destroy
+///
+////////////////////////////////////////////////////////////
+void sfMouseDispatcher_destroy(sfMouseDispatcher *dispatcher);
+
+////////////////////////////////////////////////////////////
+/// \brief Register a sprite in a mouse dispatcher
+///
+/// Targets registered last are considered on top of the
+/// others: they receive the press, release and click events
+/// when several targets are under the mouse. The mouse is
+/// tested against the oriented bounds of the sprite.
+///
+/// \param dispatcher   Mouse dispatcher object
+/// \param sprite       Sprite to register
+/// \param callback     Function receiving the events of the sprite
+/// \param userData     Pointer passed to the callback
+///
+/// \return Identifier of the target, or SF_MOUSETARGETID_INVALID if it failed
+///
+////////////////////////////////////////////////////////////
+sfMouseTargetId sfMouseDispatcher_addSprite(sfMouseDispatcher *dispatcher, const sfSprite *sprite, sfMouseTargetCallback callback, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Register an animated sprite in a mouse dispatcher
+///
+/// When the animated sprite has a hit mask, it is used
+/// for the hit tests instead of the bounds.
+///
+/// \param dispatcher       Mouse dispatcher object
+/// \param animatedSprite   Animated sprite to register
+/// \param callback         Function receiving the events of the animated sprite
+/// \param userData         Pointer passed to the callback
+///
+/// \return Identifier of the target, or SF_MOUSETARGETID_INVALID if it failed
+///
+////////////////////////////////////////////////////////////
+sfMouseTargetId sfMouseDispatcher_addAnimatedSprite(sfMouseDispatcher *dispatcher, const sfAnimatedSprite *animatedSprite, sfMouseTargetCallback callback, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Unregister a target from a mouse dispatcher
+///
+/// No leave event is emitted to the removed target. The
+/// identifier becomes stale, removing it again does nothing.
+///
+/// \param dispatcher   Mouse dispatcher object
+/// \param target       Identifier returned when the target was added
+///
+/// \return sfTrue if the target was removed, sfFalse if the identifier is stale
+///
+////////////////////////////////////////////////////////////
+sfBool sfMouseDispatcher_remove(sfMouseDispatcher *dispatcher, sfMouseTargetId target);
+
+////////////////////////////////////////////////////////////
+/// \brief Feed an event to a mouse dispatcher
+///
+/// Only sfEvtMouseMoved, sfEvtMouseButtonPressed,
+/// sfEvtMouseButtonReleased and sfEvtMouseLeft are handled,
+/// the coordinates of the event are used as is.
+///
+/// \param dispatcher   Mouse dispatcher object
+/// \param event        Event to process
+///
+/// \return sfTrue if the event was a mouse event
+///
+////////////////////////////////////////////////////////////
+sfBool sfMouseDispatcher_handleEvent(sfMouseDispatcher *dispatcher, const sfEvent *event);
+
+////////////////////////////////////////////////////////////
+/// \brief Test the targets again at the last mouse position
+///
+/// Call this function when targets moved under a still mouse
+/// to emit the corresponding enter and leave events.
+///
+/// \param dispatcher   Mouse dispatcher object
+///
+////////////////////////////////////////////////////////////
+void sfMouseDispatcher_update(sfMouseDispatcher *dispatcher);
+
+#endif // SFML_MOUSEDISPATCHER_H
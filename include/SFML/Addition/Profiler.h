@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PROFILER_H
+    #define SFML_PROFILER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Counters and timers of the library hot paths
+///
+/// Times are in microseconds. The counters are only updated
+/// when the library is built with CSFML_ADDITION_PROFILING,
+/// otherwise they stay at zero and the instrumentation is
+/// compiled out.
+///
+/// Thread safety: the library may be used from several
+/// threads (rasterizer and tessellator workers, a render
+/// thread next to a simulation thread, ...), the counters,
+/// timers and trace events can be updated from all of them.
+/// sfProfiler_getStats reads each counter on its own, so while
+/// other threads draw the copy may mix counters read before
+/// and after one of their updates. sfProfiler_startTrace and
+/// sfProfiler_saveTrace must not be called while another
+/// thread draws, the recording buffer is replaced or read.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfUint64 curveDraws;
+    sfUint64 curveSamples;
+    sfUint64 vertexAppends;
+    sfUint64 animatedSpriteDraws;
+    sfUint64 animatedSpriteUpdates;
+    sfUint64 textureRectChanges;
+    sfUint64 hitTests;
+    sfInt64 curveDrawTime;
+    sfInt64 animatedSpriteDrawTime;
+} sfProfilerStats;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the statistics gathered since the last reset
+///
+/// \return Copy of the current statistics
+///
+////////////////////////////////////////////////////////////
+sfProfilerStats sfProfiler_getStats(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Reset the statistics, typically once per frame
+///
+/// Updates made by other threads during the reset are either
+/// cleared or kept, never torn.
+///
+////////////////////////////////////////////////////////////
+void sfProfiler_resetStats(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Start recording trace events
+///
+/// Every timed scope is recorded until \a capacity events
+/// are stored, the following ones are dropped. Any previous
+/// recording is discarded.
+///
+/// \param capacity Maximum number of events to record
+///
+/// \return sfTrue if the recording started, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_startTrace(size_t capacity);
+
+////////////////////////////////////////////////////////////
+/// \brief Stop recording trace events
+///
+/// The recorded events are kept until the next call to
+/// sfProfiler_startTrace.
+///
+////////////////////////////////////////////////////////////
+void sfProfiler_stopTrace(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Save the recorded events to a file
+///
+/// The file uses the Chrome trace event format, it can be
+/// opened in chrome://tracing or https://ui.perfetto.dev.
+///
+/// \param filename Path of the file to write
+///
+/// \return sfTrue if the file was written, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_saveTrace(const char *filename);
+
+#endif // SFML_PROFILER_H
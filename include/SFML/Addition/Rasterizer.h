@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_RASTERIZER_H
+    #define SFML_RASTERIZER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Default number of rows of a rasterizer tile
+///
+////////////////////////////////////////////////////////////
+#define SF_RASTERIZER_TILE_HEIGHT 32
+
+////////////////////////////////////////////////////////////
+/// \brief CPU rasterizer drawing into images
+///
+/// The rasterizer draws without any OpenGL context, into an
+/// sfImage: the area covered by an object is drawn in a copy
+/// of its pixels, copied back with sfImage_copyImage once the
+/// object is drawn. The area is split in bands of tileHeight
+/// rows which are shared between the calling thread and
+/// threadCount - 1 worker threads. The worker threads are
+/// started by sfRasterizer_create and wait for the next draw
+/// in between. Every pixel only depends on the object drawn,
+/// so the result is the same whatever the number of threads.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    void *group;
+    unsigned int threadCount;
+    unsigned int tileHeight;
+    void *job;
+} sfRasterizer;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new rasterizer
+///
+/// \param threadCount  Number of threads drawing, including the calling thread
+///
+/// \return A new sfRasterizer object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfRasterizer *sfRasterizer_create(unsigned int threadCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing rasterizer
+///
+/// \param rasterizer   Rasterizer to destroy
+///
+////////////////////////////////////////////////////////////
+void sfRasterizer_destroy(sfRasterizer *rasterizer);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a bezier curve into an image
+///
+/// The curve is flattened into segments of a couple of pixels
+/// and stroked with anti-aliasing: hairlines (thickness of 1
+/// or less) use Xiaolin Wu's algorithm, thicker strokes use the
+/// distance of each pixel to the segments. The color of the
+/// curve is alpha blended over the image.
+///
+/// \param rasterizer   Rasterizer object (NULL to draw on the calling thread only)
+/// \param image        Image to draw into
+/// \param bezierCurve  Bezier curve to draw
+/// \param thickness    Thickness of the stroke, in pixels
+/// \param transform    Transform applied to the curve (NULL for none)
+///
+////////////////////////////////////////////////////////////
+void sfRasterizer_drawBezierCurve(sfRasterizer *rasterizer, sfImage *image, const sfBezierCurve *bezierCurve, float thickness, const sfTransform *transform);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw the current frame of an animated sprite into an image
+///
+/// The pixels of a texture live on the graphics card, so the
+/// sprite sheet must be given as an image. Texels are sampled
+/// with the nearest filter, modulated by the color of the
+/// sprite and alpha blended over the image. The animation is
+/// not advanced, see sfAnimatedSprite_update.
+///
+/// \param rasterizer       Rasterizer object (NULL to draw on the calling thread only)
+/// \param image            Image to draw into
+/// \param animatedSprite   Animated sprite to draw
+/// \param sheet            Image of the sprite sheet of the animated sprite
+///
+////////////////////////////////////////////////////////////
+void sfRasterizer_drawAnimatedSprite(sfRasterizer *rasterizer, sfImage *image, const sfAnimatedSprite *animatedSprite, const sfImage *sheet);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a bezier curve into an image
+///
+/// Same as sfRasterizer_drawBezierCurve on the calling thread.
+///
+/// \param image        Image to draw into
+/// \param bezierCurve  Bezier curve to draw
+/// \param thickness    Thickness of the stroke, in pixels
+/// \param transform    Transform applied to the curve (NULL for none)
+///
+////////////////////////////////////////////////////////////
+void sfImage_drawBezierCurve(sfImage *image, const sfBezierCurve *bezierCurve, float thickness, const sfTransform *transform);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw the current frame of an animated sprite into an image
+///
+/// Same as sfRasterizer_drawAnimatedSprite on the calling thread.
+///
+/// \param image            Image to draw into
+/// \param animatedSprite   Animated sprite to draw
+/// \param sheet            Image of the sprite sheet of the animated sprite
+///
+////////////////////////////////////////////////////////////
+void sfImage_drawAnimatedSprite(sfImage *image, const sfAnimatedSprite *animatedSprite, const sfImage *sheet);
+
+#endif // SFML_RASTERIZER_H
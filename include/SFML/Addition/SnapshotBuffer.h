@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SNAPSHOTBUFFER_H
+    #define SFML_SNAPSHOTBUFFER_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief State of a group of curves and animated sprites
+///
+/// The curves are copies whose points live in the snapshot,
+/// the animated sprites are quads already placed in the scene
+/// with the texture of each one.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfBezierCurve *curves;
+    size_t curveCount;
+    size_t curveCapacity;
+    sfVector2f *points;
+    size_t pointCapacity;
+    sfVertex *vertices;
+    const sfTexture **textures;
+    size_t spriteCount;
+    size_t spriteCapacity;
+    sfUint64 sequence;
+} sfSnapshot;
+
+////////////////////////////////////////////////////////////
+/// \brief Triple buffer of snapshots shared by two threads
+///
+/// One thread, the writer, owns the curves and animated
+/// sprites: it moves and animates them, then publishes a
+/// snapshot of them. Another thread, the reader, draws the
+/// last published snapshot. The snapshots are exchanged with
+/// an atomic swap, neither thread ever waits for the other.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSnapshot snapshots[3];
+    void *exchange;
+    unsigned int writeIndex;
+    unsigned int readIndex;
+    const sfBezierCurve **curves;
+    size_t curveCount;
+    size_t curveCapacity;
+    const sfAnimatedSprite **animatedSprites;
+    size_t animatedSpriteCount;
+    size_t animatedSpriteCapacity;
+    sfUint64 sequence;
+} sfSnapshotBuffer;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new snapshot buffer
+///
+/// \return A new snapshot buffer, or NULL if it could not be created
+///
+////////////////////////////////////////////////////////////
+sfSnapshotBuffer *sfSnapshotBuffer_create(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing snapshot buffer
+///
+/// Its curves and animated sprites are not destroyed. No
+/// thread may use the buffer anymore.
+///
+/// \param snapshotBuffer   Snapshot buffer to delete
+///
+////////////////////////////////////////////////////////////
+void sfSnapshotBuffer_destroy(sfSnapshotBuffer *snapshotBuffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a bezier curve to the snapshots, from the writer thread
+///
+/// \param snapshotBuffer   Snapshot buffer object
+/// \param bezierCurve      Curve owned by the writer thread
+///
+/// \return sfTrue if the curve was added, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_addBezierCurve(sfSnapshotBuffer *snapshotBuffer, const sfBezierCurve *bezierCurve);
+
+////////////////////////////////////////////////////////////
+/// \brief Add an animated sprite to the snapshots, from the writer thread
+///
+/// The writer thread advances the animation, with
+/// sfAnimatedSprite_update or sfAnimatedSprite_advance,
+/// before publishing.
+///
+/// \param snapshotBuffer   Snapshot buffer object
+/// \param animatedSprite   Animated sprite owned by the writer thread
+///
+/// \return sfTrue if the animated sprite was added, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_addAnimatedSprite(sfSnapshotBuffer *snapshotBuffer, const sfAnimatedSprite *animatedSprite);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove every curve and animated sprite, from the writer thread
+///
+/// The snapshots already published are kept.
+///
+/// \param snapshotBuffer   Snapshot buffer object
+///
+////////////////////////////////////////////////////////////
+void sfSnapshotBuffer_clear(sfSnapshotBuffer *snapshotBuffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Publish the current state of the objects, from the writer thread
+///
+/// The transforms, control points and current frames are
+/// copied to a free snapshot, which then replaces the last
+/// published one.
+///
+/// \param snapshotBuffer   Snapshot buffer object
+///
+/// \return sfTrue if a snapshot was published, sfFalse if it could not be allocated
+///
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_publish(sfSnapshotBuffer *snapshotBuffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the last published snapshot, from the reader thread
+///
+/// The snapshot stays valid and unchanged until the next call,
+/// whatever the writer thread publishes meanwhile.
+///
+/// \param snapshotBuffer   Snapshot buffer object
+///
+/// \return The last published snapshot, empty before the first one
+///
+////////////////////////////////////////////////////////////
+const sfSnapshot *sfSnapshotBuffer_acquire(sfSnapshotBuffer *snapshotBuffer);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw a snapshot to the render-target
+///
+/// Only the snapshot is read, the curves and animated sprites
+/// it was taken from are never touched. Consecutive sprites
+/// sharing a texture are drawn in one call.
+///
+/// \param renderWindow render window object
+/// \param snapshot     Snapshot to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawSnapshot(sfRenderWindow *renderWindow, const sfSnapshot *snapshot, const sfRenderStates *states);
+
+#endif // SFML_SNAPSHOTBUFFER_H
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_SPRITESHEET_H
+    #define SFML_SPRITESHEET_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Graphics.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Frame of a packed sprite sheet
+///
+/// rect is the area of the frame in the sheet, with the size
+/// of the frame before packing: a rotated frame was turned 90
+/// degrees clockwise by the packer and covers rect.height x
+/// rect.width pixels of the sheet. offset is the position of
+/// the trimmed frame in its untrimmed size, sourceSize.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfIntRect rect;
+    sfVector2f offset;
+    sfVector2u sourceSize;
+    sfInt64 duration;
+    sfBool rotated;
+} sfSpriteSheetFrame;
+
+////////////////////////////////////////////////////////////
+/// \brief Named range of frames of a sprite sheet
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char *name;
+    size_t from;
+    size_t to;
+} sfSpriteSheetTag;
+
+////////////////////////////////////////////////////////////
+/// \brief Frame table of a packed sprite sheet
+///
+/// The table, its tags and their names live in the same
+/// block of memory as the structure.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSpriteSheetFrame *frames;
+    size_t frameCount;
+    sfSpriteSheetTag *tags;
+    size_t tagCount;
+    const char *image;
+} sfSpriteSheet;
+
+////////////////////////////////////////////////////////////
+/// \brief Load the metadata of a sprite sheet from a file
+///
+/// The file is a JSON export of TexturePacker or Aseprite,
+/// with its frames as a hash or as an array. The file is read
+/// through a small buffer, twice: once to count the frames,
+/// tags and names, once to fill the table. The sheet is not
+/// loaded if a tag does not give a range of its frames as
+/// whole numbers.
+///
+/// \param filename Path of the JSON file to load
+///
+/// \return A new sprite sheet, or NULL if it could not be loaded
+///
+////////////////////////////////////////////////////////////
+sfSpriteSheet *sfSpriteSheet_createFromFile(const char *filename);
+
+////////////////////////////////////////////////////////////
+/// \brief Load the metadata of a sprite sheet from memory
+///
+/// \param data JSON text of the sheet
+/// \param size Size of the text, in bytes
+///
+/// \return A new sprite sheet, or NULL if it could not be loaded
+///
+////////////////////////////////////////////////////////////
+sfSpriteSheet *sfSpriteSheet_createFromMemory(const void *data, size_t size);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing sprite sheet
+///
+/// \param spriteSheet  Sprite sheet to delete
+///
+////////////////////////////////////////////////////////////
+void sfSpriteSheet_destroy(sfSpriteSheet *spriteSheet);
+
+////////////////////////////////////////////////////////////
+/// \brief Find a tag of a sprite sheet by name
+///
+/// \param spriteSheet  Sprite sheet object
+/// \param name         Name of the tag
+///
+/// \return The tag, or NULL if there is none with this name
+///
+////////////////////////////////////////////////////////////
+const sfSpriteSheetTag *sfSpriteSheet_getTag(const sfSpriteSheet *spriteSheet, const char *name);
+
+#endif // SFML_SPRITESHEET_H
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_TESSELLATOR_H
+    #define SFML_TESSELLATOR_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <SFML/Config.h>
+#include <SFML/Graphics.h>
+#include <SFML/Addition/BezierCurve.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Sample count asking for one sample per pixel of curve
+///
+////////////////////////////////////////////////////////////
+#define SF_TESSELLATOR_ADAPTIVE 0
+
+////////////////////////////////////////////////////////////
+/// \brief Index returned by sfTessellator_addCurve when it failed
+///
+////////////////////////////////////////////////////////////
+#define SF_TESSELLATOR_NO_CURVE ((size_t)-1)
+
+////////////////////////////////////////////////////////////
+/// \brief Parallel tessellation of a set of bezier curves
+///
+/// The curves are tessellated into consecutive ranges of a
+/// shared vertex buffer, whose offsets are computed before
+/// the threads start. Each thread owns a range of curves and
+/// steals half of the remaining range of another thread when
+/// it runs out of work. Every vertex only depends on its curve,
+/// so the buffer is the same whatever the number of threads.
+/// The worker threads are started by sfTessellator_create and
+/// wait for the next tessellation between two runs.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    void *group;
+    unsigned int threadCount;
+    void *workers;
+    const sfBezierCurve **curves;
+    size_t *offsets;
+    size_t curveCount;
+    size_t curveCapacity;
+    sfVertex *vertices;
+    size_t vertexCount;
+    size_t vertexCapacity;
+    sfBool running;
+} sfTessellator;
+
+////////////////////////////////////////////////////////////
+/// \brief Create a new tessellator
+///
+/// \param threadCount  Number of threads tessellating, including the calling thread
+///
+/// \return A new sfTessellator object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfTessellator *sfTessellator_create(unsigned int threadCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Destroy an existing tessellator
+///
+/// \param tessellator  Tessellator to destroy
+///
+////////////////////////////////////////////////////////////
+void sfTessellator_destroy(sfTessellator *tessellator);
+
+////////////////////////////////////////////////////////////
+/// \brief Remove every curve of a tessellator
+///
+/// \param tessellator  Tessellator object
+///
+////////////////////////////////////////////////////////////
+void sfTessellator_clear(sfTessellator *tessellator);
+
+////////////////////////////////////////////////////////////
+/// \brief Add a curve to tessellate
+///
+/// The curve must not be modified until the tessellation is
+/// finished.
+///
+/// \param tessellator  Tessellator object
+/// \param bezierCurve  Bezier curve to tessellate
+///
+/// \return Index of the curve, or SF_TESSELLATOR_NO_CURVE if it failed
+///
+////////////////////////////////////////////////////////////
+size_t sfTessellator_addCurve(sfTessellator *tessellator, const sfBezierCurve *bezierCurve);
+
+////////////////////////////////////////////////////////////
+/// \brief Start the tessellation of the curves in the background
+///
+/// The worker threads tessellate the curves while the calling
+/// thread goes on, sfTessellator_wait must be called before
+/// using the vertices. With a single thread the tessellation
+/// is done before the function returns.
+///
+/// \param tessellator  Tessellator object
+/// \param sampleCount  Number of points per curve, or SF_TESSELLATOR_ADAPTIVE
+///
+/// \return sfTrue if the tessellation started, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfTessellator_launch(sfTessellator *tessellator, size_t sampleCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait for the end of the tessellation started by sfTessellator_launch
+///
+/// \param tessellator  Tessellator object
+///
+////////////////////////////////////////////////////////////
+void sfTessellator_wait(sfTessellator *tessellator);
+
+////////////////////////////////////////////////////////////
+/// \brief Tessellate the curves, with the help of the calling thread
+///
+/// \param tessellator  Tessellator object
+/// \param sampleCount  Number of points per curve, or SF_TESSELLATOR_ADAPTIVE
+///
+/// \return sfTrue if the curves were tessellated, sfFalse otherwise
+///
+////////////////////////////////////////////////////////////
+sfBool sfTessellator_run(sfTessellator *tessellator, size_t sampleCount);
+
+////////////////////////////////////////////////////////////
+/// \brief Get the vertices of a curve
+///
+/// \param tessellator  Tessellator object
+/// \param curve        Index returned by sfTessellator_addCurve
+/// \param count        Receives the number of vertices of the curve
+///
+/// \return First vertex of the curve, or NULL if there is none
+///
+////////////////////////////////////////////////////////////
+const sfVertex *sfTessellator_getCurveVertices(const sfTessellator *tessellator, size_t curve, size_t *count);
+
+////////////////////////////////////////////////////////////
+/// \brief Draw every tessellated curve in a single draw call
+///
+/// \param renderWindow render window object
+/// \param tessellator  Tessellator to draw
+/// \param states       Render states to use for drawing (NULL to use the default states)
+///
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawTessellator(sfRenderWindow *renderWindow, sfTessellator *tessellator, const sfRenderStates *states);
+
+#endif // SFML_TESSELLATOR_H
@@ -0,0 +1,315 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+
+////////////////////////////////////////////////////////////
+#define SF_ALLOCATOR_ALIGNMENT 16
+#define SF_ALLOCATOR_ALIGN(size) (((size) + SF_ALLOCATOR_ALIGNMENT - 1) & ~(size_t)(SF_ALLOCATOR_ALIGNMENT - 1))
+
+////////////////////////////////////////////////////////////
+static void *sfAllocator_defaultAllocate(size_t size, void *userData)
+{
+    (void)userData;
+    return (malloc(size));
+}
+
+////////////////////////////////////////////////////////////
+static void *sfAllocator_defaultReallocate(void *pointer, size_t size, void *userData)
+{
+    (void)userData;
+    return (realloc(pointer, size));
+}
+
+////////////////////////////////////////////////////////////
+static void sfAllocator_defaultDeallocate(void *pointer, void *userData)
+{
+    (void)userData;
+    free(pointer);
+}
+
+////////////////////////////////////////////////////////////
+static sfAllocator sfAllocator_current = {
+    sfAllocator_defaultAllocate,
+    sfAllocator_defaultReallocate,
+    sfAllocator_defaultDeallocate,
+    NULL
+};
+static _Thread_local sfArena *sfAllocator_frameArena = NULL;
+
+////////////////////////////////////////////////////////////
+void sfAllocator_set(const sfAllocator *allocator)
+{
+    if (allocator == NULL || allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL) {
+        sfAllocator_current = (sfAllocator){sfAllocator_defaultAllocate, sfAllocator_defaultReallocate, sfAllocator_defaultDeallocate, NULL};
+        return;
+    }
+    sfAllocator_current = *allocator;
+}
+
+////////////////////////////////////////////////////////////
+void *sfAllocator_malloc(size_t size)
+{
+    return (sfAllocator_current.allocate(size, sfAllocator_current.userData));
+}
+
+////////////////////////////////////////////////////////////
+void *sfAllocator_calloc(size_t count, size_t size)
+{
+    void *pointer = NULL;
+
+    if (size != 0 && count > SIZE_MAX / size)
+        return (NULL);
+    pointer = sfAllocator_malloc(count * size);
+    if (pointer != NULL)
+        memset(pointer, 0, count * size);
+    return (pointer);
+}
+
+////////////////////////////////////////////////////////////
+void *sfAllocator_realloc(void *pointer, size_t size)
+{
+    return (sfAllocator_current.reallocate(pointer, size, sfAllocator_current.userData));
+}
+
+////////////////////////////////////////////////////////////
+void sfAllocator_free(void *pointer)
+{
+    if (pointer == NULL)
+        return;
+    sfAllocator_current.deallocate(pointer, sfAllocator_current.userData);
+}
+
+////////////////////////////////////////////////////////////
+void sfAllocator_setFrameArena(sfArena *arena)
+{
+    sfAllocator_frameArena = arena;
+}
+
+////////////////////////////////////////////////////////////
+sfArena *sfAllocator_getFrameArena(void)
+{
+    return (sfAllocator_frameArena);
+}
+
+////////////////////////////////////////////////////////////
+void *sfAllocator_getScratch(size_t size, size_t *mark)
+{
+    void *pointer = NULL;
+
+    *mark = sfArena_getOffset(sfAllocator_frameArena);
+    pointer = sfArena_allocate(sfAllocator_frameArena, size);
+    if (pointer != NULL)
+        return (pointer);
+    *mark = (size_t)-1;
+    return (sfAllocator_malloc(size));
+}
+
+////////////////////////////////////////////////////////////
+void sfAllocator_releaseScratch(void *pointer, size_t mark)
+{
+    if (mark == (size_t)-1)
+        sfAllocator_free(pointer);
+    else
+        sfArena_rewind(sfAllocator_frameArena, mark);
+}
+
+////////////////////////////////////////////////////////////
+/// Lock and unlock a pool, the critical sections are a few
+/// pointer swaps so a spin lock is enough
+////////////////////////////////////////////////////////////
+static void sfPool_lock(sfPool *pool)
+{
+    while (atomic_flag_test_and_set_explicit(&pool->lock, memory_order_acquire));
+}
+
+static void sfPool_unlock(sfPool *pool)
+{
+    atomic_flag_clear_explicit(&pool->lock, memory_order_release);
+}
+
+////////////////////////////////////////////////////////////
+/// Number of blocks of a chunk, a chunk holds at least one
+////////////////////////////////////////////////////////////
+static size_t sfPool_chunkBlocks(const sfPool *pool)
+{
+    return (pool->blocksPerChunk > 0 ? pool->blocksPerChunk : 1);
+}
+
+////////////////////////////////////////////////////////////
+/// Add a chunk to a pool, the pool must be locked
+////////////////////////////////////////////////////////////
+static sfBool sfPool_grow(sfPool *pool)
+{
+    size_t blockSize = SF_ALLOCATOR_ALIGN(pool->blockSize < sizeof(void *) ? sizeof(void *) : pool->blockSize);
+    size_t header = SF_ALLOCATOR_ALIGN(sizeof(void *));
+    sfUint8 *chunk = sfAllocator_malloc(header + blockSize * sfPool_chunkBlocks(pool));
+    void **block = NULL;
+
+    if (chunk == NULL)
+        return (sfFalse);
+    *(void **)chunk = pool->chunks;
+    pool->chunks = chunk;
+    for (size_t i = sfPool_chunkBlocks(pool); i-- > 0;) {
+        block = (void **)(chunk + header + i * blockSize);
+        *block = pool->freeList;
+        pool->freeList = block;
+    }
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void *sfPool_allocate(sfPool *pool)
+{
+    void *block = NULL;
+
+    if (pool == NULL)
+        return (NULL);
+    sfPool_lock(pool);
+    if (pool->freeList != NULL || sfPool_grow(pool)) {
+        block = pool->freeList;
+        pool->freeList = *(void **)block;
+    }
+    sfPool_unlock(pool);
+    return (block);
+}
+
+////////////////////////////////////////////////////////////
+void sfPool_free(sfPool *pool, void *block)
+{
+    if (pool == NULL || block == NULL)
+        return;
+    sfPool_lock(pool);
+    *(void **)block = pool->freeList;
+    pool->freeList = block;
+    sfPool_unlock(pool);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfPool_reserve(sfPool *pool, size_t count)
+{
+    size_t available = 0;
+    sfBool success = sfTrue;
+
+    if (pool == NULL)
+        return (sfFalse);
+    sfPool_lock(pool);
+    for (void *block = pool->freeList; block != NULL && available < count; block = *(void **)block)
+        available++;
+    for (; available < count && success; available += sfPool_chunkBlocks(pool))
+        success = sfPool_grow(pool);
+    sfPool_unlock(pool);
+    return (success);
+}
+
+////////////////////////////////////////////////////////////
+void sfPool_clear(sfPool *pool)
+{
+    void *next = NULL;
+
+    if (pool == NULL)
+        return;
+    sfPool_lock(pool);
+    for (void *chunk = pool->chunks; chunk != NULL; chunk = next) {
+        next = *(void **)chunk;
+        sfAllocator_free(chunk);
+    }
+    pool->chunks = NULL;
+    pool->freeList = NULL;
+    sfPool_unlock(pool);
+}
+
+////////////////////////////////////////////////////////////
+sfArena *sfArena_create(size_t size)
+{
+    sfArena *arena = sfAllocator_malloc(sizeof(sfArena));
+
+    if (arena == NULL)
+        return (NULL);
+    arena->memory = sfAllocator_malloc(size);
+    if (arena->memory == NULL) {
+        sfAllocator_free(arena);
+        return (NULL);
+    }
+    arena->size = size;
+    arena->offset = 0;
+    arena->peak = 0;
+    return (arena);
+}
+
+////////////////////////////////////////////////////////////
+void sfArena_destroy(sfArena *arena)
+{
+    if (arena == NULL)
+        return;
+    if (sfAllocator_frameArena == arena)
+        sfAllocator_frameArena = NULL;
+    sfAllocator_free(arena->memory);
+    sfAllocator_free(arena);
+}
+
+////////////////////////////////////////////////////////////
+void *sfArena_allocate(sfArena *arena, size_t size)
+{
+    size_t offset = 0;
+
+    if (arena == NULL)
+        return (NULL);
+    offset = SF_ALLOCATOR_ALIGN(arena->offset);
+    if (offset > arena->size || size > arena->size - offset)
+        return (NULL);
+    arena->offset = offset + size;
+    if (arena->offset > arena->peak)
+        arena->peak = arena->offset;
+    return (arena->memory + offset);
+}
+
+////////////////////////////////////////////////////////////
+void sfArena_reset(sfArena *arena)
+{
+    if (arena == NULL)
+        return;
+    arena->offset = 0;
+}
+
+////////////////////////////////////////////////////////////
+size_t sfArena_getOffset(const sfArena *arena)
+{
+    if (arena == NULL)
+        return (0);
+    return (arena->offset);
+}
+
+////////////////////////////////////////////////////////////
+void sfArena_rewind(sfArena *arena, size_t offset)
+{
+    if (arena == NULL || offset > arena->offset)
+        return;
+    arena->offset = offset;
+}
@@ -25,26 +25,53 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <math.h>
+#include <SFML/Addition/Allocator.h>
 #include <SFML/Addition/AnimatedSprite.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+static sfPool sfAnimatedSprite_pool = SF_POOL_INIT(sizeof(sfAnimatedSprite), 64);
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_reserve(size_t count)
+{
+    return (sfPool_reserve(&sfAnimatedSprite_pool, count));
+}
 
 ////////////////////////////////////////////////////////////
 sfAnimatedSprite *sfAnimatedSprite_create(void)
 {
-    sfAnimatedSprite *animatedSprite = malloc(sizeof(sfAnimatedSprite));
+    sfAnimatedSprite *animatedSprite = sfPool_allocate(&sfAnimatedSprite_pool);
 
     if (animatedSprite == NULL)
         return (NULL);
     animatedSprite->clock = sfClock_create();
     animatedSprite->currentFrame = 0;
+    animatedSprite->maxFrame = 1;
+    animatedSprite->frameSize = (sfVector2u){0, 0};
+    animatedSprite->gridSize = (sfVector2u){1, 1};
     animatedSprite->frameRate = 0;
+    animatedSprite->frameRateDenominator = 1;
+    animatedSprite->elapsed = 0;
+    animatedSprite->fixedStep = 0;
+    animatedSprite->frameEnds = NULL;
+    animatedSprite->frameEndCount = 0;
+    animatedSprite->sheetFrames = NULL;
+    animatedSprite->sheetFrameCount = 0;
     animatedSprite->texture = NULL;
+    animatedSprite->hitMask = NULL;
+    animatedSprite->lodTextures = NULL;
+    animatedSprite->lodCount = 0;
+    animatedSprite->lodTick = 0;
+    animatedSprite->lodSkipped = 0;
     animatedSprite->sprite = sfSprite_create();
     if (animatedSprite->clock == NULL || animatedSprite->sprite == NULL) {
         if (animatedSprite->clock)
             sfClock_destroy(animatedSprite->clock);
         if (animatedSprite->sprite)
             sfSprite_destroy(animatedSprite->sprite);
-        free(animatedSprite);
+        sfPool_free(&sfAnimatedSprite_pool, animatedSprite);
         return (NULL);
     }
     return (animatedSprite);
@@ -59,8 +86,7 @@ sfAnimatedSprite *sfAnimatedSprite_createFromFile(const char *filename, const sf
         return (NULL);
     animatedSprite->texture = sfTexture_createFromFile(filename, area);
     if (animatedSprite->texture == NULL) {
-        sfClock_destroy(animatedSprite->clock);
-        free(animatedSprite);
+        sfAnimatedSprite_destroy(animatedSprite);
         return (NULL);
     }
     sfSprite_setTexture(animatedSprite->sprite, animatedSprite->texture, sfTrue);
@@ -77,7 +103,8 @@ sfAnimatedSprite *sfAnimatedSprite_createFromAnimation(sfAnimation animation)
     animatedSprite->frameRate = animation.frameRate;
     animatedSprite->frameSize = animation.frameSize;
     animatedSprite->maxFrame = animation.maxFrame;
-    animatedSprite->gridSize = animatedSprite->gridSize;
+    animatedSprite->gridSize = animation.gridSize;
+    sfAnimatedSprite_seek(animatedSprite, sfMicroseconds(0));
     return (animatedSprite);
 }
 
@@ -88,9 +115,14 @@ void sfAnimatedSprite_destroy(sfAnimatedSprite *animatedSprite)
         return;
     if (animatedSprite->texture)
         sfTexture_destroy(animatedSprite->texture);
+    sfHitMask_destroy(animatedSprite->hitMask);
+    for (size_t i = 0; i < animatedSprite->lodCount; i++)
+        sfTexture_destroy(animatedSprite->lodTextures[i]);
+    sfAllocator_free(animatedSprite->lodTextures);
+    sfAllocator_free(animatedSprite->frameEnds);
     sfSprite_destroy(animatedSprite->sprite);
     sfClock_destroy(animatedSprite->clock);
-    free(animatedSprite);
+    sfPool_free(&sfAnimatedSprite_pool, animatedSprite);
 }
 
 ////////////////////////////////////////////////////////////
@@ -228,17 +260,130 @@ sfColor sfAnimatedSprite_getColor(const sfAnimatedSprite *animatedSprite)
 ////////////////////////////////////////////////////////////
 sfFloatRect sfAnimatedSprite_getLocalBounds(const sfAnimatedSprite *animatedSprite)
 {
+    sfVertex quad[4];
+
     if (animatedSprite == NULL)
         return ((sfFloatRect){0, 0, 0, 0});
-    return (sfSprite_getLocalBounds(animatedSprite->sprite));
+    sfAnimatedSprite_getVertices(animatedSprite, quad);
+    return ((sfFloatRect){quad[0].position.x, quad[0].position.y,
+        quad[2].position.x - quad[0].position.x, quad[2].position.y - quad[0].position.y});
 }
 
 ////////////////////////////////////////////////////////////
 sfFloatRect sfAnimatedSprite_getGlobalBounds(const sfAnimatedSprite *animatedSprite)
 {
+    sfTransform transform;
+
     if (animatedSprite == NULL)
         return ((sfFloatRect){0, 0, 0, 0});
-    return (sfSprite_getGlobalBounds(animatedSprite->sprite));
+    transform = sfSprite_getTransform(animatedSprite->sprite);
+    return (sfTransform_transformRect(&transform, sfAnimatedSprite_getLocalBounds(animatedSprite)));
+}
+
+////////////////////////////////////////////////////////////
+/// Number of frames the animation loops over
+////////////////////////////////////////////////////////////
+static size_t sfAnimatedSprite_frameCount(const sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite->frameEnds != NULL)
+        return (animatedSprite->frameEndCount);
+    return (animatedSprite->maxFrame);
+}
+
+////////////////////////////////////////////////////////////
+/// Duration of a whole loop in microseconds, 0 if the
+/// animation does not move
+////////////////////////////////////////////////////////////
+static sfInt64 sfAnimatedSprite_loopDuration(const sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite->frameEnds != NULL)
+        return (animatedSprite->frameEnds[animatedSprite->frameEndCount - 1]);
+    if (animatedSprite->frameRate == 0 || animatedSprite->maxFrame == 0)
+        return (0);
+    // frameRate loops last exactly maxFrame * denominator seconds
+    return ((sfInt64)animatedSprite->maxFrame * animatedSprite->frameRateDenominator * 1000000);
+}
+
+////////////////////////////////////////////////////////////
+/// Index of the frame shown at a time, in microseconds
+////////////////////////////////////////////////////////////
+static size_t sfAnimatedSprite_frameAt(const sfAnimatedSprite *animatedSprite, sfInt64 time)
+{
+    sfInt64 loop = sfAnimatedSprite_loopDuration(animatedSprite);
+    sfUint64 period = 0;
+    sfUint64 frames = 0;
+    size_t low = 0;
+    size_t high = 0;
+
+    if (loop <= 0)
+        return (animatedSprite->currentFrame);
+    time %= loop;
+    if (time < 0)
+        time += loop;
+    if (animatedSprite->frameEnds != NULL) {
+        high = animatedSprite->frameEndCount - 1;
+        while (low < high) {
+            if (animatedSprite->frameEnds[(low + high) / 2] > time)
+                high = (low + high) / 2;
+            else
+                low = (low + high) / 2 + 1;
+        }
+        return (low);
+    }
+    // frameRate frames every period, split to keep the product in 64 bits
+    period = (sfUint64)animatedSprite->frameRateDenominator * 1000000;
+    frames = ((sfUint64)time / period) * animatedSprite->frameRate +
+        ((sfUint64)time % period) * animatedSprite->frameRate / period;
+    return ((size_t)(frames % animatedSprite->maxFrame));
+}
+
+////////////////////////////////////////////////////////////
+/// Time at which a frame starts, in microseconds
+////////////////////////////////////////////////////////////
+static sfInt64 sfAnimatedSprite_frameStart(const sfAnimatedSprite *animatedSprite, size_t frame)
+{
+    sfUint64 period = (sfUint64)animatedSprite->frameRateDenominator * 1000000;
+
+    if (animatedSprite->frameEnds != NULL)
+        return (frame == 0 || frame > animatedSprite->frameEndCount ? 0 : animatedSprite->frameEnds[frame - 1]);
+    if (animatedSprite->frameRate == 0)
+        return (0);
+    return ((sfInt64)((frame * period + animatedSprite->frameRate - 1) / animatedSprite->frameRate));
+}
+
+////////////////////////////////////////////////////////////
+/// Show the frame of the current time
+////////////////////////////////////////////////////////////
+static void sfAnimatedSprite_applyFrame(sfAnimatedSprite *animatedSprite)
+{
+    size_t frame = sfAnimatedSprite_frameAt(animatedSprite, animatedSprite->elapsed);
+    size_t columns = animatedSprite->gridSize.x > 0 ? animatedSprite->gridSize.x : 1;
+    sfIntRect mask = {0, 0, animatedSprite->frameSize.x, animatedSprite->frameSize.y};
+
+    if (frame != animatedSprite->currentFrame)
+        SF_PROFILE_COUNT(textureRectChanges, 1);
+    animatedSprite->currentFrame = frame;
+    if (animatedSprite->sheetFrames != NULL) {
+        if (frame >= animatedSprite->sheetFrameCount)
+            animatedSprite->currentFrame = frame = 0;
+        sfSprite_setTextureRect(animatedSprite->sprite, animatedSprite->sheetFrames[frame].rect);
+        return;
+    }
+    if (animatedSprite->frameSize.x == 0 || animatedSprite->frameSize.y == 0)
+        return;
+    mask.left = (frame % columns) * animatedSprite->frameSize.x;
+    mask.top = (frame / columns) * animatedSprite->frameSize.y;
+    sfSprite_setTextureRect(animatedSprite->sprite, mask);
+}
+
+////////////////////////////////////////////////////////////
+/// Keep the current frame when the timing changes
+////////////////////////////////////////////////////////////
+static void sfAnimatedSprite_retime(sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite->currentFrame >= sfAnimatedSprite_frameCount(animatedSprite))
+        animatedSprite->currentFrame = 0;
+    animatedSprite->elapsed = sfAnimatedSprite_frameStart(animatedSprite, animatedSprite->currentFrame);
 }
 
 ////////////////////////////////////////////////////////////
@@ -247,6 +392,8 @@ void sfAnimatedSprite_setFrameRate(sfAnimatedSprite *animatedSprite, size_t fram
     if (animatedSprite == NULL)
         return;
     animatedSprite->frameRate = frameRate;
+    animatedSprite->frameRateDenominator = 1;
+    sfAnimatedSprite_retime(animatedSprite);
 }
 
 ////////////////////////////////////////////////////////////
@@ -257,6 +404,150 @@ size_t sfAnimatedSprite_getFrameRate(const sfAnimatedSprite *animatedSprite)
     return (animatedSprite->frameRate);
 }
 
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setFrameRateRatio(sfAnimatedSprite *animatedSprite, sfUint32 numerator, sfUint32 denominator)
+{
+    if (animatedSprite == NULL || denominator == 0 || (sfUint64)numerator * denominator >= ((sfUint64)1 << 43))
+        return (sfFalse);
+    animatedSprite->frameRate = numerator;
+    animatedSprite->frameRateDenominator = denominator;
+    sfAnimatedSprite_retime(animatedSprite);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setFrameDurations(sfAnimatedSprite *animatedSprite, const sfTime *durations, size_t count)
+{
+    sfInt64 *frameEnds = NULL;
+    sfInt64 end = 0;
+
+    if (animatedSprite == NULL)
+        return (sfFalse);
+    if (durations != NULL && count > 0) {
+        frameEnds = sfAllocator_malloc(count * sizeof(sfInt64));
+        if (frameEnds == NULL)
+            return (sfFalse);
+        for (size_t i = 0; i < count; i++) {
+            end += durations[i].microseconds > 0 ? durations[i].microseconds : 0;
+            frameEnds[i] = end;
+        }
+    }
+    sfAllocator_free(animatedSprite->frameEnds);
+    animatedSprite->frameEnds = frameEnds;
+    animatedSprite->frameEndCount = frameEnds != NULL ? count : 0;
+    sfAnimatedSprite_retime(animatedSprite);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_setSpriteSheet(sfAnimatedSprite *animatedSprite, const sfSpriteSheet *spriteSheet, const char *tag)
+{
+    const sfSpriteSheetTag *range = NULL;
+    size_t from = 0;
+    size_t count = 0;
+    sfInt64 *frameEnds = NULL;
+    sfInt64 end = 0;
+
+    if (animatedSprite == NULL)
+        return (sfFalse);
+    if (spriteSheet != NULL) {
+        range = tag != NULL ? sfSpriteSheet_getTag(spriteSheet, tag) : NULL;
+        if ((tag != NULL && range == NULL) || spriteSheet->frameCount == 0)
+            return (sfFalse);
+        from = range != NULL ? range->from : 0;
+        count = range != NULL ? range->to - range->from + 1 : spriteSheet->frameCount;
+        for (size_t i = 0; i < count && end == 0; i++)
+            end = spriteSheet->frames[from + i].duration;
+    }
+    if (end > 0) {
+        frameEnds = sfAllocator_malloc(count * sizeof(sfInt64));
+        if (frameEnds == NULL)
+            return (sfFalse);
+        end = 0;
+        for (size_t i = 0; i < count; i++) {
+            end += spriteSheet->frames[from + i].duration > 0 ? spriteSheet->frames[from + i].duration : 0;
+            frameEnds[i] = end;
+        }
+    }
+    sfAllocator_free(animatedSprite->frameEnds);
+    animatedSprite->frameEnds = frameEnds;
+    animatedSprite->frameEndCount = frameEnds != NULL ? count : 0;
+    animatedSprite->sheetFrames = spriteSheet != NULL ? &spriteSheet->frames[from] : NULL;
+    animatedSprite->sheetFrameCount = count;
+    if (spriteSheet != NULL)
+        animatedSprite->maxFrame = count;
+    animatedSprite->currentFrame = 0;
+    sfAnimatedSprite_seek(animatedSprite, sfMicroseconds(0));
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_setMaxFrame(sfAnimatedSprite *animatedSprite, size_t maxFrame)
+{
+    if (animatedSprite == NULL)
+        return;
+    animatedSprite->maxFrame = maxFrame;
+    sfAnimatedSprite_retime(animatedSprite);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSprite_getMaxFrame(const sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite == NULL)
+        return (0);
+    return (animatedSprite->maxFrame);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_setFixedStep(sfAnimatedSprite *animatedSprite, sfTime step)
+{
+    if (animatedSprite == NULL)
+        return;
+    animatedSprite->fixedStep = step.microseconds > 0 ? step.microseconds : 0;
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_advance(sfAnimatedSprite *animatedSprite, sfTime elapsed)
+{
+    sfInt64 loop = 0;
+
+    if (animatedSprite == NULL)
+        return;
+    loop = sfAnimatedSprite_loopDuration(animatedSprite);
+    animatedSprite->elapsed += elapsed.microseconds;
+    if (loop > 0) {
+        animatedSprite->elapsed %= loop;
+        if (animatedSprite->elapsed < 0)
+            animatedSprite->elapsed += loop;
+    }
+    sfAnimatedSprite_applyFrame(animatedSprite);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_seek(sfAnimatedSprite *animatedSprite, sfTime time)
+{
+    if (animatedSprite == NULL)
+        return;
+    animatedSprite->elapsed = 0;
+    sfAnimatedSprite_advance(animatedSprite, time);
+}
+
+////////////////////////////////////////////////////////////
+sfTime sfAnimatedSprite_getElapsedTime(const sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite == NULL)
+        return (sfMicroseconds(0));
+    return ((sfTime){animatedSprite->elapsed});
+}
+
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSprite_getFrameAt(const sfAnimatedSprite *animatedSprite, sfTime time)
+{
+    if (animatedSprite == NULL)
+        return (0);
+    return (sfAnimatedSprite_frameAt(animatedSprite, time.microseconds));
+}
+
 ////////////////////////////////////////////////////////////
 void sfAnimatedSprite_setFrameSize(sfAnimatedSprite *animatedSprite, sfVector2u frameRate)
 {
@@ -290,20 +581,262 @@ sfVector2u sfAnimatedSprite_getGridSize(const sfAnimatedSprite *animatedSprite)
 }
 
 ////////////////////////////////////////////////////////////
-void sfRenderWindow_drawAnimatedSprite(const sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfRenderStates *states)
+/// Halve the resolution of an image with a box filter
+////////////////////////////////////////////////////////////
+static sfImage *sfAnimatedSprite_downsample(const sfImage *image)
+{
+    sfVector2u size = sfImage_getSize(image);
+    sfVector2u half = {size.x > 1 ? size.x / 2 : 1, size.y > 1 ? size.y / 2 : 1};
+    const sfUint8 *source = sfImage_getPixelsPtr(image);
+    sfUint8 *pixels = sfAllocator_malloc((size_t)half.x * half.y * 4);
+    sfImage *result = NULL;
+    unsigned int x0, y0, x1, y1;
+
+    if (pixels == NULL)
+        return (NULL);
+    for (unsigned int y = 0; y < half.y; y++) {
+        y0 = y * 2 < size.y ? y * 2 : size.y - 1;
+        y1 = y * 2 + 1 < size.y ? y * 2 + 1 : y0;
+        for (unsigned int x = 0; x < half.x; x++) {
+            x0 = x * 2 < size.x ? x * 2 : size.x - 1;
+            x1 = x * 2 + 1 < size.x ? x * 2 + 1 : x0;
+            for (unsigned int c = 0; c < 4; c++) {
+                pixels[((size_t)y * half.x + x) * 4 + c] = (source[((size_t)y0 * size.x + x0) * 4 + c] +
+                    source[((size_t)y0 * size.x + x1) * 4 + c] + source[((size_t)y1 * size.x + x0) * 4 + c] +
+                    source[((size_t)y1 * size.x + x1) * 4 + c] + 2) / 4;
+            }
+        }
+    }
+    result = sfImage_createFromPixels(half.x, half.y, pixels);
+    sfAllocator_free(pixels);
+    return (result);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_createLodTextures(sfAnimatedSprite *animatedSprite, size_t levelCount)
 {
-    int fps = ((int)((float)(60 / animatedSprite->frameRate)) * 10);
-    int ms = sfClock_getElapsedTime(animatedSprite->clock).microseconds * 1000;
-    sfIntRect mask = {0, 0, animatedSprite->frameSize.x, animatedSprite->frameSize.y};
+    const sfTexture *texture = NULL;
+    sfImage *image = NULL;
+    sfImage *reduced = NULL;
 
-    if (ms >= fps) {
-        animatedSprite->currentFrame++;
-        sfClock_restart(animatedSprite->clock);
+    if (animatedSprite == NULL)
+        return (sfFalse);
+    for (size_t i = 0; i < animatedSprite->lodCount; i++)
+        sfTexture_destroy(animatedSprite->lodTextures[i]);
+    sfAllocator_free(animatedSprite->lodTextures);
+    animatedSprite->lodTextures = NULL;
+    animatedSprite->lodCount = 0;
+    texture = sfSprite_getTexture(animatedSprite->sprite);
+    if (texture == NULL || levelCount == 0)
+        return (texture != NULL);
+    animatedSprite->lodTextures = sfAllocator_calloc(levelCount, sizeof(sfTexture *));
+    image = sfTexture_copyToImage(texture);
+    if (animatedSprite->lodTextures == NULL || image == NULL) {
+        if (image)
+            sfImage_destroy(image);
+        return (sfFalse);
     }
-    if (animatedSprite->currentFrame == animatedSprite->maxFrame)
-        animatedSprite->currentFrame = 0;
-    mask.left = (animatedSprite->currentFrame % animatedSprite->gridSize.x) * animatedSprite->frameSize.x;
-    mask.top = (animatedSprite->currentFrame / animatedSprite->gridSize.y) * animatedSprite->frameSize.y;
-    sfSprite_setTextureRect(animatedSprite->sprite, mask);
-    sfRenderWindow_drawSprite(renderWindow, animatedSprite->sprite, states);
+    while (animatedSprite->lodCount < levelCount) {
+        reduced = sfAnimatedSprite_downsample(image);
+        sfImage_destroy(image);
+        image = reduced;
+        if (image == NULL)
+            return (sfFalse);
+        animatedSprite->lodTextures[animatedSprite->lodCount] = sfTexture_createFromImage(image, NULL);
+        if (animatedSprite->lodTextures[animatedSprite->lodCount] == NULL)
+            break;
+        animatedSprite->lodCount++;
+    }
+    sfImage_destroy(image);
+    return (animatedSprite->lodCount == levelCount);
+}
+
+////////////////////////////////////////////////////////////
+const sfTexture *sfAnimatedSprite_getLodTexture(const sfAnimatedSprite *animatedSprite, size_t level)
+{
+    if (animatedSprite == NULL)
+        return (NULL);
+    if (level == 0 || animatedSprite->lodCount == 0)
+        return (sfSprite_getTexture(animatedSprite->sprite));
+    level = level > animatedSprite->lodCount ? animatedSprite->lodCount : level;
+    return (animatedSprite->lodTextures[level - 1]);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_createHitMask(sfAnimatedSprite *animatedSprite, sfUint8 alphaThreshold)
+{
+    if (animatedSprite == NULL)
+        return (sfFalse);
+    sfHitMask_destroy(animatedSprite->hitMask);
+    animatedSprite->hitMask = sfHitMask_createFromTexture(sfSprite_getTexture(animatedSprite->sprite), alphaThreshold);
+    return (animatedSprite->hitMask != NULL);
+}
+
+////////////////////////////////////////////////////////////
+const sfHitMask *sfAnimatedSprite_getHitMask(const sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite == NULL)
+        return (NULL);
+    return (animatedSprite->hitMask);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isPixelCollision(const sfAnimatedSprite *animatedSpriteA, const sfAnimatedSprite *animatedSpriteB)
+{
+    sfTransform transformA;
+    sfTransform transformB;
+    sfIntRect areaA;
+    sfIntRect areaB;
+
+    if (animatedSpriteA == NULL || animatedSpriteB == NULL)
+        return (sfFalse);
+    areaA = sfAnimatedSprite_getFrameArea(animatedSpriteA, &transformA);
+    areaB = sfAnimatedSprite_getFrameArea(animatedSpriteB, &transformB);
+    return (sfHitMask_intersects(animatedSpriteA->hitMask, areaA, &transformA, animatedSpriteB->hitMask, areaB, &transformB));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isPixelHit(const sfAnimatedSprite *animatedSprite, sfVector2f point)
+{
+    sfTransform inverse;
+    sfIntRect area;
+
+    if (animatedSprite == NULL || animatedSprite->hitMask == NULL)
+        return (sfFalse);
+    area = sfAnimatedSprite_getFrameArea(animatedSprite, &inverse);
+    inverse = sfTransform_getInverse(&inverse);
+    return (sfHitMask_containsLocalPoint(animatedSprite->hitMask, area, sfTransform_transformPoint(&inverse, point)));
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_update(sfAnimatedSprite *animatedSprite)
+{
+    sfTime elapsed = sfClock_restart(animatedSprite->clock);
+
+    SF_PROFILE_COUNT(animatedSpriteUpdates, 1);
+    if (animatedSprite->fixedStep > 0)
+        elapsed.microseconds = animatedSprite->fixedStep;
+    sfAnimatedSprite_advance(animatedSprite, elapsed);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSprite_getVertices(const sfAnimatedSprite *animatedSprite, sfVertex vertices[4])
+{
+    const sfSpriteSheetFrame *frame = NULL;
+    sfIntRect rect;
+    sfVector2f offset = {0, 0};
+    sfColor color;
+    float x, y, w, h;
+
+    if (animatedSprite == NULL || vertices == NULL)
+        return;
+    color = sfSprite_getColor(animatedSprite->sprite);
+    rect = sfSprite_getTextureRect(animatedSprite->sprite);
+    if (animatedSprite->sheetFrames != NULL) {
+        frame = &animatedSprite->sheetFrames[animatedSprite->currentFrame];
+        rect = frame->rect;
+        offset = frame->offset;
+    }
+    x = rect.left;
+    y = rect.top;
+    w = rect.width;
+    h = rect.height;
+    vertices[0] = (sfVertex){{offset.x, offset.y}, color, {x, y}};
+    vertices[1] = (sfVertex){{offset.x + fabsf(w), offset.y}, color, {x + w, y}};
+    vertices[2] = (sfVertex){{offset.x + fabsf(w), offset.y + fabsf(h)}, color, {x + w, y + h}};
+    vertices[3] = (sfVertex){{offset.x, offset.y + fabsf(h)}, color, {x, y + h}};
+    // Rotated frames were turned clockwise, their top left corner is at the top right
+    if (frame != NULL && frame->rotated) {
+        vertices[0].texCoords = (sfVector2f){x + h, y};
+        vertices[1].texCoords = (sfVector2f){x + h, y + w};
+        vertices[2].texCoords = (sfVector2f){x, y + w};
+        vertices[3].texCoords = (sfVector2f){x, y};
+    }
+}
+
+////////////////////////////////////////////////////////////
+sfIntRect sfAnimatedSprite_getFrameArea(const sfAnimatedSprite *animatedSprite, sfTransform *transform)
+{
+    const sfSpriteSheetFrame *frame = NULL;
+    sfTransform placement = sfTransform_Identity;
+    sfIntRect area;
+
+    if (animatedSprite == NULL)
+        return ((sfIntRect){0, 0, 0, 0});
+    area = sfSprite_getTextureRect(animatedSprite->sprite);
+    if (animatedSprite->sheetFrames != NULL) {
+        frame = &animatedSprite->sheetFrames[animatedSprite->currentFrame];
+        area = frame->rect;
+        // Texel (a, b) of a frame turned clockwise is shown at (b, height - a)
+        if (frame->rotated) {
+            area = (sfIntRect){frame->rect.left, frame->rect.top, frame->rect.height, frame->rect.width};
+            placement = (sfTransform){{0, 1, frame->offset.x, -1, 0, frame->rect.height + frame->offset.y, 0, 0, 1}};
+        } else {
+            placement = (sfTransform){{1, 0, frame->offset.x, 0, 1, frame->offset.y, 0, 0, 1}};
+        }
+    }
+    if (transform != NULL) {
+        *transform = sfSprite_getTransform(animatedSprite->sprite);
+        sfTransform_combine(transform, &placement);
+    }
+    return (area);
+}
+
+////////////////////////////////////////////////////////////
+/// Quad and render states of the current frame of a sprite
+/// sheet, moved by its trim offset and turned back when it
+/// was rotated
+////////////////////////////////////////////////////////////
+static void sfAnimatedSprite_getFrameQuad(const sfAnimatedSprite *animatedSprite, const sfRenderStates *states, sfVertex quad[4], sfRenderStates *frameStates)
+{
+    sfTransform transform = sfSprite_getTransform(animatedSprite->sprite);
+
+    sfAnimatedSprite_getVertices(animatedSprite, quad);
+    *frameStates = (sfRenderStates){sfBlendAlpha, sfTransform_Identity, NULL, NULL};
+    if (states != NULL)
+        *frameStates = *states;
+    sfTransform_combine(&frameStates->transform, &transform);
+    frameStates->texture = sfSprite_getTexture(animatedSprite->sprite);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpriteFrame(sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, const sfRenderStates *states)
+{
+    sfRenderStates frameStates;
+    sfVertex quad[4];
+
+    if (animatedSprite == NULL)
+        return;
+    if (animatedSprite->sheetFrames == NULL) {
+        sfRenderWindow_drawSprite(renderWindow, animatedSprite->sprite, states);
+        return;
+    }
+    sfAnimatedSprite_getFrameQuad(animatedSprite, states, quad, &frameStates);
+    sfRenderWindow_drawPrimitives(renderWindow, quad, 4, sfQuads, &frameStates);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawAnimatedSpriteFrame(sfRenderTexture *renderTexture, const sfAnimatedSprite *animatedSprite, const sfRenderStates *states)
+{
+    sfRenderStates frameStates;
+    sfVertex quad[4];
+
+    if (animatedSprite == NULL)
+        return;
+    if (animatedSprite->sheetFrames == NULL) {
+        sfRenderTexture_drawSprite(renderTexture, animatedSprite->sprite, states);
+        return;
+    }
+    sfAnimatedSprite_getFrameQuad(animatedSprite, states, quad, &frameStates);
+    sfRenderTexture_drawPrimitives(renderTexture, quad, 4, sfQuads, &frameStates);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSprite(sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfRenderStates *states)
+{
+    SF_PROFILE_BEGIN(drawAnimatedSprite);
+    SF_PROFILE_COUNT(animatedSpriteDraws, 1);
+    sfAnimatedSprite_update(animatedSprite);
+    sfRenderWindow_drawAnimatedSpriteFrame(renderWindow, animatedSprite, states);
+    SF_PROFILE_END(drawAnimatedSprite, animatedSpriteDrawTime);
 }
@@ -0,0 +1,277 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/AnimatedSpritePool.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+/// End of the free list
+////////////////////////////////////////////////////////////
+#define SF_ANIMATEDSPRITEPOOL_NO_SLOT ((sfUint32)-1)
+
+////////////////////////////////////////////////////////////
+/// Split a handle in slot and generation
+////////////////////////////////////////////////////////////
+#define SF_HANDLE_SLOT(handle) ((sfUint32)((handle) & 0xFFFFFFFF))
+#define SF_HANDLE_GENERATION(handle) ((sfUint32)((handle) >> 32))
+
+////////////////////////////////////////////////////////////
+/// Live slots have an odd generation, free slots an even one
+////////////////////////////////////////////////////////////
+#define SF_GENERATION_IS_LIVE(generation) (((generation) & 1) != 0)
+
+////////////////////////////////////////////////////////////
+/// Get the slot of a live handle, or SF_ANIMATEDSPRITEPOOL_NO_SLOT if it is stale
+////////////////////////////////////////////////////////////
+static sfUint32 sfAnimatedSpritePool_findSlot(const sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle)
+{
+    sfUint32 slot = SF_HANDLE_SLOT(handle);
+
+    if (pool == NULL || slot >= pool->capacity)
+        return (SF_ANIMATEDSPRITEPOOL_NO_SLOT);
+    if (!SF_GENERATION_IS_LIVE(pool->slots[slot].generation))
+        return (SF_ANIMATEDSPRITEPOOL_NO_SLOT);
+    if (pool->slots[slot].generation != SF_HANDLE_GENERATION(handle))
+        return (SF_ANIMATEDSPRITEPOOL_NO_SLOT);
+    return (slot);
+}
+
+////////////////////////////////////////////////////////////
+sfAnimatedSpritePool *sfAnimatedSpritePool_create(size_t capacity, const sfTexture *texture, sfVector2u frameSize, sfVector2u gridSize, size_t frameRate)
+{
+    sfAnimatedSpritePool *pool = sfAllocator_calloc(1, sizeof(sfAnimatedSpritePool));
+
+    if (pool == NULL)
+        return (NULL);
+    pool->freeSlot = SF_ANIMATEDSPRITEPOOL_NO_SLOT;
+    pool->texture = texture;
+    pool->frameSize = frameSize;
+    pool->gridSize = gridSize;
+    pool->frameRate = frameRate;
+    pool->clock = sfClock_create();
+    if (pool->clock == NULL || !sfAnimatedSpritePool_reserve(pool, capacity)) {
+        sfAnimatedSpritePool_destroy(pool);
+        return (NULL);
+    }
+    return (pool);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_destroy(sfAnimatedSpritePool *pool)
+{
+    if (pool == NULL)
+        return;
+    if (pool->clock)
+        sfClock_destroy(pool->clock);
+    sfAllocator_free(pool->instances);
+    sfAllocator_free(pool->owners);
+    sfAllocator_free(pool->slots);
+    sfAllocator_free(pool->vertices);
+    sfAllocator_free(pool);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_reserve(sfAnimatedSpritePool *pool, size_t capacity)
+{
+    sfAnimatedSpriteInstance *instances = NULL;
+    sfUint32 *owners = NULL;
+    sfAnimatedSpriteSlot *slots = NULL;
+    sfVertex *vertices = NULL;
+
+    if (pool == NULL || capacity >= SF_ANIMATEDSPRITEPOOL_NO_SLOT)
+        return (sfFalse);
+    if (capacity <= pool->capacity)
+        return (sfTrue);
+    instances = sfAllocator_realloc(pool->instances, capacity * sizeof(sfAnimatedSpriteInstance));
+    if (instances != NULL)
+        pool->instances = instances;
+    owners = sfAllocator_realloc(pool->owners, capacity * sizeof(sfUint32));
+    if (owners != NULL)
+        pool->owners = owners;
+    slots = sfAllocator_realloc(pool->slots, capacity * sizeof(sfAnimatedSpriteSlot));
+    if (slots != NULL)
+        pool->slots = slots;
+    vertices = sfAllocator_realloc(pool->vertices, capacity * 4 * sizeof(sfVertex));
+    if (vertices != NULL)
+        pool->vertices = vertices;
+    if (instances == NULL || owners == NULL || slots == NULL || vertices == NULL)
+        return (sfFalse);
+    for (size_t i = pool->capacity; i < capacity; i++) {
+        slots[i].generation = 0;
+        slots[i].index = i + 1 < capacity ? (sfUint32)(i + 1) : pool->freeSlot;
+    }
+    pool->freeSlot = (sfUint32)pool->capacity;
+    pool->capacity = capacity;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfAnimatedSpriteHandle sfAnimatedSpritePool_spawn(sfAnimatedSpritePool *pool, sfVector2f position)
+{
+    sfAnimatedSpriteSlot *slot = NULL;
+    sfUint32 index = 0;
+
+    if (pool == NULL)
+        return (SF_ANIMATEDSPRITEHANDLE_INVALID);
+    if (pool->freeSlot == SF_ANIMATEDSPRITEPOOL_NO_SLOT && !sfAnimatedSpritePool_reserve(pool, pool->capacity ? pool->capacity * 2 : 16))
+        return (SF_ANIMATEDSPRITEHANDLE_INVALID);
+    index = pool->freeSlot;
+    slot = &pool->slots[index];
+    pool->freeSlot = slot->index;
+    slot->generation++;
+    slot->index = (sfUint32)pool->count;
+    pool->owners[pool->count] = index;
+    pool->instances[pool->count++] = (sfAnimatedSpriteInstance){
+        position, {0, 0}, {1, 1}, 0, sfWhite, 0, pool->gridSize.x * pool->gridSize.y, pool->frameRate, 0
+    };
+    return (((sfAnimatedSpriteHandle)slot->generation << 32) | index);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_despawn(sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle)
+{
+    sfUint32 index = sfAnimatedSpritePool_findSlot(pool, handle);
+    sfAnimatedSpriteSlot *slot = NULL;
+    sfUint32 last = 0;
+
+    if (index == SF_ANIMATEDSPRITEPOOL_NO_SLOT)
+        return (sfFalse);
+    slot = &pool->slots[index];
+    last = (sfUint32)--pool->count;
+    if (slot->index != last) {
+        pool->instances[slot->index] = pool->instances[last];
+        pool->owners[slot->index] = pool->owners[last];
+        pool->slots[pool->owners[last]].index = slot->index;
+    }
+    // Back to even, wrapping from 0xFFFFFFFF to 0 keeps the parity
+    slot->generation++;
+    slot->index = pool->freeSlot;
+    pool->freeSlot = index;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSpritePool_isAlive(const sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle)
+{
+    return (sfAnimatedSpritePool_findSlot(pool, handle) != SF_ANIMATEDSPRITEPOOL_NO_SLOT);
+}
+
+////////////////////////////////////////////////////////////
+sfAnimatedSpriteInstance *sfAnimatedSpritePool_get(sfAnimatedSpritePool *pool, sfAnimatedSpriteHandle handle)
+{
+    sfUint32 index = sfAnimatedSpritePool_findSlot(pool, handle);
+
+    if (index == SF_ANIMATEDSPRITEPOOL_NO_SLOT)
+        return (NULL);
+    return (&pool->instances[pool->slots[index].index]);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfAnimatedSpritePool_getCount(const sfAnimatedSpritePool *pool)
+{
+    if (pool == NULL)
+        return (0);
+    return (pool->count);
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_advance(sfAnimatedSpritePool *pool, sfTime elapsed)
+{
+    sfAnimatedSpriteInstance *instance = NULL;
+    sfInt64 frames = 0;
+
+    if (pool == NULL || elapsed.microseconds <= 0)
+        return;
+    SF_PROFILE_COUNT(animatedSpriteUpdates, pool->count);
+    for (size_t i = 0; i < pool->count; i++) {
+        instance = &pool->instances[i];
+        if (instance->frameRate == 0 || instance->maxFrame == 0)
+            continue;
+        // A frame every 1000000 of elapsed time times frame rate, no rounding drift
+        instance->elapsed += elapsed.microseconds * (sfInt64)instance->frameRate;
+        if (instance->elapsed < 1000000)
+            continue;
+        frames = instance->elapsed / 1000000;
+        instance->elapsed %= 1000000;
+        instance->currentFrame = (instance->currentFrame + frames) % instance->maxFrame;
+        SF_PROFILE_COUNT(textureRectChanges, 1);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfAnimatedSpritePool_update(sfAnimatedSpritePool *pool)
+{
+    if (pool == NULL)
+        return;
+    sfAnimatedSpritePool_advance(pool, sfClock_restart(pool->clock));
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpritePool(sfRenderWindow *renderWindow, sfAnimatedSpritePool *pool, const sfRenderStates *states)
+{
+    sfRenderStates poolStates = {sfBlendAlpha, sfTransform_Identity, NULL, NULL};
+    const sfAnimatedSpriteInstance *instance = NULL;
+    sfVertex *quad = NULL;
+    float width = 0;
+    float height = 0;
+    unsigned int columns = 0;
+    float angle, cosine, sine, sxc, syc, sxs, sys, tx, ty, u, v;
+
+    if (pool == NULL || pool->count == 0)
+        return;
+    SF_PROFILE_BEGIN(drawAnimatedSpritePool);
+    SF_PROFILE_COUNT(animatedSpriteDraws, pool->count);
+    width = pool->frameSize.x;
+    height = pool->frameSize.y;
+    columns = pool->gridSize.x ? pool->gridSize.x : 1;
+    for (size_t i = 0; i < pool->count; i++) {
+        instance = &pool->instances[i];
+        quad = &pool->vertices[i * 4];
+        angle = -instance->rotation * 3.141592654f / 180.f;
+        cosine = cosf(angle);
+        sine = sinf(angle);
+        sxc = instance->scale.x * cosine;
+        syc = instance->scale.y * cosine;
+        sxs = instance->scale.x * sine;
+        sys = instance->scale.y * sine;
+        tx = -instance->origin.x * sxc - instance->origin.y * sys + instance->position.x;
+        ty = instance->origin.x * sxs - instance->origin.y * syc + instance->position.y;
+        u = (instance->currentFrame % columns) * width;
+        v = (instance->currentFrame / columns) * height;
+        quad[0] = (sfVertex){{tx, ty}, instance->color, {u, v}};
+        quad[1] = (sfVertex){{sxc * width + tx, -sxs * width + ty}, instance->color, {u + width, v}};
+        quad[2] = (sfVertex){{sxc * width + sys * height + tx, -sxs * width + syc * height + ty}, instance->color, {u + width, v + height}};
+        quad[3] = (sfVertex){{sys * height + tx, syc * height + ty}, instance->color, {u, v + height}};
+    }
+    if (states != NULL)
+        poolStates = *states;
+    poolStates.texture = pool->texture;
+    sfRenderWindow_drawPrimitives(renderWindow, pool->vertices, pool->count * 4, sfQuads, &poolStates);
+    SF_PROFILE_END(drawAnimatedSpritePool, animatedSpriteDrawTime);
+}
@@ -25,18 +25,37 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <math.h>
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
 #include <SFML/Addition/BezierCurve.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+/// Curves up to this number of points are evaluated on the stack
+////////////////////////////////////////////////////////////
+#define SF_BEZIERCURVE_STACK_POINTS 16
+
+////////////////////////////////////////////////////////////
+static sfPool sfBezierCurve_pool = SF_POOL_INIT(sizeof(sfBezierCurve), 64);
+
+////////////////////////////////////////////////////////////
+sfBool sfBezierCurve_reserve(size_t count)
+{
+    return (sfPool_reserve(&sfBezierCurve_pool, count));
+}
 
 ////////////////////////////////////////////////////////////
 sfBezierCurve *sfBezierCurve_create(void)
 {
-    sfBezierCurve *bezierCurve = malloc(sizeof(sfBezierCurve));
+    sfBezierCurve *bezierCurve = sfPool_allocate(&sfBezierCurve_pool);
 
     if (!bezierCurve)
         return (bezierCurve);
     bezierCurve->color = sfTransparent;
     bezierCurve->pointCount = 0;
     bezierCurve->points = NULL;
+    bezierCurve->bounds = (sfFloatRect){0, 0, 0, 0};
     return (bezierCurve);
 }
 
@@ -45,8 +64,8 @@ void sfBezierCurve_destroy(sfBezierCurve *bezierCurve)
 {
     if (bezierCurve == NULL)
         return;
-    free(bezierCurve->points);
-    free(bezierCurve);
+    sfAllocator_free(bezierCurve->points);
+    sfPool_free(&sfBezierCurve_pool, bezierCurve);
 }
 
 ////////////////////////////////////////////////////////////
@@ -60,36 +79,119 @@ void sfBezierCurve_setCurveColor(sfBezierCurve *bezierCurve, sfColor color)
 ////////////////////////////////////////////////////////////
 void sfBezierCurve_addPoint(sfBezierCurve *bezierCurve, sfVector2f point)
 {
+    sfVector2f *points = NULL;
+
     if (bezierCurve == NULL)
         return;
-    bezierCurve->pointCount++;
-    bezierCurve->points = realloc(bezierCurve->points, bezierCurve->pointCount * sizeof(sfVector2f));
-    bezierCurve->points[bezierCurve->pointCount - 1] = point;
+    points = sfAllocator_realloc(bezierCurve->points, (bezierCurve->pointCount + 1) * sizeof(sfVector2f));
+    if (points == NULL)
+        return;
+    bezierCurve->points = points;
+    bezierCurve->points[bezierCurve->pointCount++] = point;
+    bezierCurve->bounds = sfBezierCurve_getBounds(bezierCurve);
 }
 
 ////////////////////////////////////////////////////////////
-sfVector2f sfBezierCurve_calculatePoint(const sfBezierCurve *bezierCurve, float time)
+sfVector2f sfBezierCurve_calculatePointGeneric(const sfBezierCurve *bezierCurve, float time)
 {
-    sfVector2f *points = bezierCurve->points;
-    size_t n = bezierCurve->pointCount - 1;
-    sfVector2f *tmpPoints = malloc(sizeof(sfVector2f) * bezierCurve->pointCount);
+    sfVector2f stackPoints[SF_BEZIERCURVE_STACK_POINTS];
+    sfVector2f *tmpPoints = stackPoints;
     sfVector2f result;
+    size_t mark = 0;
+    size_t n = 0;
 
-    if (n < 1)
+    if (bezierCurve == NULL || bezierCurve->pointCount < 2)
+        return ((sfVector2f){-1, -1});
+    n = bezierCurve->pointCount - 1;
+    if (bezierCurve->pointCount > SF_BEZIERCURVE_STACK_POINTS)
+        tmpPoints = sfAllocator_getScratch(sizeof(sfVector2f) * bezierCurve->pointCount, &mark);
+    if (tmpPoints == NULL)
         return ((sfVector2f){-1, -1});
-    for (size_t i = 0; i < bezierCurve->pointCount; i++)
-        tmpPoints[i] = points[i];
-    for (size_t k = 0; k <= n; k++) {
-        for (size_t i = 0; i <= n; i++) {
+    memcpy(tmpPoints, bezierCurve->points, sizeof(sfVector2f) * bezierCurve->pointCount);
+    for (size_t k = 1; k <= n; k++) {
+        for (size_t i = 0; i <= n - k; i++) {
             tmpPoints[i].x = (1 - time) * tmpPoints[i].x + time * tmpPoints[i + 1].x;
             tmpPoints[i].y = (1 - time) * tmpPoints[i].y + time * tmpPoints[i + 1].y;
         }
     }
     result = tmpPoints[0];
-    free(tmpPoints);
+    if (tmpPoints != stackPoints)
+        sfAllocator_releaseScratch(tmpPoints, mark);
     return (result);
 }
 
+////////////////////////////////////////////////////////////
+/// Fixed-degree kernels, unrolled de Casteljau steps doing the
+/// same operations as the generic loop so both give the same
+/// points to the bit
+////////////////////////////////////////////////////////////
+static inline sfVector2f sfBezierCurve_lerp(sfVector2f a, sfVector2f b, float time)
+{
+    return ((sfVector2f){(1 - time) * a.x + time * b.x, (1 - time) * a.y + time * b.y});
+}
+
+////////////////////////////////////////////////////////////
+static inline sfVector2f sfBezierCurve_linear(const sfVector2f *p, float time)
+{
+    return (sfBezierCurve_lerp(p[0], p[1], time));
+}
+
+////////////////////////////////////////////////////////////
+static inline sfVector2f sfBezierCurve_quadratic(const sfVector2f *p, float time)
+{
+    sfVector2f a = sfBezierCurve_lerp(p[0], p[1], time);
+    sfVector2f b = sfBezierCurve_lerp(p[1], p[2], time);
+
+    return (sfBezierCurve_lerp(a, b, time));
+}
+
+////////////////////////////////////////////////////////////
+static inline sfVector2f sfBezierCurve_cubic(const sfVector2f *p, float time)
+{
+    sfVector2f a = sfBezierCurve_lerp(p[0], p[1], time);
+    sfVector2f b = sfBezierCurve_lerp(p[1], p[2], time);
+    sfVector2f c = sfBezierCurve_lerp(p[2], p[3], time);
+
+    a = sfBezierCurve_lerp(a, b, time);
+    b = sfBezierCurve_lerp(b, c, time);
+    return (sfBezierCurve_lerp(a, b, time));
+}
+
+////////////////////////////////////////////////////////////
+static inline sfVector2f sfBezierCurve_quartic(const sfVector2f *p, float time)
+{
+    sfVector2f a = sfBezierCurve_lerp(p[0], p[1], time);
+    sfVector2f b = sfBezierCurve_lerp(p[1], p[2], time);
+    sfVector2f c = sfBezierCurve_lerp(p[2], p[3], time);
+    sfVector2f d = sfBezierCurve_lerp(p[3], p[4], time);
+
+    a = sfBezierCurve_lerp(a, b, time);
+    b = sfBezierCurve_lerp(b, c, time);
+    c = sfBezierCurve_lerp(c, d, time);
+    a = sfBezierCurve_lerp(a, b, time);
+    b = sfBezierCurve_lerp(b, c, time);
+    return (sfBezierCurve_lerp(a, b, time));
+}
+
+////////////////////////////////////////////////////////////
+sfVector2f sfBezierCurve_calculatePoint(const sfBezierCurve *bezierCurve, float time)
+{
+    if (bezierCurve == NULL || bezierCurve->pointCount < 2)
+        return ((sfVector2f){-1, -1});
+    switch (bezierCurve->pointCount) {
+        case 2:
+            return (sfBezierCurve_linear(bezierCurve->points, time));
+        case 3:
+            return (sfBezierCurve_quadratic(bezierCurve->points, time));
+        case 4:
+            return (sfBezierCurve_cubic(bezierCurve->points, time));
+        case 5:
+            return (sfBezierCurve_quartic(bezierCurve->points, time));
+        default:
+            return (sfBezierCurve_calculatePointGeneric(bezierCurve, time));
+    }
+}
+
 ////////////////////////////////////////////////////////////
 void sfBezierCurve_move(sfBezierCurve *bezierCurve, sfVector2f offset)
 {
@@ -99,21 +201,179 @@ void sfBezierCurve_move(sfBezierCurve *bezierCurve, sfVector2f offset)
         bezierCurve->points[i].x += offset.x;
         bezierCurve->points[i].y += offset.y;
     }
+    bezierCurve->bounds.left += offset.x;
+    bezierCurve->bounds.top += offset.y;
+}
+
+////////////////////////////////////////////////////////////
+/// Grow a rectangle, given as its min and max corners, to a point
+////////////////////////////////////////////////////////////
+static inline void sfBezierCurve_extend(sfVector2f *min, sfVector2f *max, sfVector2f point)
+{
+    min->x = point.x < min->x ? point.x : min->x;
+    min->y = point.y < min->y ? point.y : min->y;
+    max->x = point.x > max->x ? point.x : max->x;
+    max->y = point.y > max->y ? point.y : max->y;
+}
+
+////////////////////////////////////////////////////////////
+/// Times in ]0, 1[ where a t^2 + b t + c is zero, the
+/// derivative of a quadratic or cubic curve along one axis
+////////////////////////////////////////////////////////////
+static size_t sfBezierCurve_solveDerivative(float a, float b, float c, float times[2])
+{
+    size_t count = 0;
+    float delta = b * b - 4 * a * c;
+    float root = 0;
+
+    if (fabsf(a) < 1e-6f) {
+        if (fabsf(b) > 1e-6f && -c / b > 0 && -c / b < 1)
+            times[count++] = -c / b;
+        return (count);
+    }
+    if (delta < 0)
+        return (0);
+    root = sqrtf(delta);
+    if ((-b + root) / (2 * a) > 0 && (-b + root) / (2 * a) < 1)
+        times[count++] = (-b + root) / (2 * a);
+    if ((-b - root) / (2 * a) > 0 && (-b - root) / (2 * a) < 1)
+        times[count++] = (-b - root) / (2 * a);
+    return (count);
+}
+
+////////////////////////////////////////////////////////////
+sfFloatRect sfBezierCurve_getBounds(const sfBezierCurve *bezierCurve)
+{
+    const sfVector2f *p = NULL;
+    sfVector2f min;
+    sfVector2f max;
+    float times[4];
+    size_t count = 0;
+
+    if (bezierCurve == NULL || bezierCurve->pointCount == 0)
+        return ((sfFloatRect){0, 0, 0, 0});
+    p = bezierCurve->points;
+    min = p[0];
+    max = p[0];
+    switch (bezierCurve->pointCount) {
+        case 3:
+            // The curve goes through its ends and the extrema of each axis
+            sfBezierCurve_extend(&min, &max, p[2]);
+            count = sfBezierCurve_solveDerivative(0, p[0].x - 2 * p[1].x + p[2].x, p[1].x - p[0].x, times);
+            count += sfBezierCurve_solveDerivative(0, p[0].y - 2 * p[1].y + p[2].y, p[1].y - p[0].y, times + count);
+            for (size_t i = 0; i < count; i++)
+                sfBezierCurve_extend(&min, &max, sfBezierCurve_quadratic(p, times[i]));
+            break;
+        case 4:
+            sfBezierCurve_extend(&min, &max, p[3]);
+            count = sfBezierCurve_solveDerivative(3 * (p[1].x - p[2].x) + p[3].x - p[0].x,
+                2 * (p[0].x - 2 * p[1].x + p[2].x), p[1].x - p[0].x, times);
+            count += sfBezierCurve_solveDerivative(3 * (p[1].y - p[2].y) + p[3].y - p[0].y,
+                2 * (p[0].y - 2 * p[1].y + p[2].y), p[1].y - p[0].y, times + count);
+            for (size_t i = 0; i < count; i++)
+                sfBezierCurve_extend(&min, &max, sfBezierCurve_cubic(p, times[i]));
+            break;
+        default:
+            // Higher degrees are enclosed by their control points
+            for (size_t i = 1; i < bezierCurve->pointCount; i++)
+                sfBezierCurve_extend(&min, &max, p[i]);
+            break;
+    }
+    return ((sfFloatRect){min.x, min.y, max.x - min.x, max.y - min.y});
+}
+
+////////////////////////////////////////////////////////////
+void sfBezierCurve_updateBounds(sfBezierCurve *bezierCurve)
+{
+    if (bezierCurve == NULL)
+        return;
+    bezierCurve->bounds = sfBezierCurve_getBounds(bezierCurve);
 }
 
 ////////////////////////////////////////////////////////////
-void sfRenderWindow_drawBezierCurve(const sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, const sfRenderStates *states)
+void sfBezierCurve_tessellate(const sfBezierCurve *bezierCurve, sfVertexArray *vertexArray, size_t sampleCount)
 {
-    sfVertexArray *curve = sfVertexArray_create();
-    sfVertex vertex;
+    sfVertex vertex = {{0, 0}, sfTransparent, {0, 0}};
+
+    if (bezierCurve == NULL || vertexArray == NULL || bezierCurve->pointCount < 2)
+        return;
+    vertex.color = bezierCurve->color;
+    SF_PROFILE_COUNT(curveSamples, sampleCount);
+    SF_PROFILE_COUNT(vertexAppends, sampleCount);
+    for (size_t i = 0; i < sampleCount; i++) {
+        vertex.position = sfBezierCurve_calculatePoint(bezierCurve, (float)i / sampleCount);
+        sfVertexArray_append(vertexArray, vertex);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfBezierCurve_sample(const sfBezierCurve *bezierCurve, sfVertex *vertices, size_t sampleCount)
+{
+    const sfVector2f *p = NULL;
+
+    if (bezierCurve == NULL || vertices == NULL || bezierCurve->pointCount < 2)
+        return;
+    SF_PROFILE_COUNT(curveSamples, sampleCount);
+    p = bezierCurve->points;
+    // One loop per kernel so each one is inlined in its own loop
+    switch (bezierCurve->pointCount) {
+        case 3:
+            for (size_t i = 0; i < sampleCount; i++)
+                vertices[i].position = sfBezierCurve_quadratic(p, (float)i / sampleCount);
+            break;
+        case 4:
+            for (size_t i = 0; i < sampleCount; i++)
+                vertices[i].position = sfBezierCurve_cubic(p, (float)i / sampleCount);
+            break;
+        case 5:
+            for (size_t i = 0; i < sampleCount; i++)
+                vertices[i].position = sfBezierCurve_quartic(p, (float)i / sampleCount);
+            break;
+        default:
+            for (size_t i = 0; i < sampleCount; i++)
+                vertices[i].position = sfBezierCurve_calculatePoint(bezierCurve, (float)i / sampleCount);
+            break;
+    }
+    for (size_t i = 0; i < sampleCount; i++) {
+        vertices[i].color = bezierCurve->color;
+        vertices[i].texCoords = (sfVector2f){0, 0};
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawBezierCurve(sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, const sfRenderStates *states)
+{
+    sfVertex *vertices = NULL;
+    size_t mark = 0;
 
     if (bezierCurve == NULL || bezierCurve->pointCount < 2)
-        return (sfVertexArray_destroy(curve));
-    for (float time = 0; time < 1; time += 0.0001) {
-        vertex.position = sfBezierCurve_calculatePoint(bezierCurve, time);
-        vertex.color = bezierCurve->color;
-        sfVertexArray_append(curve, vertex);
+        return;
+    SF_PROFILE_BEGIN(drawBezierCurve);
+    SF_PROFILE_COUNT(curveDraws, 1);
+    vertices = sfAllocator_getScratch(SF_BEZIERCURVE_SAMPLE_COUNT * sizeof(sfVertex), &mark);
+    if (vertices != NULL) {
+        sfBezierCurve_sample(bezierCurve, vertices, SF_BEZIERCURVE_SAMPLE_COUNT);
+        sfRenderWindow_drawPrimitives(renderWindow, vertices, SF_BEZIERCURVE_SAMPLE_COUNT, sfPoints, states);
+        sfAllocator_releaseScratch(vertices, mark);
+    }
+    SF_PROFILE_END(drawBezierCurve, curveDrawTime);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderTexture_drawBezierCurve(sfRenderTexture *renderTexture, const sfBezierCurve *bezierCurve, const sfRenderStates *states)
+{
+    sfVertex *vertices = NULL;
+    size_t mark = 0;
+
+    if (bezierCurve == NULL || bezierCurve->pointCount < 2)
+        return;
+    SF_PROFILE_BEGIN(drawBezierCurve);
+    SF_PROFILE_COUNT(curveDraws, 1);
+    vertices = sfAllocator_getScratch(SF_BEZIERCURVE_SAMPLE_COUNT * sizeof(sfVertex), &mark);
+    if (vertices != NULL) {
+        sfBezierCurve_sample(bezierCurve, vertices, SF_BEZIERCURVE_SAMPLE_COUNT);
+        sfRenderTexture_drawPrimitives(renderTexture, vertices, SF_BEZIERCURVE_SAMPLE_COUNT, sfPoints, states);
+        sfAllocator_releaseScratch(vertices, mark);
     }
-    sfRenderWindow_drawVertexArray(renderWindow, curve, states);
-    sfVertexArray_destroy(curve);
+    SF_PROFILE_END(drawBezierCurve, curveDrawTime);
 }
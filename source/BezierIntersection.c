@@ -0,0 +1,372 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <SFML/Addition/BezierIntersection.h>
+
+////////////////////////////////////////////////////////////
+/// Deepest split of the pieces, reached by tangent curves only
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTION_MAX_DEPTH 48
+
+////////////////////////////////////////////////////////////
+/// Newton steps moving a crossing of flat pieces onto the curves
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTION_NEWTON_STEPS 3
+
+////////////////////////////////////////////////////////////
+/// Piece of a curve between two times, with the box of its
+/// control points
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfVector2f points[SF_BEZIERINTERSECTION_MAX_POINTS];
+    size_t count;
+    float from;
+    float to;
+    sfVector2f min;
+    sfVector2f max;
+    sfBool flat;
+} sfBezierPiece;
+
+////////////////////////////////////////////////////////////
+/// Crossings found so far
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    float tolerance;
+    sfBezierIntersection *intersections;
+    size_t count;
+    size_t maxCount;
+} sfBezierIntersector;
+
+////////////////////////////////////////////////////////////
+static inline float sfBezierIntersection_cross(sfVector2f a, sfVector2f b)
+{
+    return (a.x * b.y - a.y * b.x);
+}
+
+////////////////////////////////////////////////////////////
+/// Compute the box of a piece and whether its control points
+/// are within the tolerance of the segment between its ends
+////////////////////////////////////////////////////////////
+static void sfBezierPiece_measure(sfBezierPiece *piece, float tolerance)
+{
+    sfVector2f first = piece->points[0];
+    sfVector2f chord = {piece->points[piece->count - 1].x - first.x, piece->points[piece->count - 1].y - first.y};
+    float length = chord.x * chord.x + chord.y * chord.y;
+
+    piece->min = first;
+    piece->max = first;
+    piece->flat = sfTrue;
+    for (size_t i = 1; i < piece->count; i++) {
+        sfVector2f point = piece->points[i];
+        sfVector2f offset = {point.x - first.x, point.y - first.y};
+        float along = offset.x * chord.x + offset.y * chord.y;
+        float across = sfBezierIntersection_cross(chord, offset);
+
+        piece->min.x = point.x < piece->min.x ? point.x : piece->min.x;
+        piece->min.y = point.y < piece->min.y ? point.y : piece->min.y;
+        piece->max.x = point.x > piece->max.x ? point.x : piece->max.x;
+        piece->max.y = point.y > piece->max.y ? point.y : piece->max.y;
+        // Within the tolerance of the chord, and not past its ends
+        if (across * across > tolerance * tolerance * length || along < -tolerance * sqrtf(length) ||
+            along > length + tolerance * sqrtf(length))
+            piece->flat = sfFalse;
+    }
+    if (length <= tolerance * tolerance * 1e-4f)
+        piece->flat = piece->max.x - piece->min.x <= tolerance && piece->max.y - piece->min.y <= tolerance;
+}
+
+////////////////////////////////////////////////////////////
+/// Split a piece in halves with de Casteljau's algorithm
+////////////////////////////////////////////////////////////
+static void sfBezierPiece_split(const sfBezierPiece *piece, sfBezierPiece *left, sfBezierPiece *right, float tolerance)
+{
+    sfVector2f points[SF_BEZIERINTERSECTION_MAX_POINTS];
+    size_t count = piece->count;
+
+    for (size_t i = 0; i < count; i++)
+        points[i] = piece->points[i];
+    left->points[0] = piece->points[0];
+    right->points[count - 1] = piece->points[count - 1];
+    for (size_t k = 1; k < count; k++) {
+        for (size_t i = 0; i < count - k; i++)
+            points[i] = (sfVector2f){(points[i].x + points[i + 1].x) * 0.5f, (points[i].y + points[i + 1].y) * 0.5f};
+        left->points[k] = points[0];
+        right->points[count - 1 - k] = points[count - 1 - k];
+    }
+    left->count = count;
+    right->count = count;
+    left->from = piece->from;
+    left->to = (piece->from + piece->to) * 0.5f;
+    right->from = left->to;
+    right->to = piece->to;
+    sfBezierPiece_measure(left, tolerance);
+    sfBezierPiece_measure(right, tolerance);
+}
+
+////////////////////////////////////////////////////////////
+/// Check if every control point of a piece is on the same side
+/// of the line through the ends of a flat piece
+////////////////////////////////////////////////////////////
+static sfBool sfBezierPiece_isAside(const sfBezierPiece *piece, const sfBezierPiece *flat, float tolerance)
+{
+    sfVector2f first = flat->points[0];
+    sfVector2f chord = {flat->points[flat->count - 1].x - first.x, flat->points[flat->count - 1].y - first.y};
+    float margin = tolerance * sqrtf(chord.x * chord.x + chord.y * chord.y);
+    size_t above = 0;
+    size_t below = 0;
+
+    if (margin <= 0)
+        return (sfFalse);
+    for (size_t i = 0; i < piece->count; i++) {
+        float side = sfBezierIntersection_cross(chord, (sfVector2f){piece->points[i].x - first.x, piece->points[i].y - first.y});
+
+        above += side > margin;
+        below += side < -margin;
+    }
+    return (above == piece->count || below == piece->count);
+}
+
+////////////////////////////////////////////////////////////
+/// Compute the point and the derivative of a piece at a time
+/// from 0 to 1 along the piece
+////////////////////////////////////////////////////////////
+static void sfBezierPiece_evaluate(const sfBezierPiece *piece, float time, sfVector2f *point, sfVector2f *derivative)
+{
+    sfVector2f points[SF_BEZIERINTERSECTION_MAX_POINTS];
+    size_t count = piece->count;
+
+    for (size_t i = 0; i < count; i++)
+        points[i] = piece->points[i];
+    for (size_t k = 1; k + 1 < count; k++) {
+        for (size_t i = 0; i < count - k; i++) {
+            points[i].x += (points[i + 1].x - points[i].x) * time;
+            points[i].y += (points[i + 1].y - points[i].y) * time;
+        }
+    }
+    *derivative = (sfVector2f){(points[1].x - points[0].x) * (count - 1), (points[1].y - points[0].y) * (count - 1)};
+    *point = (sfVector2f){points[0].x + (points[1].x - points[0].x) * time, points[0].y + (points[1].y - points[0].y) * time};
+}
+
+////////////////////////////////////////////////////////////
+/// Move the times of a crossing of two flat pieces onto the
+/// curves: a flat piece can still be travelled at an uneven
+/// speed, so the time along its chord is only a first guess
+////////////////////////////////////////////////////////////
+static sfVector2f sfBezierPiece_refine(const sfBezierPiece *a, const sfBezierPiece *b, float *t, float *u)
+{
+    sfVector2f pointA;
+    sfVector2f pointB;
+    sfVector2f derivativeA;
+    sfVector2f derivativeB;
+    sfVector2f gap;
+    float determinant = 0;
+
+    for (size_t i = 0; i < SF_BEZIERINTERSECTION_NEWTON_STEPS; i++) {
+        sfBezierPiece_evaluate(a, *t, &pointA, &derivativeA);
+        sfBezierPiece_evaluate(b, *u, &pointB, &derivativeB);
+        gap = (sfVector2f){pointA.x - pointB.x, pointA.y - pointB.y};
+        determinant = sfBezierIntersection_cross(derivativeA, derivativeB);
+        if (fabsf(determinant) <= 1e-12f)
+            break;
+        *t -= sfBezierIntersection_cross(gap, derivativeB) / determinant;
+        *u -= sfBezierIntersection_cross(gap, derivativeA) / determinant;
+        *t = *t < 0 ? 0 : *t > 1 ? 1 : *t;
+        *u = *u < 0 ? 0 : *u > 1 ? 1 : *u;
+    }
+    sfBezierPiece_evaluate(a, *t, &pointA, &derivativeA);
+    return (pointA);
+}
+
+////////////////////////////////////////////////////////////
+/// Keep a crossing unless one was already found within the tolerance
+////////////////////////////////////////////////////////////
+static void sfBezierIntersector_add(sfBezierIntersector *intersector, float timeA, float timeB, sfVector2f point)
+{
+    float tolerance = intersector->tolerance;
+
+    for (size_t i = 0; i < intersector->count; i++) {
+        sfVector2f other = intersector->intersections[i].point;
+
+        if (fabsf(other.x - point.x) <= tolerance && fabsf(other.y - point.y) <= tolerance)
+            return;
+    }
+    if (intersector->count < intersector->maxCount)
+        intersector->intersections[intersector->count++] = (sfBezierIntersection){timeA, timeB, point};
+}
+
+////////////////////////////////////////////////////////////
+/// Cross two flat pieces as the segments between their ends
+////////////////////////////////////////////////////////////
+static void sfBezierIntersector_crossSegments(sfBezierIntersector *intersector, const sfBezierPiece *a, const sfBezierPiece *b)
+{
+    sfVector2f startA = a->points[0];
+    sfVector2f startB = b->points[0];
+    sfVector2f r = {a->points[a->count - 1].x - startA.x, a->points[a->count - 1].y - startA.y};
+    sfVector2f s = {b->points[b->count - 1].x - startB.x, b->points[b->count - 1].y - startB.y};
+    sfVector2f offset = {startB.x - startA.x, startB.y - startA.y};
+    float denominator = sfBezierIntersection_cross(r, s);
+    float lengthA = sqrtf(r.x * r.x + r.y * r.y);
+    float lengthB = sqrtf(s.x * s.x + s.y * s.y);
+    float slackA = 0;
+    float slackB = 0;
+    float t = 0;
+    float u = 0;
+    sfVector2f point;
+
+    if (fabsf(denominator) <= 1e-6f * lengthA * lengthB) {
+        // Parallel segments only meet here when both pieces shrank to a point
+        if (lengthA <= intersector->tolerance && lengthB <= intersector->tolerance)
+            sfBezierIntersector_add(intersector, (a->from + a->to) * 0.5f, (b->from + b->to) * 0.5f, startA);
+        return;
+    }
+    t = sfBezierIntersection_cross(offset, s) / denominator;
+    u = sfBezierIntersection_cross(offset, r) / denominator;
+    // Crossings on the shared end of two pieces must not fall between them
+    slackA = lengthA > 0 ? intersector->tolerance / lengthA : 1;
+    slackB = lengthB > 0 ? intersector->tolerance / lengthB : 1;
+    if (t < -slackA || t > 1 + slackA || u < -slackB || u > 1 + slackB)
+        return;
+    t = t < 0 ? 0 : t > 1 ? 1 : t;
+    u = u < 0 ? 0 : u > 1 ? 1 : u;
+    point = sfBezierPiece_refine(a, b, &t, &u);
+    sfBezierIntersector_add(intersector, a->from + (a->to - a->from) * t, b->from + (b->to - b->from) * u, point);
+}
+
+////////////////////////////////////////////////////////////
+/// Split the pieces until they are flat or apart
+////////////////////////////////////////////////////////////
+static void sfBezierIntersector_intersect(sfBezierIntersector *intersector, const sfBezierPiece *a, const sfBezierPiece *b, size_t depth)
+{
+    float tolerance = intersector->tolerance;
+    sfBezierPiece left;
+    sfBezierPiece right;
+    sfBool splitA = sfFalse;
+
+    if (intersector->count >= intersector->maxCount)
+        return;
+    if (a->min.x > b->max.x + tolerance || b->min.x > a->max.x + tolerance ||
+        a->min.y > b->max.y + tolerance || b->min.y > a->max.y + tolerance)
+        return;
+    if (a->flat && b->flat) {
+        sfBezierIntersector_crossSegments(intersector, a, b);
+        return;
+    }
+    if ((b->flat && sfBezierPiece_isAside(a, b, tolerance)) || (a->flat && sfBezierPiece_isAside(b, a, tolerance)))
+        return;
+    if (depth >= SF_BEZIERINTERSECTION_MAX_DEPTH) {
+        sfBezierIntersector_add(intersector, (a->from + a->to) * 0.5f, (b->from + b->to) * 0.5f,
+            (sfVector2f){(a->min.x + a->max.x) * 0.5f, (a->min.y + a->max.y) * 0.5f});
+        return;
+    }
+    // Split the piece that is not flat, the largest one if both are not
+    splitA = b->flat || (!a->flat && a->max.x - a->min.x + a->max.y - a->min.y >= b->max.x - b->min.x + b->max.y - b->min.y);
+    sfBezierPiece_split(splitA ? a : b, &left, &right, tolerance);
+    sfBezierIntersector_intersect(intersector, splitA ? &left : a, splitA ? b : &left, depth + 1);
+    sfBezierIntersector_intersect(intersector, splitA ? &right : a, splitA ? b : &right, depth + 1);
+}
+
+////////////////////////////////////////////////////////////
+/// Sort the crossings by increasing time on the first curve
+////////////////////////////////////////////////////////////
+static void sfBezierIntersector_sort(sfBezierIntersector *intersector)
+{
+    for (size_t i = 1; i < intersector->count; i++) {
+        sfBezierIntersection intersection = intersector->intersections[i];
+        size_t j = i;
+
+        for (; j > 0 && intersector->intersections[j - 1].timeA > intersection.timeA; j--)
+            intersector->intersections[j] = intersector->intersections[j - 1];
+        intersector->intersections[j] = intersection;
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierPiece_fromCurve(sfBezierPiece *piece, const sfBezierCurve *bezierCurve, float tolerance)
+{
+    for (size_t i = 0; i < bezierCurve->pointCount; i++)
+        piece->points[i] = bezierCurve->points[i];
+    piece->count = bezierCurve->pointCount;
+    piece->from = 0;
+    piece->to = 1;
+    sfBezierPiece_measure(piece, tolerance);
+}
+
+////////////////////////////////////////////////////////////
+/// Check if the cached bounds of a curve are apart from a box
+////////////////////////////////////////////////////////////
+static sfBool sfBezierIntersection_areApart(sfFloatRect bounds, sfVector2f min, sfVector2f max, float tolerance)
+{
+    return (bounds.left > max.x + tolerance || min.x > bounds.left + bounds.width + tolerance ||
+        bounds.top > max.y + tolerance || min.y > bounds.top + bounds.height + tolerance);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfBezierCurve_intersectCurve(const sfBezierCurve *bezierCurveA, const sfBezierCurve *bezierCurveB, float tolerance, sfBezierIntersection *intersections, size_t maxCount)
+{
+    sfBezierIntersector intersector = {tolerance, intersections, 0, maxCount};
+    sfBezierPiece a;
+    sfBezierPiece b;
+    sfFloatRect bounds;
+
+    if (bezierCurveA == NULL || bezierCurveB == NULL || intersections == NULL || !(tolerance > 0))
+        return (0);
+    if (bezierCurveA->pointCount < 2 || bezierCurveA->pointCount > SF_BEZIERINTERSECTION_MAX_POINTS ||
+        bezierCurveB->pointCount < 2 || bezierCurveB->pointCount > SF_BEZIERINTERSECTION_MAX_POINTS)
+        return (0);
+    bounds = bezierCurveB->bounds;
+    if (sfBezierIntersection_areApart(bezierCurveA->bounds, (sfVector2f){bounds.left, bounds.top},
+        (sfVector2f){bounds.left + bounds.width, bounds.top + bounds.height}, tolerance))
+        return (0);
+    sfBezierPiece_fromCurve(&a, bezierCurveA, tolerance);
+    sfBezierPiece_fromCurve(&b, bezierCurveB, tolerance);
+    sfBezierIntersector_intersect(&intersector, &a, &b, 0);
+    sfBezierIntersector_sort(&intersector);
+    return (intersector.count);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfBezierCurve_intersectLine(const sfBezierCurve *bezierCurve, sfVector2f start, sfVector2f end, float tolerance, sfBezierIntersection *intersections, size_t maxCount)
+{
+    sfBezierIntersector intersector = {tolerance, intersections, 0, maxCount};
+    sfBezierPiece curve;
+    sfBezierPiece line = {{start, end}, 2, 0, 1, {0, 0}, {0, 0}, sfTrue};
+
+    if (bezierCurve == NULL || intersections == NULL || !(tolerance > 0))
+        return (0);
+    if (bezierCurve->pointCount < 2 || bezierCurve->pointCount > SF_BEZIERINTERSECTION_MAX_POINTS)
+        return (0);
+    sfBezierPiece_measure(&line, tolerance);
+    if (sfBezierIntersection_areApart(bezierCurve->bounds, line.min, line.max, tolerance))
+        return (0);
+    sfBezierPiece_fromCurve(&curve, bezierCurve, tolerance);
+    sfBezierIntersector_intersect(&intersector, &curve, &line, 0);
+    sfBezierIntersector_sort(&intersector);
+    return (intersector.count);
+}
@@ -0,0 +1,328 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/Broadphase.h>
+
+////////////////////////////////////////////////////////////
+/// Identifier of no proxy, also left in the entries of the
+/// proxies removed since the last update
+////////////////////////////////////////////////////////////
+#define SF_BROADPHASE_NONE ((size_t)-1)
+
+////////////////////////////////////////////////////////////
+/// Moves allowed per entry to sort the list by insertion
+/// before sorting it from scratch
+////////////////////////////////////////////////////////////
+#define SF_BROADPHASE_INSERTION_BUDGET 8
+
+////////////////////////////////////////////////////////////
+static sfBool sfBroadphase_grow(void **array, size_t *capacity, size_t count, size_t size)
+{
+    size_t newCapacity = *capacity ? *capacity : 16;
+    void *newArray = NULL;
+
+    if (count <= *capacity)
+        return (sfTrue);
+    while (newCapacity < count)
+        newCapacity *= 2;
+    newArray = sfAllocator_realloc(*array, newCapacity * size);
+    if (newArray == NULL)
+        return (sfFalse);
+    *array = newArray;
+    *capacity = newCapacity;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBroadphase *sfBroadphase_create(size_t capacity)
+{
+    sfBroadphase *broadphase = sfAllocator_calloc(1, sizeof(sfBroadphase));
+
+    if (broadphase == NULL)
+        return (NULL);
+    broadphase->freeProxy = SF_BROADPHASE_NONE;
+    if (!sfBroadphase_grow((void **)&broadphase->proxies, &broadphase->proxyCapacity, capacity, sizeof(sfBroadphaseProxy)) ||
+        !sfBroadphase_grow((void **)&broadphase->entries, &broadphase->entryCapacity, capacity, sizeof(sfBroadphaseEntry))) {
+        sfBroadphase_destroy(broadphase);
+        return (NULL);
+    }
+    return (broadphase);
+}
+
+////////////////////////////////////////////////////////////
+void sfBroadphase_destroy(sfBroadphase *broadphase)
+{
+    if (broadphase == NULL)
+        return;
+    sfAllocator_free(broadphase->proxies);
+    sfAllocator_free(broadphase->entries);
+    sfAllocator_free(broadphase->pairs);
+    sfAllocator_free(broadphase);
+}
+
+////////////////////////////////////////////////////////////
+static size_t sfBroadphase_addProxy(sfBroadphase *broadphase, const sfSprite *sprite, const sfAnimatedSprite *animatedSprite, void *userData)
+{
+    size_t proxy = broadphase->freeProxy;
+
+    if (!sfBroadphase_grow((void **)&broadphase->entries, &broadphase->entryCapacity,
+        broadphase->entryCount + 1, sizeof(sfBroadphaseEntry)))
+        return (SF_BROADPHASE_NONE);
+    if (proxy != SF_BROADPHASE_NONE) {
+        broadphase->freeProxy = broadphase->proxies[proxy].next;
+    } else {
+        if (!sfBroadphase_grow((void **)&broadphase->proxies, &broadphase->proxyCapacity,
+            broadphase->proxyCount + 1, sizeof(sfBroadphaseProxy)))
+            return (SF_BROADPHASE_NONE);
+        proxy = broadphase->proxyCount++;
+    }
+    broadphase->proxies[proxy] = (sfBroadphaseProxy){sprite, animatedSprite, userData,
+        {{0, 0}, {0, 0}, {0, 0}, {0, 0}}, broadphase->entryCount, SF_BROADPHASE_NONE};
+    // New entries are placed by the sort of the next update
+    broadphase->entries[broadphase->entryCount++] = (sfBroadphaseEntry){0, 0, 0, 0, proxy};
+    return (proxy);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_addSprite(sfBroadphase *broadphase, const sfSprite *sprite, void *userData)
+{
+    if (broadphase == NULL || sprite == NULL)
+        return (SF_BROADPHASE_NONE);
+    return (sfBroadphase_addProxy(broadphase, sprite, NULL, userData));
+}
+
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_addAnimatedSprite(sfBroadphase *broadphase, const sfAnimatedSprite *animatedSprite, void *userData)
+{
+    if (broadphase == NULL || animatedSprite == NULL)
+        return (SF_BROADPHASE_NONE);
+    return (sfBroadphase_addProxy(broadphase, NULL, animatedSprite, userData));
+}
+
+////////////////////////////////////////////////////////////
+void sfBroadphase_remove(sfBroadphase *broadphase, size_t proxy)
+{
+    sfBroadphaseProxy *removed = NULL;
+
+    if (broadphase == NULL || proxy >= broadphase->proxyCount)
+        return;
+    removed = &broadphase->proxies[proxy];
+    if (removed->sprite == NULL && removed->animatedSprite == NULL)
+        return;
+    // The entry is dropped by the next update
+    broadphase->entries[removed->entry].proxy = SF_BROADPHASE_NONE;
+    removed->sprite = NULL;
+    removed->animatedSprite = NULL;
+    removed->next = broadphase->freeProxy;
+    broadphase->freeProxy = proxy;
+}
+
+////////////////////////////////////////////////////////////
+void sfBroadphase_setNarrowPhase(sfBroadphase *broadphase, sfBool enabled)
+{
+    if (broadphase == NULL)
+        return;
+    broadphase->narrowPhase = enabled;
+}
+
+////////////////////////////////////////////////////////////
+/// Compute the oriented box of a proxy and its bounding box
+////////////////////////////////////////////////////////////
+static void sfBroadphase_refresh(sfBroadphaseProxy *proxy, sfBroadphaseEntry *entry)
+{
+    sfTransform transform;
+    sfVertex vertices[4];
+    sfFloatRect bounds;
+    const float *matrix = transform.matrix;
+    sfVector2f width;
+    sfVector2f height;
+
+    if (proxy->animatedSprite != NULL) {
+        transform = sfAnimatedSprite_getTransform(proxy->animatedSprite);
+        sfAnimatedSprite_getVertices(proxy->animatedSprite, vertices);
+        bounds = (sfFloatRect){vertices[0].position.x, vertices[0].position.y,
+            vertices[2].position.x - vertices[0].position.x, vertices[2].position.y - vertices[0].position.y};
+    } else {
+        transform = sfSprite_getTransform(proxy->sprite);
+        bounds = sfSprite_getLocalBounds(proxy->sprite);
+    }
+    // The local bounds are a rectangle, its sides are the columns of the transform scaled
+    width = (sfVector2f){matrix[0] * bounds.width, matrix[3] * bounds.width};
+    height = (sfVector2f){matrix[1] * bounds.height, matrix[4] * bounds.height};
+    proxy->corners[0].x = matrix[0] * bounds.left + matrix[1] * bounds.top + matrix[2];
+    proxy->corners[0].y = matrix[3] * bounds.left + matrix[4] * bounds.top + matrix[5];
+    proxy->corners[1] = (sfVector2f){proxy->corners[0].x + width.x, proxy->corners[0].y + width.y};
+    proxy->corners[2] = (sfVector2f){proxy->corners[1].x + height.x, proxy->corners[1].y + height.y};
+    proxy->corners[3] = (sfVector2f){proxy->corners[0].x + height.x, proxy->corners[0].y + height.y};
+    entry->left = proxy->corners[0].x + (width.x < 0 ? width.x : 0) + (height.x < 0 ? height.x : 0);
+    entry->right = proxy->corners[0].x + (width.x > 0 ? width.x : 0) + (height.x > 0 ? height.x : 0);
+    entry->top = proxy->corners[0].y + (width.y < 0 ? width.y : 0) + (height.y < 0 ? height.y : 0);
+    entry->bottom = proxy->corners[0].y + (width.y > 0 ? width.y : 0) + (height.y > 0 ? height.y : 0);
+}
+
+////////////////////////////////////////////////////////////
+static int sfBroadphase_compare(const void *a, const void *b)
+{
+    float x = ((const sfBroadphaseEntry *)a)->left;
+    float y = ((const sfBroadphaseEntry *)b)->left;
+
+    return ((x > y) - (x < y));
+}
+
+////////////////////////////////////////////////////////////
+/// Sort the entries by their left side, by insertion while the
+/// list is almost sorted, from scratch when too many entries
+/// moved, such as after many sprites were added
+////////////////////////////////////////////////////////////
+static void sfBroadphase_sort(sfBroadphaseEntry *entries, size_t count)
+{
+    size_t budget = count * SF_BROADPHASE_INSERTION_BUDGET;
+
+    for (size_t i = 1; i < count; i++) {
+        sfBroadphaseEntry entry = entries[i];
+        size_t j = i;
+
+        while (j > 0 && entries[j - 1].left > entry.left && budget > 0) {
+            entries[j] = entries[j - 1];
+            j--;
+            budget--;
+        }
+        entries[j] = entry;
+        if (budget == 0) {
+            qsort(entries, count, sizeof(sfBroadphaseEntry), sfBroadphase_compare);
+            return;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfBroadphase_addPair(sfBroadphase *broadphase, size_t a, size_t b)
+{
+    if (!sfBroadphase_grow((void **)&broadphase->pairs, &broadphase->pairCapacity,
+        broadphase->pairCount + 1, sizeof(sfBroadphasePair)))
+        return (sfFalse);
+    broadphase->pairs[broadphase->pairCount++] = a < b ? (sfBroadphasePair){a, b} : (sfBroadphasePair){b, a};
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfBroadphase_update(sfBroadphase *broadphase)
+{
+    sfBroadphaseEntry *entries = NULL;
+    size_t count = 0;
+
+    if (broadphase == NULL)
+        return (0);
+    entries = broadphase->entries;
+    for (size_t i = 0; i < broadphase->entryCount; i++) {
+        if (entries[i].proxy == SF_BROADPHASE_NONE)
+            continue;
+        entries[count] = entries[i];
+        sfBroadphase_refresh(&broadphase->proxies[entries[count].proxy], &entries[count]);
+        count++;
+    }
+    broadphase->entryCount = count;
+    sfBroadphase_sort(entries, count);
+    for (size_t i = 0; i < count; i++)
+        broadphase->proxies[entries[i].proxy].entry = i;
+    broadphase->pairCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        float right = entries[i].right;
+        float top = entries[i].top;
+        float bottom = entries[i].bottom;
+
+        for (size_t j = i + 1; j < count && entries[j].left < right; j++) {
+            // One test on the overlap of the intervals instead of an unpredictable above / below
+            float low = entries[j].top > top ? entries[j].top : top;
+            float high = entries[j].bottom < bottom ? entries[j].bottom : bottom;
+
+            if (low >= high)
+                continue;
+            if (broadphase->narrowPhase && !sfOrientedBox_intersects(broadphase->proxies[entries[i].proxy].corners,
+                broadphase->proxies[entries[j].proxy].corners))
+                continue;
+            if (!sfBroadphase_addPair(broadphase, entries[i].proxy, entries[j].proxy))
+                return (broadphase->pairCount);
+        }
+    }
+    return (broadphase->pairCount);
+}
+
+////////////////////////////////////////////////////////////
+const sfBroadphasePair *sfBroadphase_getPairs(const sfBroadphase *broadphase, size_t *count)
+{
+    if (count != NULL)
+        *count = broadphase != NULL ? broadphase->pairCount : 0;
+    if (broadphase == NULL)
+        return (NULL);
+    return (broadphase->pairs);
+}
+
+////////////////////////////////////////////////////////////
+void *sfBroadphase_getUserData(const sfBroadphase *broadphase, size_t proxy)
+{
+    if (broadphase == NULL || proxy >= broadphase->proxyCount)
+        return (NULL);
+    return (broadphase->proxies[proxy].userData);
+}
+
+////////////////////////////////////////////////////////////
+/// Check if the projections of two boxes on the normal of the
+/// edge from -> to are apart
+////////////////////////////////////////////////////////////
+static sfBool sfOrientedBox_separated(const sfVector2f *cornersA, const sfVector2f *cornersB, sfVector2f from, sfVector2f to)
+{
+    sfVector2f axis = {from.y - to.y, to.x - from.x};
+    float minA = cornersA[0].x * axis.x + cornersA[0].y * axis.y;
+    float maxA = minA;
+    float minB = cornersB[0].x * axis.x + cornersB[0].y * axis.y;
+    float maxB = minB;
+
+    for (size_t i = 1; i < 4; i++) {
+        float a = cornersA[i].x * axis.x + cornersA[i].y * axis.y;
+        float b = cornersB[i].x * axis.x + cornersB[i].y * axis.y;
+
+        minA = a < minA ? a : minA;
+        maxA = a > maxA ? a : maxA;
+        minB = b < minB ? b : minB;
+        maxB = b > maxB ? b : maxB;
+    }
+    return (maxA <= minB || maxB <= minA);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfOrientedBox_intersects(const sfVector2f cornersA[4], const sfVector2f cornersB[4])
+{
+    if (cornersA == NULL || cornersB == NULL)
+        return (sfFalse);
+    // The boxes are parallelograms, two edges of each give every separating axis
+    return (!sfOrientedBox_separated(cornersA, cornersB, cornersA[0], cornersA[1]) &&
+        !sfOrientedBox_separated(cornersA, cornersB, cornersA[1], cornersA[2]) &&
+        !sfOrientedBox_separated(cornersA, cornersB, cornersB[0], cornersB[1]) &&
+        !sfOrientedBox_separated(cornersA, cornersB, cornersB[1], cornersB[2]));
+}
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/CachedLayer.h>
+
+////////////////////////////////////////////////////////////
+/// Check if two rectangles overlap
+////////////////////////////////////////////////////////////
+static sfBool sfCachedLayer_overlaps(sfFloatRect a, sfFloatRect b)
+{
+    return (a.left <= b.left + b.width && b.left <= a.left + a.width && a.top <= b.top + b.height && b.top <= a.top + a.height);
+}
+
+////////////////////////////////////////////////////////////
+/// Smallest rectangle containing two rectangles
+////////////////////////////////////////////////////////////
+static sfFloatRect sfCachedLayer_union(sfFloatRect a, sfFloatRect b)
+{
+    float left = fminf(a.left, b.left);
+    float top = fminf(a.top, b.top);
+    float right = fmaxf(a.left + a.width, b.left + b.width);
+    float bottom = fmaxf(a.top + a.height, b.top + b.height);
+
+    return ((sfFloatRect){left, top, right - left, bottom - top});
+}
+
+////////////////////////////////////////////////////////////
+/// Fold floats into a hash, by their bits so -0 and NaN changes are seen
+////////////////////////////////////////////////////////////
+static sfUint64 sfCachedLayer_hash(sfUint64 hash, const float *values, size_t count)
+{
+    sfUint32 bits = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        memcpy(&bits, &values[i], sizeof(bits));
+        hash = (hash ^ bits) * 0x100000001B3;
+    }
+    return (hash);
+}
+
+////////////////////////////////////////////////////////////
+/// Record the current state of an item
+////////////////////////////////////////////////////////////
+static void sfCachedLayer_snapshot(sfCachedLayerItem *item)
+{
+    sfVertex quad[4];
+    sfTransform transform;
+
+    item->hash = 0xCBF29CE484222325;
+    if (item->bezierCurve != NULL) {
+        item->bounds = sfBezierCurve_getBounds(item->bezierCurve);
+        item->pointCount = item->bezierCurve->pointCount;
+        item->color = item->bezierCurve->color;
+        // Inner control points can move without changing the bounds
+        for (size_t i = 0; i < item->pointCount; i++)
+            item->hash = sfCachedLayer_hash(item->hash, &item->bezierCurve->points[i].x, 2);
+    } else if (item->animatedSprite != NULL) {
+        // The quad follows the frames of sprite sheets, which leave the texture rect of the sprite alone
+        sfAnimatedSprite_getVertices(item->animatedSprite, quad);
+        item->bounds = sfAnimatedSprite_getGlobalBounds(item->animatedSprite);
+        item->textureRect = (sfIntRect){(int)quad[0].texCoords.x, (int)quad[0].texCoords.y,
+            (int)(quad[2].texCoords.x - quad[0].texCoords.x), (int)(quad[2].texCoords.y - quad[0].texCoords.y)};
+        item->color = sfSprite_getColor(item->animatedSprite->sprite);
+        item->texture = sfSprite_getTexture(item->animatedSprite->sprite);
+        // Flips and half turns keep the bounds
+        transform = sfSprite_getTransform(item->animatedSprite->sprite);
+        item->hash = sfCachedLayer_hash(item->hash, transform.matrix, 9);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Compare two states of an item
+////////////////////////////////////////////////////////////
+static sfBool sfCachedLayer_hasChanged(const sfCachedLayerItem *a, const sfCachedLayerItem *b)
+{
+    return (a->bounds.left != b->bounds.left || a->bounds.top != b->bounds.top ||
+        a->bounds.width != b->bounds.width || a->bounds.height != b->bounds.height ||
+        a->textureRect.left != b->textureRect.left || a->textureRect.top != b->textureRect.top ||
+        a->textureRect.width != b->textureRect.width || a->textureRect.height != b->textureRect.height ||
+        a->texture != b->texture || a->pointCount != b->pointCount || a->hash != b->hash ||
+        a->color.r != b->color.r || a->color.g != b->color.g || a->color.b != b->color.b || a->color.a != b->color.a);
+}
+
+////////////////////////////////////////////////////////////
+/// Add a rectangle to render again, aligned on the pixels of the layer
+////////////////////////////////////////////////////////////
+static void sfCachedLayer_addDirtyRect(sfCachedLayer *layer, sfFloatRect rect)
+{
+    sfFloatRect clipped;
+    float left, top, right, bottom;
+
+    rect = (sfFloatRect){rect.left - 1, rect.top - 1, rect.width + 2, rect.height + 2};
+    if (!sfFloatRect_intersects(&rect, &layer->area, &clipped))
+        return;
+    left = floorf(clipped.left - layer->area.left);
+    top = floorf(clipped.top - layer->area.top);
+    right = ceilf(clipped.left + clipped.width - layer->area.left);
+    bottom = ceilf(clipped.top + clipped.height - layer->area.top);
+    rect = (sfFloatRect){layer->area.left + left, layer->area.top + top, right - left, bottom - top};
+    for (size_t i = 0; i < layer->dirtyCount;) {
+        if (sfCachedLayer_overlaps(rect, layer->dirtyRects[i])) {
+            rect = sfCachedLayer_union(rect, layer->dirtyRects[i]);
+            layer->dirtyRects[i] = layer->dirtyRects[--layer->dirtyCount];
+            i = 0;
+        } else
+            i++;
+    }
+    if (layer->dirtyCount == SF_CACHEDLAYER_MAX_DIRTY_RECTS) {
+        for (size_t i = 0; i < layer->dirtyCount; i++)
+            rect = sfCachedLayer_union(rect, layer->dirtyRects[i]);
+        layer->dirtyCount = 0;
+    }
+    layer->dirtyRects[layer->dirtyCount++] = rect;
+}
+
+////////////////////////////////////////////////////////////
+sfCachedLayer *sfCachedLayer_create(sfFloatRect area)
+{
+    sfCachedLayer *layer = NULL;
+
+    if (area.width <= 0 || area.height <= 0)
+        return (NULL);
+    layer = sfAllocator_calloc(1, sizeof(sfCachedLayer));
+    if (layer == NULL)
+        return (NULL);
+    layer->area = area;
+    layer->renderTexture = sfRenderTexture_create((unsigned int)ceilf(area.width), (unsigned int)ceilf(area.height), sfFalse);
+    layer->sprite = sfSprite_create();
+    layer->view = sfView_create();
+    if (layer->renderTexture == NULL || layer->sprite == NULL || layer->view == NULL) {
+        sfCachedLayer_destroy(layer);
+        return (NULL);
+    }
+    sfSprite_setTexture(layer->sprite, sfRenderTexture_getTexture(layer->renderTexture), sfTrue);
+    sfSprite_setPosition(layer->sprite, (sfVector2f){area.left, area.top});
+    sfCachedLayer_invalidateRect(layer, area);
+    return (layer);
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_destroy(sfCachedLayer *layer)
+{
+    if (layer == NULL)
+        return;
+    if (layer->renderTexture)
+        sfRenderTexture_destroy(layer->renderTexture);
+    if (layer->sprite)
+        sfSprite_destroy(layer->sprite);
+    if (layer->view)
+        sfView_destroy(layer->view);
+    sfAllocator_free(layer->items);
+    sfAllocator_free(layer);
+}
+
+////////////////////////////////////////////////////////////
+/// Store an item in the first free slot of a layer
+////////////////////////////////////////////////////////////
+static size_t sfCachedLayer_addItem(sfCachedLayer *layer, sfCachedLayerItem item)
+{
+    sfCachedLayerItem *items = NULL;
+    size_t index = 0;
+
+    if (layer == NULL)
+        return (SF_CACHEDLAYER_NO_ITEM);
+    while (index < layer->itemCount && (layer->items[index].bezierCurve != NULL || layer->items[index].animatedSprite != NULL))
+        index++;
+    if (index == layer->itemCapacity) {
+        items = sfAllocator_realloc(layer->items, (layer->itemCapacity ? layer->itemCapacity * 2 : 16) * sizeof(sfCachedLayerItem));
+        if (items == NULL)
+            return (SF_CACHEDLAYER_NO_ITEM);
+        layer->items = items;
+        layer->itemCapacity = layer->itemCapacity ? layer->itemCapacity * 2 : 16;
+    }
+    if (index == layer->itemCount)
+        layer->itemCount++;
+    sfCachedLayer_snapshot(&item);
+    layer->items[index] = item;
+    sfCachedLayer_addDirtyRect(layer, item.bounds);
+    return (index);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfCachedLayer_addBezierCurve(sfCachedLayer *layer, const sfBezierCurve *bezierCurve)
+{
+    if (bezierCurve == NULL)
+        return (SF_CACHEDLAYER_NO_ITEM);
+    return (sfCachedLayer_addItem(layer, (sfCachedLayerItem){bezierCurve, NULL, {0, 0, 0, 0}, {0, 0, 0, 0}, NULL, 0, sfTransparent, 0}));
+}
+
+////////////////////////////////////////////////////////////
+size_t sfCachedLayer_addAnimatedSprite(sfCachedLayer *layer, sfAnimatedSprite *animatedSprite)
+{
+    if (animatedSprite == NULL)
+        return (SF_CACHEDLAYER_NO_ITEM);
+    return (sfCachedLayer_addItem(layer, (sfCachedLayerItem){NULL, animatedSprite, {0, 0, 0, 0}, {0, 0, 0, 0}, NULL, 0, sfTransparent, 0}));
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_remove(sfCachedLayer *layer, size_t item)
+{
+    if (layer == NULL || item >= layer->itemCount)
+        return;
+    sfCachedLayer_addDirtyRect(layer, layer->items[item].bounds);
+    layer->items[item].bezierCurve = NULL;
+    layer->items[item].animatedSprite = NULL;
+    while (layer->itemCount > 0 && layer->items[layer->itemCount - 1].bezierCurve == NULL && layer->items[layer->itemCount - 1].animatedSprite == NULL)
+        layer->itemCount--;
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_invalidate(sfCachedLayer *layer, size_t item)
+{
+    if (layer == NULL || item >= layer->itemCount)
+        return;
+    sfCachedLayer_addDirtyRect(layer, layer->items[item].bounds);
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_invalidateRect(sfCachedLayer *layer, sfFloatRect rect)
+{
+    if (layer == NULL)
+        return;
+    sfCachedLayer_addDirtyRect(layer, rect);
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_update(sfCachedLayer *layer)
+{
+    sfCachedLayerItem previous;
+
+    if (layer == NULL)
+        return;
+    for (size_t i = 0; i < layer->itemCount; i++) {
+        if (layer->items[i].animatedSprite != NULL)
+            sfAnimatedSprite_update(layer->items[i].animatedSprite);
+        previous = layer->items[i];
+        sfCachedLayer_snapshot(&layer->items[i]);
+        if (sfCachedLayer_hasChanged(&previous, &layer->items[i])) {
+            sfCachedLayer_addDirtyRect(layer, previous.bounds);
+            sfCachedLayer_addDirtyRect(layer, layer->items[i].bounds);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Clear a rectangle of the texture and draw the items it touches
+////////////////////////////////////////////////////////////
+static void sfCachedLayer_renderRect(sfCachedLayer *layer, sfFloatRect rect)
+{
+    sfRenderStates clearStates = {sfBlendNone, sfTransform_Identity, NULL, NULL};
+    sfVertex quad[4] = {
+        {{rect.left, rect.top}, sfTransparent, {0, 0}},
+        {{rect.left + rect.width, rect.top}, sfTransparent, {0, 0}},
+        {{rect.left + rect.width, rect.top + rect.height}, sfTransparent, {0, 0}},
+        {{rect.left, rect.top + rect.height}, sfTransparent, {0, 0}}
+    };
+    const sfCachedLayerItem *item = NULL;
+
+    sfView_reset(layer->view, rect);
+    sfView_setViewport(layer->view, (sfFloatRect){
+        (rect.left - layer->area.left) / layer->area.width, (rect.top - layer->area.top) / layer->area.height,
+        rect.width / layer->area.width, rect.height / layer->area.height
+    });
+    sfRenderTexture_setView(layer->renderTexture, layer->view);
+    sfRenderTexture_drawPrimitives(layer->renderTexture, quad, 4, sfQuads, &clearStates);
+    for (size_t i = 0; i < layer->itemCount; i++) {
+        item = &layer->items[i];
+        if (!sfCachedLayer_overlaps(item->bounds, rect))
+            continue;
+        if (item->bezierCurve != NULL)
+            sfRenderTexture_drawBezierCurve(layer->renderTexture, item->bezierCurve, NULL);
+        else if (item->animatedSprite != NULL)
+            sfRenderTexture_drawAnimatedSpriteFrame(layer->renderTexture, item->animatedSprite, NULL);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_render(sfCachedLayer *layer)
+{
+    float area = 0;
+    float redrawn = 0;
+
+    if (layer == NULL)
+        return;
+    area = layer->area.width * layer->area.height;
+    for (size_t i = 0; i < layer->dirtyCount; i++)
+        redrawn += layer->dirtyRects[i].width * layer->dirtyRects[i].height;
+    if (redrawn > area / 2) {
+        layer->dirtyRects[0] = layer->area;
+        layer->dirtyCount = 1;
+        redrawn = area;
+    }
+    for (size_t i = 0; i < layer->dirtyCount; i++)
+        sfCachedLayer_renderRect(layer, layer->dirtyRects[i]);
+    if (layer->dirtyCount > 0)
+        sfRenderTexture_display(layer->renderTexture);
+    else
+        layer->stats.cacheHits++;
+    layer->dirtyCount = 0;
+    layer->stats.frames++;
+    layer->stats.redrawnPixels += (size_t)redrawn;
+    layer->stats.redrawFraction = redrawn / area;
+    layer->stats.averageRedrawFraction = layer->stats.redrawnPixels / (area * layer->stats.frames);
+}
+
+////////////////////////////////////////////////////////////
+sfCachedLayerStats sfCachedLayer_getStats(const sfCachedLayer *layer)
+{
+    if (layer == NULL)
+        return ((sfCachedLayerStats){0, 0, 0, 0, 0});
+    return (layer->stats);
+}
+
+////////////////////////////////////////////////////////////
+void sfCachedLayer_resetStats(sfCachedLayer *layer)
+{
+    if (layer == NULL)
+        return;
+    layer->stats = (sfCachedLayerStats){0, 0, 0, 0, 0};
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawCachedLayer(sfRenderWindow *renderWindow, sfCachedLayer *layer, const sfRenderStates *states)
+{
+    if (layer == NULL)
+        return;
+    sfCachedLayer_update(layer);
+    sfCachedLayer_render(layer);
+    sfRenderWindow_drawSprite(renderWindow, layer->sprite, states);
+}
@@ -0,0 +1,518 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/FrameStore.h>
+
+////////////////////////////////////////////////////////////
+/// Number of bits of the hash of the pixels searched for copies
+////////////////////////////////////////////////////////////
+#define SF_FRAMESTORE_HASH_BITS 12
+
+////////////////////////////////////////////////////////////
+/// Shortest copy of previous pixels, a copy never takes more
+/// room than the pixels it replaces
+////////////////////////////////////////////////////////////
+#define SF_FRAMESTORE_MIN_MATCH 4
+
+////////////////////////////////////////////////////////////
+/// Largest size of a number written by sfFrameStore_writeVarint
+////////////////////////////////////////////////////////////
+#define SF_FRAMESTORE_MAX_VARINT 10
+
+////////////////////////////////////////////////////////////
+/// Index of an empty slot of the cache
+////////////////////////////////////////////////////////////
+#define SF_FRAMESTORE_NO_FRAME SIZE_MAX
+
+////////////////////////////////////////////////////////////
+/// Buffers used to compress a frame
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfUint32 *pixels;
+    sfUint8 *lz;
+    sfUint8 *palette;
+    sfUint8 *indices;
+    size_t *table;
+} sfFrameStoreEncoder;
+
+////////////////////////////////////////////////////////////
+static size_t sfFrameStore_writeVarint(sfUint8 *out, size_t value)
+{
+    size_t size = 0;
+
+    while (value >= 0x80) {
+        out[size++] = (sfUint8)(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = (sfUint8)value;
+    return (size);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStore_readVarint(const sfUint8 **data, const sfUint8 *end, size_t *value)
+{
+    *value = 0;
+    for (unsigned int shift = 0; *data < end && shift < 64; shift += 7) {
+        *value |= (size_t)(**data & 0x7F) << shift;
+        if ((*(*data)++ & 0x80) == 0)
+            return (sfTrue);
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+static size_t sfFrameStore_hash(const sfUint32 *pixels)
+{
+    return ((sfUint32)(pixels[0] * 2654435761u ^ pixels[1] * 2246822519u) >> (32 - SF_FRAMESTORE_HASH_BITS));
+}
+
+////////////////////////////////////////////////////////////
+static size_t sfFrameStore_matchLength(const sfUint32 *pixels, size_t count, size_t candidate, size_t position)
+{
+    size_t length = 0;
+
+    while (position + length < count && pixels[candidate + length] == pixels[position + length])
+        length++;
+    return (length);
+}
+
+////////////////////////////////////////////////////////////
+/// Write the pixels as sequences of a number of literal pixels,
+/// the literal pixels, then the length and distance of a copy
+/// of previous pixels; the last sequence has no copy. Returns 0
+/// when the result does not fit in capacity bytes
+////////////////////////////////////////////////////////////
+static size_t sfFrameStore_compressLz(const sfUint32 *pixels, size_t count, sfUint8 *out, size_t capacity, size_t *table)
+{
+    size_t size = 0;
+    size_t anchor = 0;
+    size_t position = 0;
+
+    for (size_t i = 0; i < ((size_t)1 << SF_FRAMESTORE_HASH_BITS); i++)
+        table[i] = SF_FRAMESTORE_NO_FRAME;
+    while (position + SF_FRAMESTORE_MIN_MATCH <= count) {
+        size_t hash = sfFrameStore_hash(pixels + position);
+        size_t candidate = table[hash];
+        size_t length = 0;
+        size_t distance = 0;
+
+        table[hash] = position;
+        if (candidate != SF_FRAMESTORE_NO_FRAME && pixels[candidate] == pixels[position]) {
+            length = sfFrameStore_matchLength(pixels, count, candidate, position);
+            distance = position - candidate;
+        }
+        if (position > 0 && pixels[position - 1] == pixels[position] && distance != 1) {
+            size_t run = sfFrameStore_matchLength(pixels, count, position - 1, position);
+
+            if (run > length) {
+                length = run;
+                distance = 1;
+            }
+        }
+        if (length < SF_FRAMESTORE_MIN_MATCH) {
+            position++;
+            continue;
+        }
+        if (size + (position - anchor) * 4 + 3 * SF_FRAMESTORE_MAX_VARINT > capacity)
+            return (0);
+        size += sfFrameStore_writeVarint(out + size, position - anchor);
+        memcpy(out + size, pixels + anchor, (position - anchor) * 4);
+        size += (position - anchor) * 4;
+        size += sfFrameStore_writeVarint(out + size, length);
+        size += sfFrameStore_writeVarint(out + size, distance);
+        position += length;
+        anchor = position;
+    }
+    if (size + (count - anchor) * 4 + SF_FRAMESTORE_MAX_VARINT > capacity)
+        return (0);
+    size += sfFrameStore_writeVarint(out + size, count - anchor);
+    memcpy(out + size, pixels + anchor, (count - anchor) * 4);
+    return (size + (count - anchor) * 4);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStore_decompressLz(const sfUint8 *data, size_t size, sfUint8 *pixels, size_t count)
+{
+    const sfUint8 *end = data + size;
+    size_t position = 0;
+    size_t literals = 0;
+    size_t length = 0;
+    size_t distance = 0;
+
+    while (sfFrameStore_readVarint(&data, end, &literals)) {
+        if (literals > count - position || literals > (size_t)(end - data) / 4)
+            return (sfFalse);
+        memcpy(pixels + position * 4, data, literals * 4);
+        data += literals * 4;
+        position += literals;
+        if (data == end)
+            return (position == count);
+        if (!sfFrameStore_readVarint(&data, end, &length) || !sfFrameStore_readVarint(&data, end, &distance))
+            return (sfFalse);
+        if (distance == 0 || distance > position || length > count - position)
+            return (sfFalse);
+        if (distance >= length) {
+            memcpy(pixels + position * 4, pixels + (position - distance) * 4, length * 4);
+        } else {
+            for (size_t i = position; i < position + length; i++)
+                memcpy(pixels + i * 4, pixels + (i - distance) * 4, 4);
+        }
+        position += length;
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+/// Write the number of colors minus one, the colors, then the
+/// index of each pixel packed on 1, 2, 4 or 8 bits, lowest bits
+/// first. Returns 0 when there are more than 256 colors or the
+/// result does not fit in capacity bytes
+////////////////////////////////////////////////////////////
+static size_t sfFrameStore_compressPalette(const sfUint32 *pixels, size_t count, sfUint8 *out, size_t capacity, sfUint8 *indices)
+{
+    sfUint32 colors[512];
+    sfUint16 slots[512] = {0};
+    size_t colorCount = 0;
+    size_t bits = 8;
+    size_t size = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = (sfUint32)(pixels[i] * 2654435761u) >> 23;
+
+        while (slots[slot] != 0 && colors[slots[slot] - 1] != pixels[i])
+            slot = (slot + 1) & 511;
+        if (slots[slot] == 0) {
+            if (colorCount == 256)
+                return (0);
+            colors[colorCount++] = pixels[i];
+            slots[slot] = (sfUint16)colorCount;
+        }
+        indices[i] = (sfUint8)(slots[slot] - 1);
+    }
+    bits = colorCount <= 2 ? 1 : colorCount <= 4 ? 2 : colorCount <= 16 ? 4 : 8;
+    size = 1 + colorCount * 4 + (count * bits + 7) / 8;
+    if (size > capacity)
+        return (0);
+    out[0] = (sfUint8)(colorCount - 1);
+    memcpy(out + 1, colors, colorCount * 4);
+    out += 1 + colorCount * 4;
+    memset(out, 0, (count * bits + 7) / 8);
+    for (size_t i = 0; i < count; i++)
+        out[i * bits / 8] |= (sfUint8)(indices[i] << (i * bits % 8));
+    return (size);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStore_decompressPalette(const sfUint8 *data, size_t size, sfUint8 *pixels, size_t count)
+{
+    sfUint8 colors[256 * 4] = {0};
+    size_t colorCount = 0;
+    size_t bits = 0;
+    size_t mask = 0;
+
+    if (size == 0)
+        return (sfFalse);
+    colorCount = (size_t)data[0] + 1;
+    bits = colorCount <= 2 ? 1 : colorCount <= 4 ? 2 : colorCount <= 16 ? 4 : 8;
+    mask = ((size_t)1 << bits) - 1;
+    if (size != 1 + colorCount * 4 + (count * bits + 7) / 8)
+        return (sfFalse);
+    memcpy(colors, data + 1, colorCount * 4);
+    data += 1 + colorCount * 4;
+    for (size_t i = 0; i < count; i += 8 / bits) {
+        size_t packed = *data++;
+
+        for (size_t j = i; j < i + 8 / bits && j < count; j++, packed >>= bits)
+            memcpy(pixels + j * 4, colors + (packed & mask) * 4, 4);
+    }
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Compress the pixels of the encoder and append them to the
+/// data of the store, in the smallest of the three encodings
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStore_compressFrame(sfFrameStore *frameStore, sfFrameStoreEncoder *encoder, size_t *capacity, size_t frame)
+{
+    size_t count = (size_t)frameStore->frameSize.x * frameStore->frameSize.y;
+    size_t size = count * 4;
+    const sfUint8 *data = (const sfUint8 *)encoder->pixels;
+    sfFrameEncoding encoding = sfFrameRaw;
+    size_t paletteSize = sfFrameStore_compressPalette(encoder->pixels, count, encoder->palette, size - 1, encoder->indices);
+    size_t lzSize = 0;
+    sfUint8 *grown = NULL;
+
+    if (paletteSize != 0) {
+        data = encoder->palette;
+        size = paletteSize;
+        encoding = sfFramePalette;
+    }
+    lzSize = sfFrameStore_compressLz(encoder->pixels, count, encoder->lz, size - 1, encoder->table);
+    if (lzSize != 0) {
+        data = encoder->lz;
+        size = lzSize;
+        encoding = sfFrameLz;
+    }
+    while (frameStore->dataSize + size > *capacity) {
+        grown = sfAllocator_realloc(frameStore->data, *capacity * 2);
+        if (grown == NULL)
+            return (sfFalse);
+        frameStore->data = grown;
+        *capacity *= 2;
+    }
+    memcpy(frameStore->data + frameStore->dataSize, data, size);
+    frameStore->frames[frame] = (sfCompressedFrame){frameStore->dataSize, size, encoding};
+    frameStore->dataSize += size;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStore_compress(sfFrameStore *frameStore, const sfImage *image)
+{
+    size_t count = (size_t)frameStore->frameSize.x * frameStore->frameSize.y;
+    size_t capacity = count * 4 * frameStore->frameCount / 4 + 64;
+    size_t width = sfImage_getSize(image).x;
+    const sfUint8 *source = sfImage_getPixelsPtr(image);
+    sfFrameStoreEncoder encoder = {
+        sfAllocator_malloc(count * 4),
+        sfAllocator_malloc(count * 4),
+        sfAllocator_malloc(count * 4),
+        sfAllocator_malloc(count),
+        sfAllocator_malloc(sizeof(size_t) << SF_FRAMESTORE_HASH_BITS)
+    };
+    sfBool success = encoder.pixels && encoder.lz && encoder.palette && encoder.indices && encoder.table;
+
+    frameStore->data = success ? sfAllocator_malloc(capacity) : NULL;
+    success = success && source != NULL && frameStore->data != NULL;
+    for (size_t i = 0; success && i < frameStore->frameCount; i++) {
+        sfIntRect rect = sfFrameStore_getFrameRect(frameStore, i);
+
+        for (size_t y = 0; y < frameStore->frameSize.y; y++) {
+            memcpy(encoder.pixels + y * frameStore->frameSize.x,
+                source + (((size_t)rect.top + y) * width + (size_t)rect.left) * 4, (size_t)frameStore->frameSize.x * 4);
+        }
+        success = sfFrameStore_compressFrame(frameStore, &encoder, &capacity, i);
+    }
+    if (success && frameStore->dataSize + 1 < capacity) {
+        sfUint8 *shrunk = sfAllocator_realloc(frameStore->data, frameStore->dataSize + 1);
+
+        if (shrunk != NULL)
+            frameStore->data = shrunk;
+    }
+    sfAllocator_free(encoder.pixels);
+    sfAllocator_free(encoder.lz);
+    sfAllocator_free(encoder.palette);
+    sfAllocator_free(encoder.indices);
+    sfAllocator_free(encoder.table);
+    return (success);
+}
+
+////////////////////////////////////////////////////////////
+sfFrameStore *sfFrameStore_createFromImage(const sfImage *image, sfVector2u frameSize, size_t cacheSize)
+{
+    sfFrameStore *frameStore = NULL;
+    sfVector2u size = {0, 0};
+    size_t frameBytes = (size_t)frameSize.x * frameSize.y * 4;
+
+    if (image == NULL || frameSize.x == 0 || frameSize.y == 0)
+        return (NULL);
+    size = sfImage_getSize(image);
+    if (size.x < frameSize.x || size.y < frameSize.y)
+        return (NULL);
+    frameStore = sfAllocator_calloc(1, sizeof(sfFrameStore));
+    if (frameStore == NULL)
+        return (NULL);
+    frameStore->frameSize = frameSize;
+    frameStore->gridSize = (sfVector2u){size.x / frameSize.x, size.y / frameSize.y};
+    frameStore->frameCount = (size_t)frameStore->gridSize.x * frameStore->gridSize.y;
+    frameStore->cacheSize = cacheSize > 0 ? cacheSize : 1;
+    frameStore->frames = sfAllocator_calloc(frameStore->frameCount, sizeof(sfCompressedFrame));
+    frameStore->cache = sfAllocator_calloc(frameStore->cacheSize, sizeof(sfFrameCacheSlot));
+    if (frameStore->frames == NULL || frameStore->cache == NULL || !sfFrameStore_compress(frameStore, image)) {
+        sfFrameStore_destroy(frameStore);
+        return (NULL);
+    }
+    frameStore->cache[0].pixels = sfAllocator_malloc(frameStore->cacheSize * frameBytes);
+    if (frameStore->cache[0].pixels == NULL) {
+        sfFrameStore_destroy(frameStore);
+        return (NULL);
+    }
+    for (size_t i = 0; i < frameStore->cacheSize; i++) {
+        frameStore->cache[i].frame = SF_FRAMESTORE_NO_FRAME;
+        frameStore->cache[i].pixels = frameStore->cache[0].pixels + i * frameBytes;
+    }
+    return (frameStore);
+}
+
+////////////////////////////////////////////////////////////
+sfFrameStore *sfFrameStore_createFromFile(const char *filename, sfVector2u frameSize, size_t cacheSize)
+{
+    sfImage *image = NULL;
+    sfFrameStore *frameStore = NULL;
+
+    if (filename == NULL)
+        return (NULL);
+    image = sfImage_createFromFile(filename);
+    if (image == NULL)
+        return (NULL);
+    frameStore = sfFrameStore_createFromImage(image, frameSize, cacheSize);
+    sfImage_destroy(image);
+    return (frameStore);
+}
+
+////////////////////////////////////////////////////////////
+void sfFrameStore_destroy(sfFrameStore *frameStore)
+{
+    if (frameStore == NULL)
+        return;
+    if (frameStore->cache != NULL)
+        sfAllocator_free(frameStore->cache[0].pixels);
+    sfAllocator_free(frameStore->cache);
+    sfAllocator_free(frameStore->frames);
+    sfAllocator_free(frameStore->data);
+    sfAllocator_free(frameStore);
+}
+
+////////////////////////////////////////////////////////////
+const sfUint8 *sfFrameStore_getFrame(sfFrameStore *frameStore, size_t frame)
+{
+    sfFrameCacheSlot *slot = NULL;
+
+    if (frameStore == NULL || frame >= frameStore->frameCount)
+        return (NULL);
+    frameStore->tick++;
+    for (size_t i = 0; i < frameStore->cacheSize; i++) {
+        if (frameStore->cache[i].frame == frame) {
+            frameStore->cache[i].lastUse = frameStore->tick;
+            frameStore->hits++;
+            return (frameStore->cache[i].pixels);
+        }
+        if (slot == NULL || frameStore->cache[i].frame == SF_FRAMESTORE_NO_FRAME ||
+            (slot->frame != SF_FRAMESTORE_NO_FRAME && frameStore->cache[i].lastUse < slot->lastUse))
+            slot = &frameStore->cache[i];
+    }
+    frameStore->misses++;
+    if (!sfFrameStore_decompressFrame(frameStore, frame, slot->pixels)) {
+        slot->frame = SF_FRAMESTORE_NO_FRAME;
+        return (NULL);
+    }
+    slot->frame = frame;
+    slot->lastUse = frameStore->tick;
+    return (slot->pixels);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfFrameStore_decompressFrame(const sfFrameStore *frameStore, size_t frame, sfUint8 *pixels)
+{
+    const sfCompressedFrame *compressed = NULL;
+    size_t count = 0;
+
+    if (frameStore == NULL || pixels == NULL || frame >= frameStore->frameCount)
+        return (sfFalse);
+    compressed = &frameStore->frames[frame];
+    count = (size_t)frameStore->frameSize.x * frameStore->frameSize.y;
+    switch (compressed->encoding) {
+        case sfFrameLz:
+            return (sfFrameStore_decompressLz(frameStore->data + compressed->offset, compressed->size, pixels, count));
+        case sfFramePalette:
+            return (sfFrameStore_decompressPalette(frameStore->data + compressed->offset, compressed->size, pixels, count));
+        default:
+            if (compressed->size != count * 4)
+                return (sfFalse);
+            memcpy(pixels, frameStore->data + compressed->offset, compressed->size);
+            return (sfTrue);
+    }
+}
+
+////////////////////////////////////////////////////////////
+sfIntRect sfFrameStore_getFrameRect(const sfFrameStore *frameStore, size_t frame)
+{
+    if (frameStore == NULL || frame >= frameStore->frameCount)
+        return ((sfIntRect){0, 0, 0, 0});
+    return ((sfIntRect){
+        (int)(frame % frameStore->gridSize.x * frameStore->frameSize.x),
+        (int)(frame / frameStore->gridSize.x * frameStore->frameSize.y),
+        (int)frameStore->frameSize.x,
+        (int)frameStore->frameSize.y
+    });
+}
+
+////////////////////////////////////////////////////////////
+sfTexture *sfFrameStore_createTexture(const sfFrameStore *frameStore)
+{
+    sfTexture *texture = NULL;
+
+    if (frameStore == NULL)
+        return (NULL);
+    texture = sfTexture_create(frameStore->gridSize.x * frameStore->frameSize.x,
+        frameStore->gridSize.y * frameStore->frameSize.y);
+    if (texture == NULL)
+        return (NULL);
+    if (sfFrameStore_updateTexture(frameStore, texture, 0, frameStore->frameCount) != frameStore->frameCount) {
+        sfTexture_destroy(texture);
+        return (NULL);
+    }
+    return (texture);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfFrameStore_updateTexture(const sfFrameStore *frameStore, sfTexture *texture, size_t first, size_t count)
+{
+    size_t mark = 0;
+    sfUint8 *pixels = NULL;
+    size_t uploaded = 0;
+
+    if (frameStore == NULL || texture == NULL || first >= frameStore->frameCount)
+        return (0);
+    if (count > frameStore->frameCount - first)
+        count = frameStore->frameCount - first;
+    pixels = sfAllocator_getScratch((size_t)frameStore->frameSize.x * frameStore->frameSize.y * 4, &mark);
+    if (pixels == NULL)
+        return (0);
+    for (size_t i = first; i < first + count && sfFrameStore_decompressFrame(frameStore, i, pixels); i++) {
+        sfIntRect rect = sfFrameStore_getFrameRect(frameStore, i);
+
+        sfTexture_updateFromPixels(texture, pixels, frameStore->frameSize.x, frameStore->frameSize.y,
+            (unsigned int)rect.left, (unsigned int)rect.top);
+        uploaded++;
+    }
+    sfAllocator_releaseScratch(pixels, mark);
+    return (uploaded);
+}
+
+////////////////////////////////////////////////////////////
+float sfFrameStore_getCompressionRatio(const sfFrameStore *frameStore)
+{
+    if (frameStore == NULL || frameStore->dataSize == 0)
+        return (1);
+    return ((float)((double)frameStore->frameCount * frameStore->frameSize.x * frameStore->frameSize.y * 4
+        / frameStore->dataSize));
+}
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <stdlib.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/HitMask.h>
+
+////////////////////////////////////////////////////////////
+sfHitMask *sfHitMask_createFromImage(const sfImage *image, sfUint8 alphaThreshold)
+{
+    sfHitMask *hitMask = NULL;
+    const sfUint8 *pixels = NULL;
+    sfUint64 *row = NULL;
+
+    if (image == NULL)
+        return (NULL);
+    hitMask = sfAllocator_malloc(sizeof(sfHitMask));
+    if (hitMask == NULL)
+        return (NULL);
+    hitMask->size = sfImage_getSize(image);
+    hitMask->wordsPerRow = (hitMask->size.x + 63) / 64;
+    hitMask->bits = sfAllocator_calloc(hitMask->wordsPerRow * hitMask->size.y, sizeof(sfUint64));
+    if (hitMask->bits == NULL) {
+        sfAllocator_free(hitMask);
+        return (NULL);
+    }
+    pixels = sfImage_getPixelsPtr(image);
+    for (unsigned int y = 0; y < hitMask->size.y; y++) {
+        row = hitMask->bits + y * hitMask->wordsPerRow;
+        for (unsigned int x = 0; x < hitMask->size.x; x++, pixels += 4)
+            row[x >> 6] |= (sfUint64)(pixels[3] > alphaThreshold) << (x & 63);
+    }
+    return (hitMask);
+}
+
+////////////////////////////////////////////////////////////
+sfHitMask *sfHitMask_createFromTexture(const sfTexture *texture, sfUint8 alphaThreshold)
+{
+    sfImage *image = NULL;
+    sfHitMask *hitMask = NULL;
+
+    if (texture == NULL)
+        return (NULL);
+    image = sfTexture_copyToImage(texture);
+    if (image == NULL)
+        return (NULL);
+    hitMask = sfHitMask_createFromImage(image, alphaThreshold);
+    sfImage_destroy(image);
+    return (hitMask);
+}
+
+////////////////////////////////////////////////////////////
+void sfHitMask_destroy(sfHitMask *hitMask)
+{
+    if (hitMask == NULL)
+        return;
+    sfAllocator_free(hitMask->bits);
+    sfAllocator_free(hitMask);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_getPixel(const sfHitMask *hitMask, unsigned int x, unsigned int y)
+{
+    if (hitMask == NULL || x >= hitMask->size.x || y >= hitMask->size.y)
+        return (sfFalse);
+    return ((hitMask->bits[y * hitMask->wordsPerRow + (x >> 6)] >> (x & 63)) & 1);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_containsLocalPoint(const sfHitMask *hitMask, sfIntRect textureRect, sfVector2f point)
+{
+    int width = textureRect.width < 0 ? -textureRect.width : textureRect.width;
+    int height = textureRect.height < 0 ? -textureRect.height : textureRect.height;
+    int x = 0;
+    int y = 0;
+
+    if (point.x < 0 || point.y < 0 || point.x >= width || point.y >= height)
+        return (sfFalse);
+    // A negative extent flips the area, the texels are read from its far edge
+    x = textureRect.width < 0 ? textureRect.left - 1 - (int)point.x : textureRect.left + (int)point.x;
+    y = textureRect.height < 0 ? textureRect.top - 1 - (int)point.y : textureRect.top + (int)point.y;
+    if (x < 0 || y < 0)
+        return (sfFalse);
+    return (sfHitMask_getPixel(hitMask, (unsigned int)x, (unsigned int)y));
+}
+
+////////////////////////////////////////////////////////////
+/// Read the 64 mask bits starting at pixel (x, y), bits past
+/// the right edge of \a rect are cleared
+////////////////////////////////////////////////////////////
+static sfUint64 sfHitMask_getWord(const sfHitMask *hitMask, sfIntRect rect, int x, int y)
+{
+    const sfUint64 *row = hitMask->bits + (size_t)y * hitMask->wordsPerRow;
+    size_t word = (size_t)x >> 6;
+    unsigned int shift = x & 63;
+    int remaining = rect.left + rect.width - x;
+    sfUint64 bits = row[word] >> shift;
+
+    if (shift && word + 1 < hitMask->wordsPerRow)
+        bits |= row[word + 1] << (64 - shift);
+    if (remaining < 64)
+        bits &= ((sfUint64)1 << remaining) - 1;
+    return (bits);
+}
+
+////////////////////////////////////////////////////////////
+/// Clip a texture rect to the size of its hit mask
+////////////////////////////////////////////////////////////
+static sfIntRect sfHitMask_clipRect(const sfHitMask *hitMask, sfIntRect rect)
+{
+    int right = rect.left + rect.width;
+    int bottom = rect.top + rect.height;
+
+    rect.left = rect.left < 0 ? 0 : rect.left;
+    rect.top = rect.top < 0 ? 0 : rect.top;
+    right = right > (int)hitMask->size.x ? (int)hitMask->size.x : right;
+    bottom = bottom > (int)hitMask->size.y ? (int)hitMask->size.y : bottom;
+    rect.width = right > rect.left ? right - rect.left : 0;
+    rect.height = bottom > rect.top ? bottom - rect.top : 0;
+    return (rect);
+}
+
+////////////////////////////////////////////////////////////
+/// Check if a transform is a translation by a whole number of pixels
+////////////////////////////////////////////////////////////
+static sfBool sfHitMask_isIntegerTranslation(const sfTransform *transform, int *x, int *y)
+{
+    const float *m = transform->matrix;
+
+    if (m[0] != 1 || m[1] != 0 || m[3] != 0 || m[4] != 1)
+        return (sfFalse);
+    if (m[2] != floorf(m[2]) || m[5] != floorf(m[5]))
+        return (sfFalse);
+    *x = (int)m[2];
+    *y = (int)m[5];
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Overlap test of two masks placed at integer offsets
+////////////////////////////////////////////////////////////
+static sfBool sfHitMask_intersectsTranslated(const sfHitMask *hitMaskA, sfIntRect rectA, sfVector2i offsetA, const sfHitMask *hitMaskB, sfIntRect rectB, sfVector2i offsetB)
+{
+    int left = offsetA.x > offsetB.x ? offsetA.x : offsetB.x;
+    int top = offsetA.y > offsetB.y ? offsetA.y : offsetB.y;
+    int right = offsetA.x + rectA.width;
+    int bottom = offsetA.y + rectA.height;
+
+    right = offsetB.x + rectB.width < right ? offsetB.x + rectB.width : right;
+    bottom = offsetB.y + rectB.height < bottom ? offsetB.y + rectB.height : bottom;
+    for (int y = top; y < bottom; y++) {
+        for (int x = left; x < right; x += 64) {
+            sfUint64 a = sfHitMask_getWord(hitMaskA, rectA, rectA.left + x - offsetA.x, rectA.top + y - offsetA.y);
+            sfUint64 b = sfHitMask_getWord(hitMaskB, rectB, rectB.left + x - offsetB.x, rectB.top + y - offsetB.y);
+
+            if (right - x < 64)
+                a &= ((sfUint64)1 << (right - x)) - 1;
+            if (a & b)
+                return (sfTrue);
+        }
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfHitMask_intersects(const sfHitMask *hitMaskA, sfIntRect rectA, const sfTransform *transformA, const sfHitMask *hitMaskB, sfIntRect rectB, const sfTransform *transformB)
+{
+    sfVector2i offsetA;
+    sfVector2i offsetB;
+    sfFloatRect boundsA;
+    sfFloatRect boundsB;
+    sfFloatRect overlap;
+    sfTransform inverseA;
+    sfTransform inverseB;
+    sfVector2f point;
+
+    if (hitMaskA == NULL || hitMaskB == NULL || transformA == NULL || transformB == NULL)
+        return (sfFalse);
+    // Flipped areas are read backwards, only the per-pixel path handles them
+    if (rectA.width >= 0 && rectA.height >= 0 && rectB.width >= 0 && rectB.height >= 0 &&
+        sfHitMask_isIntegerTranslation(transformA, &offsetA.x, &offsetA.y) && sfHitMask_isIntegerTranslation(transformB, &offsetB.x, &offsetB.y)) {
+        rectA = sfHitMask_clipRect(hitMaskA, rectA);
+        rectB = sfHitMask_clipRect(hitMaskB, rectB);
+        return (sfHitMask_intersectsTranslated(hitMaskA, rectA, offsetA, hitMaskB, rectB, offsetB));
+    }
+    boundsA = sfTransform_transformRect(transformA, (sfFloatRect){0, 0, abs(rectA.width), abs(rectA.height)});
+    boundsB = sfTransform_transformRect(transformB, (sfFloatRect){0, 0, abs(rectB.width), abs(rectB.height)});
+    if (!sfFloatRect_intersects(&boundsA, &boundsB, &overlap))
+        return (sfFalse);
+    inverseA = sfTransform_getInverse(transformA);
+    inverseB = sfTransform_getInverse(transformB);
+    for (float y = floorf(overlap.top) + 0.5f; y < overlap.top + overlap.height; y++) {
+        for (float x = floorf(overlap.left) + 0.5f; x < overlap.left + overlap.width; x++) {
+            point = sfTransform_transformPoint(&inverseA, (sfVector2f){x, y});
+            if (!sfHitMask_containsLocalPoint(hitMaskA, rectA, point))
+                continue;
+            point = sfTransform_transformPoint(&inverseB, (sfVector2f){x, y});
+            if (sfHitMask_containsLocalPoint(hitMaskB, rectB, point))
+                return (sfTrue);
+        }
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isPixelCollision(const sfSprite *spriteA, const sfHitMask *hitMaskA, const sfSprite *spriteB, const sfHitMask *hitMaskB)
+{
+    sfTransform transformA;
+    sfTransform transformB;
+
+    if (spriteA == NULL || spriteB == NULL)
+        return (sfFalse);
+    transformA = sfSprite_getTransform(spriteA);
+    transformB = sfSprite_getTransform(spriteB);
+    return (sfHitMask_intersects(hitMaskA, sfSprite_getTextureRect(spriteA), &transformA, hitMaskB, sfSprite_getTextureRect(spriteB), &transformB));
+}
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/HitTester.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+#define SF_HITTESTER_ARRAYS 10
+
+////////////////////////////////////////////////////////////
+/// Point every array of the hit tester into one block
+////////////////////////////////////////////////////////////
+static void sfHitTester_bind(sfHitTester *hitTester, float *block)
+{
+    float **arrays[SF_HITTESTER_ARRAYS] = {
+        &hitTester->a, &hitTester->b, &hitTester->c, &hitTester->d, &hitTester->e,
+        &hitTester->f, &hitTester->left, &hitTester->top, &hitTester->right, &hitTester->bottom
+    };
+
+    for (size_t i = 0; i < SF_HITTESTER_ARRAYS; i++)
+        *arrays[i] = block + i * hitTester->capacity;
+}
+
+////////////////////////////////////////////////////////////
+/// Grow the arrays of the hit tester, keeping their content
+////////////////////////////////////////////////////////////
+static sfBool sfHitTester_reserve(sfHitTester *hitTester, size_t capacity)
+{
+    float *block = sfAllocator_malloc(capacity * SF_HITTESTER_ARRAYS * sizeof(float));
+    float *previous = hitTester->a;
+    size_t previousCapacity = hitTester->capacity;
+
+    if (block == NULL)
+        return (sfFalse);
+    hitTester->capacity = capacity;
+    for (size_t i = 0; previous != NULL && i < SF_HITTESTER_ARRAYS; i++) {
+        for (size_t j = 0; j < hitTester->count; j++)
+            block[i * capacity + j] = previous[i * previousCapacity + j];
+    }
+    sfHitTester_bind(hitTester, block);
+    sfAllocator_free(previous);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfHitTester *sfHitTester_create(size_t capacity)
+{
+    sfHitTester *hitTester = sfAllocator_malloc(sizeof(sfHitTester));
+
+    if (hitTester == NULL)
+        return (NULL);
+    hitTester->a = NULL;
+    hitTester->count = 0;
+    hitTester->capacity = 0;
+    if (!sfHitTester_reserve(hitTester, capacity ? capacity : 16)) {
+        sfAllocator_free(hitTester);
+        return (NULL);
+    }
+    return (hitTester);
+}
+
+////////////////////////////////////////////////////////////
+void sfHitTester_destroy(sfHitTester *hitTester)
+{
+    if (hitTester == NULL)
+        return;
+    sfAllocator_free(hitTester->a);
+    sfAllocator_free(hitTester);
+}
+
+////////////////////////////////////////////////////////////
+void sfHitTester_clear(sfHitTester *hitTester)
+{
+    if (hitTester == NULL)
+        return;
+    hitTester->count = 0;
+}
+
+////////////////////////////////////////////////////////////
+/// Make room for one more entry, its content is set by the caller
+////////////////////////////////////////////////////////////
+static size_t sfHitTester_push(sfHitTester *hitTester)
+{
+    if (hitTester->count == hitTester->capacity && !sfHitTester_reserve(hitTester, hitTester->capacity * 2))
+        return ((size_t)-1);
+    return (hitTester->count++);
+}
+
+////////////////////////////////////////////////////////////
+/// Store the inverse transform and local bounds of an entry
+////////////////////////////////////////////////////////////
+static void sfHitTester_store(sfHitTester *hitTester, size_t index, sfTransform inverse, sfFloatRect bounds)
+{
+    hitTester->a[index] = inverse.matrix[0];
+    hitTester->b[index] = inverse.matrix[1];
+    hitTester->c[index] = inverse.matrix[2];
+    hitTester->d[index] = inverse.matrix[3];
+    hitTester->e[index] = inverse.matrix[4];
+    hitTester->f[index] = inverse.matrix[5];
+    hitTester->left[index] = bounds.left;
+    hitTester->top[index] = bounds.top;
+    hitTester->right[index] = bounds.left + bounds.width;
+    hitTester->bottom[index] = bounds.top + bounds.height;
+}
+
+////////////////////////////////////////////////////////////
+size_t sfHitTester_addSprite(sfHitTester *hitTester, const sfSprite *sprite)
+{
+    size_t index = 0;
+
+    if (hitTester == NULL || sprite == NULL)
+        return ((size_t)-1);
+    index = sfHitTester_push(hitTester);
+    sfHitTester_setSprite(hitTester, index, sprite);
+    return (index);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfHitTester_addAnimatedSprite(sfHitTester *hitTester, const sfAnimatedSprite *animatedSprite)
+{
+    size_t index = 0;
+
+    if (hitTester == NULL || animatedSprite == NULL)
+        return ((size_t)-1);
+    index = sfHitTester_push(hitTester);
+    sfHitTester_setAnimatedSprite(hitTester, index, animatedSprite);
+    return (index);
+}
+
+////////////////////////////////////////////////////////////
+void sfHitTester_setSprite(sfHitTester *hitTester, size_t index, const sfSprite *sprite)
+{
+    if (hitTester == NULL || sprite == NULL || index >= hitTester->count)
+        return;
+    sfHitTester_store(hitTester, index, sfSprite_getInverseTransform(sprite), sfSprite_getLocalBounds(sprite));
+}
+
+////////////////////////////////////////////////////////////
+void sfHitTester_setAnimatedSprite(sfHitTester *hitTester, size_t index, const sfAnimatedSprite *animatedSprite)
+{
+    if (hitTester == NULL || animatedSprite == NULL || index >= hitTester->count)
+        return;
+    sfHitTester_store(hitTester, index, sfSprite_getInverseTransform(animatedSprite->sprite), sfAnimatedSprite_getLocalBounds(animatedSprite));
+}
+
+////////////////////////////////////////////////////////////
+size_t sfHitTester_testPoint(const sfHitTester *hitTester, sfVector2f point, sfUint8 *results)
+{
+    const float *restrict a = NULL;
+    const float *restrict b = NULL;
+    const float *restrict c = NULL;
+    const float *restrict d = NULL;
+    const float *restrict e = NULL;
+    const float *restrict f = NULL;
+    const float *restrict left = NULL;
+    const float *restrict top = NULL;
+    const float *restrict right = NULL;
+    const float *restrict bottom = NULL;
+    sfUint8 *restrict hits = results;
+    size_t total = 0;
+    size_t count = 0;
+
+    if (hitTester == NULL || results == NULL)
+        return (0);
+    a = hitTester->a;
+    b = hitTester->b;
+    c = hitTester->c;
+    d = hitTester->d;
+    e = hitTester->e;
+    f = hitTester->f;
+    left = hitTester->left;
+    top = hitTester->top;
+    right = hitTester->right;
+    bottom = hitTester->bottom;
+    total = hitTester->count;
+    SF_PROFILE_COUNT(hitTests, total);
+    for (size_t i = 0; i < total; i++) {
+        float localX = a[i] * point.x + b[i] * point.y + c[i];
+        float localY = d[i] * point.x + e[i] * point.y + f[i];
+
+        hits[i] = (localX >= left[i]) & (localX < right[i]) & (localY >= top[i]) & (localY < bottom[i]);
+    }
+    for (size_t i = 0; i < total; i++)
+        count += hits[i];
+    return (count);
+}
+
+////////////////////////////////////////////////////////////
+size_t sfHitTester_findTop(const sfHitTester *hitTester, sfVector2f point)
+{
+    if (hitTester == NULL)
+        return ((size_t)-1);
+    SF_PROFILE_COUNT(hitTests, hitTester->count);
+    for (size_t i = hitTester->count; i-- > 0;) {
+        float localX = hitTester->a[i] * point.x + hitTester->b[i] * point.y + hitTester->c[i];
+        float localY = hitTester->d[i] * point.x + hitTester->e[i] * point.y + hitTester->f[i];
+
+        if (localX >= hitTester->left[i] && localX < hitTester->right[i] && localY >= hitTester->top[i] && localY < hitTester->bottom[i])
+            return (i);
+    }
+    return ((size_t)-1);
+}
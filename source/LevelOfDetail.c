@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/LevelOfDetail.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+sfLevelOfDetail sfLevelOfDetail_getDefault(void)
+{
+    return ((sfLevelOfDetail){
+        {128, 48, 16},
+        {SF_BEZIERCURVE_SAMPLE_COUNT, 2500, 600, 150},
+        {1, 2, 4, 8},
+        {0, 0, 0, 0}
+    });
+}
+
+////////////////////////////////////////////////////////////
+size_t sfLevelOfDetail_select(const sfLevelOfDetail *lod, float screenSize)
+{
+    size_t level = 0;
+
+    if (lod == NULL)
+        return (0);
+    while (level < SF_LEVELOFDETAIL_COUNT - 1 && screenSize < lod->thresholds[level])
+        level++;
+    return (level);
+}
+
+////////////////////////////////////////////////////////////
+void sfLevelOfDetail_resetCounts(sfLevelOfDetail *lod)
+{
+    if (lod == NULL)
+        return;
+    for (size_t i = 0; i < SF_LEVELOFDETAIL_COUNT; i++)
+        lod->counts[i] = 0;
+}
+
+////////////////////////////////////////////////////////////
+float sfRenderWindow_getScreenSize(const sfRenderWindow *renderWindow, sfFloatRect bounds, const sfTransform *transform)
+{
+    sfVector2f corners[4] = {
+        {bounds.left, bounds.top},
+        {bounds.left + bounds.width, bounds.top},
+        {bounds.left + bounds.width, bounds.top + bounds.height},
+        {bounds.left, bounds.top + bounds.height}
+    };
+    sfVector2i pixel;
+    sfVector2i min = {0, 0};
+    sfVector2i max = {0, 0};
+
+    if (renderWindow == NULL)
+        return (0);
+    for (size_t i = 0; i < 4; i++) {
+        if (transform != NULL)
+            corners[i] = sfTransform_transformPoint(transform, corners[i]);
+        pixel = sfRenderWindow_mapCoordsToPixel(renderWindow, corners[i], NULL);
+        min.x = i == 0 || pixel.x < min.x ? pixel.x : min.x;
+        min.y = i == 0 || pixel.y < min.y ? pixel.y : min.y;
+        max.x = i == 0 || pixel.x > max.x ? pixel.x : max.x;
+        max.y = i == 0 || pixel.y > max.y ? pixel.y : max.y;
+    }
+    return ((float)(max.x - min.x > max.y - min.y ? max.x - min.x : max.y - min.y));
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawBezierCurveLod(sfRenderWindow *renderWindow, const sfBezierCurve *bezierCurve, sfLevelOfDetail *lod, const sfRenderStates *states)
+{
+    sfVertex *vertices = NULL;
+    size_t mark = 0;
+    size_t level = 0;
+    size_t sampleCount = 0;
+
+    if (bezierCurve == NULL || lod == NULL || bezierCurve->pointCount < 2)
+        return;
+    level = sfLevelOfDetail_select(lod, sfRenderWindow_getScreenSize(renderWindow,
+        sfBezierCurve_getBounds(bezierCurve), states ? &states->transform : NULL));
+    lod->counts[level]++;
+    sampleCount = lod->curveSamples[level];
+    if (sampleCount == 0)
+        return;
+    SF_PROFILE_BEGIN(drawBezierCurve);
+    SF_PROFILE_COUNT(curveDraws, 1);
+    vertices = sfAllocator_getScratch(sampleCount * sizeof(sfVertex), &mark);
+    if (vertices != NULL) {
+        sfBezierCurve_sample(bezierCurve, vertices, sampleCount);
+        sfRenderWindow_drawPrimitives(renderWindow, vertices, sampleCount, sfPoints, states);
+        sfAllocator_releaseScratch(vertices, mark);
+    }
+    SF_PROFILE_END(drawBezierCurve, curveDrawTime);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawAnimatedSpriteLod(sfRenderWindow *renderWindow, sfAnimatedSprite *animatedSprite, sfLevelOfDetail *lod, const sfRenderStates *states)
+{
+    sfRenderStates frameStates = {sfBlendAlpha, sfTransform_Identity, NULL, NULL};
+    sfTransform transform;
+    sfVertex quad[4];
+    size_t level = 0;
+    size_t reduction = 0;
+    float factor = 1;
+
+    if (animatedSprite == NULL || lod == NULL)
+        return;
+    level = sfLevelOfDetail_select(lod, sfRenderWindow_getScreenSize(renderWindow,
+        sfAnimatedSprite_getGlobalBounds(animatedSprite), states ? &states->transform : NULL));
+    lod->counts[level]++;
+    SF_PROFILE_BEGIN(drawAnimatedSprite);
+    SF_PROFILE_COUNT(animatedSpriteDraws, 1);
+    if (lod->updateIntervals[level] < 2 || animatedSprite->lodTick % lod->updateIntervals[level] == 0) {
+        sfAnimatedSprite_update(animatedSprite);
+        // With a fixed step every draw is a step, the skipped ones are caught up here
+        if (animatedSprite->fixedStep > 0 && animatedSprite->lodSkipped > 0)
+            sfAnimatedSprite_advance(animatedSprite, sfMicroseconds(animatedSprite->fixedStep * (sfInt64)animatedSprite->lodSkipped));
+        animatedSprite->lodSkipped = 0;
+    } else {
+        animatedSprite->lodSkipped++;
+    }
+    animatedSprite->lodTick++;
+    reduction = level < animatedSprite->lodCount ? level : animatedSprite->lodCount;
+    if (reduction == 0) {
+        sfRenderWindow_drawAnimatedSpriteFrame(renderWindow, animatedSprite, states);
+        SF_PROFILE_END(drawAnimatedSprite, animatedSpriteDrawTime);
+        return;
+    }
+    // Same quad as the full size frame, sampled from the reduced copy of the texture
+    factor = (float)(1 << reduction);
+    sfAnimatedSprite_getVertices(animatedSprite, quad);
+    for (int i = 0; i < 4; i++)
+        quad[i].texCoords = (sfVector2f){quad[i].texCoords.x / factor, quad[i].texCoords.y / factor};
+    if (states != NULL)
+        frameStates = *states;
+    transform = sfSprite_getTransform(animatedSprite->sprite);
+    sfTransform_combine(&frameStates.transform, &transform);
+    frameStates.texture = animatedSprite->lodTextures[reduction - 1];
+    sfRenderWindow_drawPrimitives(renderWindow, quad, 4, sfQuads, &frameStates);
+    SF_PROFILE_END(drawAnimatedSprite, animatedSpriteDrawTime);
+}
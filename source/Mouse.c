@@ -26,6 +26,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <SFML/Addition/Mouse.h>
+#include "ProfilerInternal.h"
 
 ////////////////////////////////////////////////////////////
 sfBool sfSprite_isMouseButtonPressed(const sfRenderWindow *renderWindow, const sfSprite *sprite, sfMouseButton mouseButton)
@@ -41,17 +42,107 @@ sfBool sfSprite_isMouseHover(const sfRenderWindow *renderWindow, const sfSprite
     sfVector2i mouse = sfMouse_getPositionRenderWindow(renderWindow);
     sfFloatRect bounds = sfSprite_getGlobalBounds(sprite);
 
+    SF_PROFILE_COUNT(hitTests, 1);
     return (sfFloatRect_contains(&bounds, (float)mouse.x, (float)mouse.y));
 }
 
 ////////////////////////////////////////////////////////////
 sfBool sfAnimatedSprite_isMouseButtonPressed(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, sfMouseButton mouseButton)
 {
-    return (sfSprite_isMouseButtonPressed(renderWindow, animatedSprite->sprite, mouseButton));
+    if (!sfMouse_isButtonPressed(mouseButton))
+        return (sfFalse);
+    return (sfAnimatedSprite_isMouseHover(renderWindow, animatedSprite));
 }
 
 ////////////////////////////////////////////////////////////
 sfBool sfAnimatedSprite_isMouseHover(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite)
 {
-    return (sfSprite_isMouseHover(renderWindow, animatedSprite->sprite));
+    sfVector2i mouse = sfMouse_getPositionRenderWindow(renderWindow);
+    sfFloatRect bounds = sfAnimatedSprite_getGlobalBounds(animatedSprite);
+
+    SF_PROFILE_COUNT(hitTests, 1);
+    return (sfFloatRect_contains(&bounds, (float)mouse.x, (float)mouse.y));
+}
+
+////////////////////////////////////////////////////////////
+/// Map the mouse position into the local space of a sprite
+////////////////////////////////////////////////////////////
+static sfVector2f sfSprite_getMouseLocalPosition(const sfRenderWindow *renderWindow, const sfSprite *sprite)
+{
+    sfVector2i mouse = sfMouse_getPositionRenderWindow(renderWindow);
+    sfTransform inverse = sfSprite_getInverseTransform(sprite);
+
+    SF_PROFILE_COUNT(hitTests, 1);
+    return (sfTransform_transformPoint(&inverse, (sfVector2f){(float)mouse.x, (float)mouse.y}));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverPixel(const sfRenderWindow *renderWindow, const sfSprite *sprite, const sfHitMask *hitMask)
+{
+    sfVector2f point = sfSprite_getMouseLocalPosition(renderWindow, sprite);
+
+    return (sfHitMask_containsLocalPoint(hitMask, sfSprite_getTextureRect(sprite), point));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverPixel(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite)
+{
+    sfVector2i mouse = sfMouse_getPositionRenderWindow(renderWindow);
+
+    SF_PROFILE_COUNT(hitTests, 1);
+    return (sfAnimatedSprite_isPixelHit(animatedSprite, (sfVector2f){(float)mouse.x, (float)mouse.y}));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverOriented(const sfRenderWindow *renderWindow, const sfSprite *sprite)
+{
+    sfVector2f point = sfSprite_getMouseLocalPosition(renderWindow, sprite);
+    sfFloatRect bounds = sfSprite_getLocalBounds(sprite);
+
+    return (sfFloatRect_contains(&bounds, point.x, point.y));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSprite_isMouseHoverPolygon(const sfRenderWindow *renderWindow, const sfSprite *sprite, const sfVector2f *points, size_t pointCount)
+{
+    return (sfPolygon_contains(points, pointCount, sfSprite_getMouseLocalPosition(renderWindow, sprite)));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverOriented(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite)
+{
+    sfVector2f point = sfSprite_getMouseLocalPosition(renderWindow, animatedSprite->sprite);
+    sfFloatRect bounds = sfAnimatedSprite_getLocalBounds(animatedSprite);
+
+    return (sfFloatRect_contains(&bounds, point.x, point.y));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfAnimatedSprite_isMouseHoverPolygon(const sfRenderWindow *renderWindow, const sfAnimatedSprite *animatedSprite, const sfVector2f *points, size_t pointCount)
+{
+    sfVector2f point = sfSprite_getMouseLocalPosition(renderWindow, animatedSprite->sprite);
+    sfFloatRect bounds = sfAnimatedSprite_getLocalBounds(animatedSprite);
+
+    // Nothing is drawn outside the quad of the frame
+    if (!sfFloatRect_contains(&bounds, point.x, point.y))
+        return (sfFalse);
+    return (sfPolygon_contains(points, pointCount, point));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfPolygon_contains(const sfVector2f *points, size_t pointCount, sfVector2f point)
+{
+    sfBool inside = sfFalse;
+    sfVector2f a;
+    sfVector2f b;
+
+    if (points == NULL || pointCount < 3)
+        return (sfFalse);
+    for (size_t i = 0, j = pointCount - 1; i < pointCount; j = i++) {
+        a = points[i];
+        b = points[j];
+        if ((a.y > point.y) != (b.y > point.y) && point.x < (b.x - a.x) * (point.y - a.y) / (b.y - a.y) + a.x)
+            inside = !inside;
+    }
+    return (inside);
 }
@@ -0,0 +1,265 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/MouseDispatcher.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+#define SF_MOUSE_NO_TARGET ((size_t)-1)
+
+////////////////////////////////////////////////////////////
+/// Split an identifier in slot and generation
+////////////////////////////////////////////////////////////
+#define SF_MOUSETARGETID_SLOT(target) ((sfUint32)((target) & 0xFFFFFFFF))
+#define SF_MOUSETARGETID_GENERATION(target) ((sfUint32)((target) >> 32))
+
+////////////////////////////////////////////////////////////
+sfMouseDispatcher *sfMouseDispatcher_create(void)
+{
+    sfMouseDispatcher *dispatcher = sfAllocator_malloc(sizeof(sfMouseDispatcher));
+
+    if (dispatcher == NULL)
+        return (NULL);
+    dispatcher->targets = NULL;
+    dispatcher->targetCount = 0;
+    dispatcher->targetCapacity = 0;
+    dispatcher->position = (sfVector2i){0, 0};
+    dispatcher->inside = sfFalse;
+    for (size_t i = 0; i < sfMouseButtonCount; i++)
+        dispatcher->pressedTarget[i] = SF_MOUSE_NO_TARGET;
+    return (dispatcher);
+}
+
+////////////////////////////////////////////////////////////
+void sfMouseDispatcher_destroy(sfMouseDispatcher *dispatcher)
+{
+    if (dispatcher == NULL)
+        return;
+    sfAllocator_free(dispatcher->targets);
+    sfAllocator_free(dispatcher);
+}
+
+////////////////////////////////////////////////////////////
+/// Store a target in the first free slot of the dispatcher
+////////////////////////////////////////////////////////////
+static sfMouseTargetId sfMouseDispatcher_addTarget(sfMouseDispatcher *dispatcher, sfMouseTarget target)
+{
+    sfMouseTarget *targets = NULL;
+    size_t capacity = 0;
+    size_t index = 0;
+
+    if (dispatcher == NULL)
+        return (SF_MOUSETARGETID_INVALID);
+    while (index < dispatcher->targetCount && dispatcher->targets[index].callback != NULL)
+        index++;
+    if (index >= 0xFFFFFFFF)
+        return (SF_MOUSETARGETID_INVALID);
+    if (index == dispatcher->targetCapacity) {
+        capacity = dispatcher->targetCapacity ? dispatcher->targetCapacity * 2 : 16;
+        targets = sfAllocator_realloc(dispatcher->targets, capacity * sizeof(sfMouseTarget));
+        if (targets == NULL)
+            return (SF_MOUSETARGETID_INVALID);
+        // New slots start free, at generation 0
+        memset(targets + dispatcher->targetCapacity, 0, (capacity - dispatcher->targetCapacity) * sizeof(sfMouseTarget));
+        dispatcher->targets = targets;
+        dispatcher->targetCapacity = capacity;
+    }
+    if (index == dispatcher->targetCount)
+        dispatcher->targetCount++;
+    // Odd while live, the slots past the count keep their generation when trimmed
+    target.generation = dispatcher->targets[index].generation + 1;
+    dispatcher->targets[index] = target;
+    return (((sfMouseTargetId)target.generation << 32) | index);
+}
+
+////////////////////////////////////////////////////////////
+sfMouseTargetId sfMouseDispatcher_addSprite(sfMouseDispatcher *dispatcher, const sfSprite *sprite, sfMouseTargetCallback callback, void *userData)
+{
+    if (sprite == NULL || callback == NULL)
+        return (SF_MOUSETARGETID_INVALID);
+    return (sfMouseDispatcher_addTarget(dispatcher, (sfMouseTarget){sprite, NULL, callback, userData, sfFalse, 0}));
+}
+
+////////////////////////////////////////////////////////////
+sfMouseTargetId sfMouseDispatcher_addAnimatedSprite(sfMouseDispatcher *dispatcher, const sfAnimatedSprite *animatedSprite, sfMouseTargetCallback callback, void *userData)
+{
+    if (animatedSprite == NULL || callback == NULL)
+        return (SF_MOUSETARGETID_INVALID);
+    return (sfMouseDispatcher_addTarget(dispatcher, (sfMouseTarget){animatedSprite->sprite, animatedSprite, callback, userData, sfFalse, 0}));
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfMouseDispatcher_remove(sfMouseDispatcher *dispatcher, sfMouseTargetId target)
+{
+    size_t index = SF_MOUSETARGETID_SLOT(target);
+
+    if (dispatcher == NULL || index >= dispatcher->targetCount)
+        return (sfFalse);
+    if (dispatcher->targets[index].callback == NULL || dispatcher->targets[index].generation != SF_MOUSETARGETID_GENERATION(target))
+        return (sfFalse);
+    dispatcher->targets[index].callback = NULL;
+    dispatcher->targets[index].generation++;
+    for (size_t i = 0; i < sfMouseButtonCount; i++) {
+        if (dispatcher->pressedTarget[i] == index)
+            dispatcher->pressedTarget[i] = SF_MOUSE_NO_TARGET;
+    }
+    while (dispatcher->targetCount > 0 && dispatcher->targets[dispatcher->targetCount - 1].callback == NULL)
+        dispatcher->targetCount--;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Check if a point of the window is over a target
+////////////////////////////////////////////////////////////
+static sfBool sfMouseTarget_contains(const sfMouseTarget *target, sfVector2i position)
+{
+    sfTransform inverse = sfSprite_getInverseTransform(target->sprite);
+    sfVector2f point = sfTransform_transformPoint(&inverse, (sfVector2f){(float)position.x, (float)position.y});
+    sfFloatRect bounds;
+
+    SF_PROFILE_COUNT(hitTests, 1);
+    if (target->animatedSprite == NULL) {
+        bounds = sfSprite_getLocalBounds(target->sprite);
+        return (sfFloatRect_contains(&bounds, point.x, point.y));
+    }
+    if (target->animatedSprite->hitMask != NULL)
+        return (sfAnimatedSprite_isPixelHit(target->animatedSprite, (sfVector2f){(float)position.x, (float)position.y}));
+    bounds = sfAnimatedSprite_getLocalBounds(target->animatedSprite);
+    return (sfFloatRect_contains(&bounds, point.x, point.y));
+}
+
+////////////////////////////////////////////////////////////
+/// Send an event to a target
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcher_emit(sfMouseDispatcher *dispatcher, size_t target, sfMouseTargetEventType type, sfMouseButton button, sfVector2i delta)
+{
+    sfMouseTarget *mouseTarget = &dispatcher->targets[target];
+    sfMouseTargetEvent event = {type, button, dispatcher->position, delta};
+
+    if (mouseTarget->callback != NULL)
+        mouseTarget->callback(&event, mouseTarget->userData);
+}
+
+////////////////////////////////////////////////////////////
+/// Update the hover state of every target and return the top one
+////////////////////////////////////////////////////////////
+static size_t sfMouseDispatcher_hover(sfMouseDispatcher *dispatcher)
+{
+    size_t top = SF_MOUSE_NO_TARGET;
+    sfBool hovered = sfFalse;
+
+    for (size_t i = 0; i < dispatcher->targetCount; i++) {
+        if (dispatcher->targets[i].callback == NULL)
+            continue;
+        hovered = dispatcher->inside && sfMouseTarget_contains(&dispatcher->targets[i], dispatcher->position);
+        if (hovered)
+            top = i;
+        if (hovered == dispatcher->targets[i].hovered)
+            continue;
+        dispatcher->targets[i].hovered = hovered;
+        sfMouseDispatcher_emit(dispatcher, i, hovered ? sfMouseTargetEnter : sfMouseTargetLeave, sfMouseButtonCount, (sfVector2i){0, 0});
+    }
+    return (top);
+}
+
+////////////////////////////////////////////////////////////
+/// Process a mouse move event
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcher_onMove(sfMouseDispatcher *dispatcher, sfVector2i position)
+{
+    sfVector2i delta = {position.x - dispatcher->position.x, position.y - dispatcher->position.y};
+
+    if (dispatcher->inside && delta.x == 0 && delta.y == 0)
+        return;
+    dispatcher->position = position;
+    dispatcher->inside = sfTrue;
+    sfMouseDispatcher_hover(dispatcher);
+    for (size_t i = 0; i < sfMouseButtonCount; i++) {
+        if (dispatcher->pressedTarget[i] != SF_MOUSE_NO_TARGET)
+            sfMouseDispatcher_emit(dispatcher, dispatcher->pressedTarget[i], sfMouseTargetDrag, (sfMouseButton)i, delta);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Process a mouse button event
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcher_onButton(sfMouseDispatcher *dispatcher, sfMouseButton button, sfVector2i position, sfBool pressed)
+{
+    size_t pressedTarget = SF_MOUSE_NO_TARGET;
+    size_t top = SF_MOUSE_NO_TARGET;
+
+    if ((unsigned int)button >= sfMouseButtonCount)
+        return;
+    dispatcher->position = position;
+    dispatcher->inside = sfTrue;
+    top = sfMouseDispatcher_hover(dispatcher);
+    if (pressed) {
+        dispatcher->pressedTarget[button] = top;
+        if (top != SF_MOUSE_NO_TARGET)
+            sfMouseDispatcher_emit(dispatcher, top, sfMouseTargetPress, button, (sfVector2i){0, 0});
+        return;
+    }
+    pressedTarget = dispatcher->pressedTarget[button];
+    dispatcher->pressedTarget[button] = SF_MOUSE_NO_TARGET;
+    if (pressedTarget == SF_MOUSE_NO_TARGET)
+        return;
+    sfMouseDispatcher_emit(dispatcher, pressedTarget, sfMouseTargetRelease, button, (sfVector2i){0, 0});
+    if (pressedTarget == top)
+        sfMouseDispatcher_emit(dispatcher, pressedTarget, sfMouseTargetClick, button, (sfVector2i){0, 0});
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfMouseDispatcher_handleEvent(sfMouseDispatcher *dispatcher, const sfEvent *event)
+{
+    if (dispatcher == NULL || event == NULL)
+        return (sfFalse);
+    switch (event->type) {
+    case sfEvtMouseMoved:
+        sfMouseDispatcher_onMove(dispatcher, (sfVector2i){event->mouseMove.x, event->mouseMove.y});
+        return (sfTrue);
+    case sfEvtMouseButtonPressed:
+    case sfEvtMouseButtonReleased:
+        sfMouseDispatcher_onButton(dispatcher, event->mouseButton.button, (sfVector2i){event->mouseButton.x, event->mouseButton.y}, event->type == sfEvtMouseButtonPressed);
+        return (sfTrue);
+    case sfEvtMouseLeft:
+        dispatcher->inside = sfFalse;
+        sfMouseDispatcher_hover(dispatcher);
+        return (sfTrue);
+    default:
+        return (sfFalse);
+    }
+}
+
+////////////////////////////////////////////////////////////
+void sfMouseDispatcher_update(sfMouseDispatcher *dispatcher)
+{
+    if (dispatcher == NULL)
+        return;
+    sfMouseDispatcher_hover(dispatcher);
+}
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <SFML/System/Clock.h>
+#include <SFML/Addition/Allocator.h>
+#include "ProfilerInternal.h"
+
+////////////////////////////////////////////////////////////
+/// Complete event of a Chrome trace
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char *name;
+    sfInt64 start;
+    sfInt64 duration;
+    unsigned int thread;
+} sfProfilerEvent;
+
+////////////////////////////////////////////////////////////
+sfProfilerCounters sfProfiler_stats;
+static _Atomic(sfClock *) sfProfiler_clock = NULL;
+static atomic_flag sfProfiler_clockLock = ATOMIC_FLAG_INIT;
+static sfProfilerEvent *sfProfiler_events = NULL;
+static atomic_size_t sfProfiler_eventCount = 0;
+static size_t sfProfiler_eventCapacity = 0;
+static atomic_bool sfProfiler_tracing = sfFalse;
+static atomic_uint sfProfiler_threadCount = 0;
+static _Thread_local unsigned int sfProfiler_thread = 0;
+
+////////////////////////////////////////////////////////////
+/// Read and clear the counters, one relaxed access each
+////////////////////////////////////////////////////////////
+#define SF_PROFILER_LOAD(counter) atomic_load_explicit(&sfProfiler_stats.counter, memory_order_relaxed)
+#define SF_PROFILER_CLEAR(counter) atomic_store_explicit(&sfProfiler_stats.counter, 0, memory_order_relaxed)
+
+////////////////////////////////////////////////////////////
+sfProfilerStats sfProfiler_getStats(void)
+{
+    return ((sfProfilerStats){
+        SF_PROFILER_LOAD(curveDraws),
+        SF_PROFILER_LOAD(curveSamples),
+        SF_PROFILER_LOAD(vertexAppends),
+        SF_PROFILER_LOAD(animatedSpriteDraws),
+        SF_PROFILER_LOAD(animatedSpriteUpdates),
+        SF_PROFILER_LOAD(textureRectChanges),
+        SF_PROFILER_LOAD(hitTests),
+        SF_PROFILER_LOAD(curveDrawTime),
+        SF_PROFILER_LOAD(animatedSpriteDrawTime)
+    });
+}
+
+////////////////////////////////////////////////////////////
+void sfProfiler_resetStats(void)
+{
+    SF_PROFILER_CLEAR(curveDraws);
+    SF_PROFILER_CLEAR(curveSamples);
+    SF_PROFILER_CLEAR(vertexAppends);
+    SF_PROFILER_CLEAR(animatedSpriteDraws);
+    SF_PROFILER_CLEAR(animatedSpriteUpdates);
+    SF_PROFILER_CLEAR(textureRectChanges);
+    SF_PROFILER_CLEAR(hitTests);
+    SF_PROFILER_CLEAR(curveDrawTime);
+    SF_PROFILER_CLEAR(animatedSpriteDrawTime);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_startTrace(size_t capacity)
+{
+    sfProfilerEvent *events = sfAllocator_malloc(capacity * sizeof(sfProfilerEvent));
+
+    if (events == NULL || capacity == 0) {
+        sfAllocator_free(events);
+        return (sfFalse);
+    }
+    atomic_store(&sfProfiler_tracing, sfFalse);
+    sfAllocator_free(sfProfiler_events);
+    sfProfiler_events = events;
+    sfProfiler_eventCapacity = capacity;
+    atomic_store(&sfProfiler_eventCount, 0);
+    atomic_store(&sfProfiler_tracing, sfTrue);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void sfProfiler_stopTrace(void)
+{
+    atomic_store(&sfProfiler_tracing, sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfProfiler_saveTrace(const char *filename)
+{
+    FILE *file = fopen(filename, "w");
+    size_t count = atomic_load(&sfProfiler_eventCount);
+
+    if (file == NULL)
+        return (sfFalse);
+    // The count goes on past the capacity when events are dropped
+    count = count < sfProfiler_eventCapacity ? count : sfProfiler_eventCapacity;
+    fprintf(file, "{\"traceEvents\":[\n");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(file, "{\"name\":\"%s\",\"cat\":\"csfml-addition\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,\"pid\":1,\"tid\":%u}%s\n",
+            sfProfiler_events[i].name, (long long)sfProfiler_events[i].start, (long long)sfProfiler_events[i].duration,
+            sfProfiler_events[i].thread, i + 1 < count ? "," : "");
+    }
+    fprintf(file, "],\"displayTimeUnit\":\"ms\"}\n");
+    return (fclose(file) == 0);
+}
+
+////////////////////////////////////////////////////////////
+sfInt64 sfProfiler_now(void)
+{
+    sfClock *clock = atomic_load_explicit(&sfProfiler_clock, memory_order_acquire);
+
+    // Created once, the threads arriving meanwhile wait for it
+    if (clock == NULL) {
+        while (atomic_flag_test_and_set_explicit(&sfProfiler_clockLock, memory_order_acquire));
+        clock = atomic_load_explicit(&sfProfiler_clock, memory_order_relaxed);
+        if (clock == NULL) {
+            clock = sfClock_create();
+            atomic_store_explicit(&sfProfiler_clock, clock, memory_order_release);
+        }
+        atomic_flag_clear_explicit(&sfProfiler_clockLock, memory_order_release);
+    }
+    if (clock == NULL)
+        return (0);
+    return (sfClock_getElapsedTime(clock).microseconds);
+}
+
+////////////////////////////////////////////////////////////
+void sfProfiler_endScope(const char *name, sfInt64 start, _Atomic sfInt64 *total)
+{
+    sfInt64 duration = sfProfiler_now() - start;
+    size_t index = 0;
+
+    atomic_fetch_add_explicit(total, duration, memory_order_relaxed);
+    if (!atomic_load_explicit(&sfProfiler_tracing, memory_order_relaxed))
+        return;
+    index = atomic_fetch_add_explicit(&sfProfiler_eventCount, 1, memory_order_relaxed);
+    if (index >= sfProfiler_eventCapacity)
+        return;
+    if (sfProfiler_thread == 0)
+        sfProfiler_thread = atomic_fetch_add(&sfProfiler_threadCount, 1) + 1;
+    sfProfiler_events[index] = (sfProfilerEvent){name, start, duration, sfProfiler_thread};
+}
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_PROFILERINTERNAL_H
+    #define SFML_PROFILERINTERNAL_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdatomic.h>
+#include <SFML/Addition/Profiler.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Counters behind sfProfilerStats, updated atomically
+///
+/// This header is private to the library sources, the
+/// instrumentation is only compiled in when the library is
+/// built with CSFML_ADDITION_PROFILING.
+///
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    _Atomic sfUint64 curveDraws;
+    _Atomic sfUint64 curveSamples;
+    _Atomic sfUint64 vertexAppends;
+    _Atomic sfUint64 animatedSpriteDraws;
+    _Atomic sfUint64 animatedSpriteUpdates;
+    _Atomic sfUint64 textureRectChanges;
+    _Atomic sfUint64 hitTests;
+    _Atomic sfInt64 curveDrawTime;
+    _Atomic sfInt64 animatedSpriteDrawTime;
+} sfProfilerCounters;
+
+////////////////////////////////////////////////////////////
+/// \brief Statistics updated by the instrumentation macros
+///
+////////////////////////////////////////////////////////////
+extern sfProfilerCounters sfProfiler_stats;
+
+////////////////////////////////////////////////////////////
+/// \brief Get the time elapsed since the profiler started, in microseconds
+///
+/// The clock is created by the first call, whatever the
+/// thread making it.
+///
+////////////////////////////////////////////////////////////
+sfInt64 sfProfiler_now(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Close a timed scope
+///
+/// \param name     Name of the scope, must be a string literal
+/// \param start    Value of sfProfiler_now when the scope was opened
+/// \param total    Timer receiving the duration of the scope
+///
+////////////////////////////////////////////////////////////
+void sfProfiler_endScope(const char *name, sfInt64 start, _Atomic sfInt64 *total);
+
+////////////////////////////////////////////////////////////
+// Instrumentation macros
+////////////////////////////////////////////////////////////
+#ifdef CSFML_ADDITION_PROFILING
+    #define SF_PROFILE_COUNT(counter, amount) \
+        ((void)atomic_fetch_add_explicit(&sfProfiler_stats.counter, (sfUint64)(amount), memory_order_relaxed))
+    #define SF_PROFILE_BEGIN(scope) sfInt64 sfProfileStart_##scope = sfProfiler_now()
+    #define SF_PROFILE_END(scope, timer) sfProfiler_endScope(#scope, sfProfileStart_##scope, &sfProfiler_stats.timer)
+#else
+    #define SF_PROFILE_COUNT(counter, amount) ((void)0)
+    #define SF_PROFILE_BEGIN(scope) ((void)0)
+    #define SF_PROFILE_END(scope, timer) ((void)0)
+#endif
+
+#endif // SFML_PROFILERINTERNAL_H
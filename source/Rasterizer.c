@@ -0,0 +1,465 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/Rasterizer.h>
+#include "WorkerGroup.h"
+
+////////////////////////////////////////////////////////////
+/// Distance between the points of a flattened curve, in pixels
+////////////////////////////////////////////////////////////
+#define SF_RASTERIZER_FLATNESS 2.f
+
+////////////////////////////////////////////////////////////
+/// Smaller areas are drawn on the calling thread only
+////////////////////////////////////////////////////////////
+#define SF_RASTERIZER_PARALLEL_AREA (256 * 256)
+
+////////////////////////////////////////////////////////////
+/// Description of one draw shared by the threads
+////////////////////////////////////////////////////////////
+typedef struct sfRasterJob sfRasterJob;
+struct sfRasterJob
+{
+    void (*drawBand)(const sfRasterJob *job, int top, int bottom, float *coverage);
+    sfUint8 *pixels;
+    unsigned int width;
+    int left;
+    int top;
+    int right;
+    int bottom;
+    int tileHeight;
+    unsigned int tileCount;
+    atomic_uint nextTile;
+    sfColor color;
+    const sfVector2f *points;
+    size_t pointCount;
+    float thickness;
+    sfTransform inverse;
+    sfFloatRect quad;
+    sfVector2f texOrigin;
+    sfVector2f texAxisX;
+    sfVector2f texAxisY;
+    const sfUint8 *sheet;
+    sfVector2u sheetSize;
+};
+
+////////////////////////////////////////////////////////////
+/// Blend a color over a pixel the way sfBlendAlpha does
+////////////////////////////////////////////////////////////
+static void sfRasterizer_blend(sfUint8 *pixel, sfColor color, unsigned int alpha)
+{
+    unsigned int inverse = 255 - alpha;
+
+    pixel[0] = (color.r * alpha + pixel[0] * inverse + 127) / 255;
+    pixel[1] = (color.g * alpha + pixel[1] * inverse + 127) / 255;
+    pixel[2] = (color.b * alpha + pixel[2] * inverse + 127) / 255;
+    pixel[3] = alpha + (pixel[3] * inverse + 127) / 255;
+}
+
+////////////////////////////////////////////////////////////
+/// Keep the highest coverage of a pixel of the band
+////////////////////////////////////////////////////////////
+static void sfRasterizer_plot(const sfRasterJob *job, float *coverage, int top, int bottom, int x, int y, float value)
+{
+    float *cell = NULL;
+
+    if (x < job->left || x >= job->right || y < top || y >= bottom)
+        return;
+    cell = coverage + (size_t)(y - top) * (job->right - job->left) + (x - job->left);
+    if (value > *cell)
+        *cell = value;
+}
+
+////////////////////////////////////////////////////////////
+/// Xiaolin Wu's anti-aliased line, integer coordinates are pixel centers
+////////////////////////////////////////////////////////////
+static void sfRasterizer_plotLine(const sfRasterJob *job, float *coverage, int top, int bottom, sfVector2f a, sfVector2f b)
+{
+    int steep = fabsf(b.y - a.y) > fabsf(b.x - a.x);
+    float x0 = (steep ? a.y : a.x) - 0.5f;
+    float y0 = (steep ? a.x : a.y) - 0.5f;
+    float x1 = (steep ? b.y : b.x) - 0.5f;
+    float y1 = (steep ? b.x : b.y) - 0.5f;
+    float intensity = job->thickness < 1 ? job->thickness : 1;
+    float tmp, gradient, xend, yend, xgap, intery;
+    int xpixel1, xpixel2, ypixel;
+
+    if (x0 > x1) {
+        tmp = x0; x0 = x1; x1 = tmp;
+        tmp = y0; y0 = y1; y1 = tmp;
+    }
+    gradient = x1 - x0 == 0 ? 1 : (y1 - y0) / (x1 - x0);
+    xend = roundf(x0);
+    yend = y0 + gradient * (xend - x0);
+    xgap = 1 - (x0 + 0.5f - floorf(x0 + 0.5f));
+    xpixel1 = (int)xend;
+    ypixel = (int)floorf(yend);
+    tmp = yend - floorf(yend);
+    if (steep) {
+        sfRasterizer_plot(job, coverage, top, bottom, ypixel, xpixel1, (1 - tmp) * xgap * intensity);
+        sfRasterizer_plot(job, coverage, top, bottom, ypixel + 1, xpixel1, tmp * xgap * intensity);
+    } else {
+        sfRasterizer_plot(job, coverage, top, bottom, xpixel1, ypixel, (1 - tmp) * xgap * intensity);
+        sfRasterizer_plot(job, coverage, top, bottom, xpixel1, ypixel + 1, tmp * xgap * intensity);
+    }
+    intery = yend + gradient;
+    xend = roundf(x1);
+    yend = y1 + gradient * (xend - x1);
+    xgap = x1 + 0.5f - floorf(x1 + 0.5f);
+    xpixel2 = (int)xend;
+    ypixel = (int)floorf(yend);
+    tmp = yend - floorf(yend);
+    if (steep) {
+        sfRasterizer_plot(job, coverage, top, bottom, ypixel, xpixel2, (1 - tmp) * xgap * intensity);
+        sfRasterizer_plot(job, coverage, top, bottom, ypixel + 1, xpixel2, tmp * xgap * intensity);
+    } else {
+        sfRasterizer_plot(job, coverage, top, bottom, xpixel2, ypixel, (1 - tmp) * xgap * intensity);
+        sfRasterizer_plot(job, coverage, top, bottom, xpixel2, ypixel + 1, tmp * xgap * intensity);
+    }
+    for (int x = xpixel1 + 1; x < xpixel2; x++, intery += gradient) {
+        ypixel = (int)floorf(intery);
+        tmp = intery - floorf(intery);
+        if (steep) {
+            sfRasterizer_plot(job, coverage, top, bottom, ypixel, x, (1 - tmp) * intensity);
+            sfRasterizer_plot(job, coverage, top, bottom, ypixel + 1, x, tmp * intensity);
+        } else {
+            sfRasterizer_plot(job, coverage, top, bottom, x, ypixel, (1 - tmp) * intensity);
+            sfRasterizer_plot(job, coverage, top, bottom, x, ypixel + 1, tmp * intensity);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Thick segment, the coverage falls off over one pixel at the edge
+////////////////////////////////////////////////////////////
+static void sfRasterizer_plotThickLine(const sfRasterJob *job, float *coverage, int top, int bottom, sfVector2f a, sfVector2f b)
+{
+    float radius = job->thickness / 2;
+    sfVector2f ab = {b.x - a.x, b.y - a.y};
+    float length = ab.x * ab.x + ab.y * ab.y;
+    int minX = (int)floorf(fminf(a.x, b.x) - radius - 1);
+    int maxX = (int)ceilf(fmaxf(a.x, b.x) + radius + 1);
+    int minY = (int)floorf(fminf(a.y, b.y) - radius - 1);
+    int maxY = (int)ceilf(fmaxf(a.y, b.y) + radius + 1);
+    float t, dx, dy;
+
+    minX = minX < job->left ? job->left : minX;
+    maxX = maxX > job->right ? job->right : maxX;
+    minY = minY < top ? top : minY;
+    maxY = maxY > bottom ? bottom : maxY;
+    for (int y = minY; y < maxY; y++) {
+        for (int x = minX; x < maxX; x++) {
+            t = length > 0 ? ((x + 0.5f - a.x) * ab.x + (y + 0.5f - a.y) * ab.y) / length : 0;
+            t = t < 0 ? 0 : (t > 1 ? 1 : t);
+            dx = x + 0.5f - (a.x + ab.x * t);
+            dy = y + 0.5f - (a.y + ab.y * t);
+            t = radius + 0.5f - sqrtf(dx * dx + dy * dy);
+            if (t > 0)
+                sfRasterizer_plot(job, coverage, top, bottom, x, y, t > 1 ? 1 : t);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Draw the rows [top, bottom[ of a curve
+////////////////////////////////////////////////////////////
+static void sfRasterizer_drawCurveBand(const sfRasterJob *job, int top, int bottom, float *coverage)
+{
+    int width = job->right - job->left;
+    float reach = job->thickness / 2 + 2;
+    sfVector2f a, b;
+    sfUint8 *row = NULL;
+    float *cell = NULL;
+
+    memset(coverage, 0, sizeof(float) * width * (bottom - top));
+    for (size_t i = 0; i + 1 < job->pointCount; i++) {
+        a = job->points[i];
+        b = job->points[i + 1];
+        if (fminf(a.y, b.y) - reach >= bottom || fmaxf(a.y, b.y) + reach < top)
+            continue;
+        if (job->thickness <= 1)
+            sfRasterizer_plotLine(job, coverage, top, bottom, a, b);
+        else
+            sfRasterizer_plotThickLine(job, coverage, top, bottom, a, b);
+    }
+    for (int y = top; y < bottom; y++) {
+        row = job->pixels + (size_t)(y - job->top) * job->width * 4;
+        cell = coverage + (size_t)(y - top) * width;
+        for (int x = 0; x < width; x++) {
+            if (cell[x] > 0)
+                sfRasterizer_blend(row + x * 4, job->color, (unsigned int)(job->color.a * cell[x] + 0.5f));
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Draw the rows [top, bottom[ of a sprite
+////////////////////////////////////////////////////////////
+static void sfRasterizer_drawSpriteBand(const sfRasterJob *job, int top, int bottom, float *coverage)
+{
+    const float *m = job->inverse.matrix;
+    const sfUint8 *texel = NULL;
+    sfColor color;
+    float px, py, lx, ly;
+    int tx, ty;
+
+    (void)coverage;
+    for (int y = top; y < bottom; y++) {
+        for (int x = job->left; x < job->right; x++) {
+            px = x + 0.5f;
+            py = y + 0.5f;
+            lx = m[0] * px + m[1] * py + m[2] - job->quad.left;
+            ly = m[3] * px + m[4] * py + m[5] - job->quad.top;
+            if (lx < 0 || ly < 0 || lx >= job->quad.width || ly >= job->quad.height)
+                continue;
+            tx = (int)floorf(job->texOrigin.x + lx * job->texAxisX.x + ly * job->texAxisY.x);
+            ty = (int)floorf(job->texOrigin.y + lx * job->texAxisX.y + ly * job->texAxisY.y);
+            if (tx < 0 || ty < 0 || (unsigned int)tx >= job->sheetSize.x || (unsigned int)ty >= job->sheetSize.y)
+                continue;
+            texel = job->sheet + ((size_t)ty * job->sheetSize.x + tx) * 4;
+            color.r = texel[0] * job->color.r / 255;
+            color.g = texel[1] * job->color.g / 255;
+            color.b = texel[2] * job->color.b / 255;
+            sfRasterizer_blend(job->pixels + ((size_t)(y - job->top) * job->width + (x - job->left)) * 4, color, texel[3] * job->color.a / 255);
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Draw bands until there is none left
+////////////////////////////////////////////////////////////
+static void sfRasterizer_work(sfRasterJob *job)
+{
+    float *coverage = NULL;
+    size_t mark = 0;
+    unsigned int tile = 0;
+    int top = 0;
+    int bottom = 0;
+
+    if (job->drawBand == sfRasterizer_drawCurveBand) {
+        coverage = sfAllocator_getScratch(sizeof(float) * (job->right - job->left) * job->tileHeight, &mark);
+        if (coverage == NULL)
+            return;
+    }
+    while ((tile = atomic_fetch_add(&job->nextTile, 1)) < job->tileCount) {
+        top = job->top + (int)tile * job->tileHeight;
+        bottom = top + job->tileHeight < job->bottom ? top + job->tileHeight : job->bottom;
+        job->drawBand(job, top, bottom, coverage);
+    }
+    if (coverage != NULL)
+        sfAllocator_releaseScratch(coverage, mark);
+}
+
+////////////////////////////////////////////////////////////
+/// Entry point of the parked worker threads
+////////////////////////////////////////////////////////////
+static void sfRasterizer_workerMain(void *userData, unsigned int index)
+{
+    (void)index;
+    sfRasterizer_work(((sfRasterizer *)userData)->job);
+}
+
+////////////////////////////////////////////////////////////
+/// Clip the area of a job to the image and share its bands
+////////////////////////////////////////////////////////////
+static void sfRasterizer_run(sfRasterizer *rasterizer, sfImage *image, sfRasterJob *job, sfFloatRect bounds)
+{
+    sfVector2u size = sfImage_getSize(image);
+    const sfUint8 *source = sfImage_getPixelsPtr(image);
+    sfImage *area = NULL;
+    size_t mark = 0;
+
+    job->left = (int)floorf(bounds.left) < 0 ? 0 : (int)floorf(bounds.left);
+    job->top = (int)floorf(bounds.top) < 0 ? 0 : (int)floorf(bounds.top);
+    job->right = ceilf(bounds.left + bounds.width) > size.x ? (int)size.x : (int)ceilf(bounds.left + bounds.width);
+    job->bottom = ceilf(bounds.top + bounds.height) > size.y ? (int)size.y : (int)ceilf(bounds.top + bounds.height);
+    if (source == NULL || job->left >= job->right || job->top >= job->bottom)
+        return;
+    // sfImage has no mutable accessor, the area is drawn in a copy of its pixels then copied back
+    job->width = (unsigned int)(job->right - job->left);
+    job->pixels = sfAllocator_getScratch((size_t)job->width * (job->bottom - job->top) * 4, &mark);
+    if (job->pixels == NULL)
+        return;
+    for (int y = job->top; y < job->bottom; y++)
+        memcpy(job->pixels + (size_t)(y - job->top) * job->width * 4, source + ((size_t)y * size.x + job->left) * 4, (size_t)job->width * 4);
+    job->tileHeight = rasterizer != NULL && rasterizer->tileHeight > 0 ? (int)rasterizer->tileHeight : SF_RASTERIZER_TILE_HEIGHT;
+    job->tileCount = (job->bottom - job->top + job->tileHeight - 1) / job->tileHeight;
+    atomic_init(&job->nextTile, 0);
+    if (rasterizer == NULL || rasterizer->threadCount < 2 || job->tileCount < 2 ||
+        (job->right - job->left) * (job->bottom - job->top) < SF_RASTERIZER_PARALLEL_AREA) {
+        sfRasterizer_work(job);
+    } else {
+        rasterizer->job = job;
+        sfWorkerGroup_launch(rasterizer->group);
+        sfRasterizer_work(job);
+        sfWorkerGroup_wait(rasterizer->group);
+        rasterizer->job = NULL;
+    }
+    area = sfImage_createFromPixels(job->width, (unsigned int)(job->bottom - job->top), job->pixels);
+    if (area != NULL) {
+        sfImage_copyImage(image, area, (unsigned int)job->left, (unsigned int)job->top, (sfIntRect){0, 0, 0, 0}, sfFalse);
+        sfImage_destroy(area);
+    }
+    sfAllocator_releaseScratch(job->pixels, mark);
+}
+
+////////////////////////////////////////////////////////////
+sfRasterizer *sfRasterizer_create(unsigned int threadCount)
+{
+    sfRasterizer *rasterizer = sfAllocator_malloc(sizeof(sfRasterizer));
+
+    if (!rasterizer)
+        return (NULL);
+    threadCount = threadCount < 1 ? 1 : threadCount;
+    rasterizer->group = NULL;
+    rasterizer->threadCount = threadCount;
+    rasterizer->tileHeight = SF_RASTERIZER_TILE_HEIGHT;
+    rasterizer->job = NULL;
+    if (threadCount > 1) {
+        rasterizer->group = sfWorkerGroup_create(threadCount - 1, sfRasterizer_workerMain, rasterizer);
+        if (rasterizer->group == NULL) {
+            sfRasterizer_destroy(rasterizer);
+            return (NULL);
+        }
+    }
+    return (rasterizer);
+}
+
+////////////////////////////////////////////////////////////
+void sfRasterizer_destroy(sfRasterizer *rasterizer)
+{
+    if (rasterizer == NULL)
+        return;
+    sfWorkerGroup_destroy(rasterizer->group);
+    sfAllocator_free(rasterizer);
+}
+
+////////////////////////////////////////////////////////////
+void sfRasterizer_drawBezierCurve(sfRasterizer *rasterizer, sfImage *image, const sfBezierCurve *bezierCurve, float thickness, const sfTransform *transform)
+{
+    sfRasterJob job = {0};
+    sfVector2f *points = NULL;
+    sfVector2f *control = NULL;
+    sfFloatRect bounds = {0, 0, 0, 0};
+    float length = 0;
+    float reach = 0;
+    size_t count = 0;
+    size_t mark = 0;
+
+    if (image == NULL || bezierCurve == NULL || bezierCurve->pointCount < 2 || thickness <= 0)
+        return;
+    transform = transform ? transform : &sfTransform_Identity;
+    control = bezierCurve->points;
+    for (size_t i = 0; i + 1 < bezierCurve->pointCount; i++) {
+        sfVector2f a = sfTransform_transformPoint(transform, control[i]);
+        sfVector2f b = sfTransform_transformPoint(transform, control[i + 1]);
+        length += sqrtf((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+    }
+    count = (size_t)(length / SF_RASTERIZER_FLATNESS) + 2;
+    count = count > SF_BEZIERCURVE_SAMPLE_COUNT ? SF_BEZIERCURVE_SAMPLE_COUNT : count;
+    points = sfAllocator_getScratch(sizeof(sfVector2f) * count, &mark);
+    if (points == NULL)
+        return;
+    for (size_t i = 0; i < count; i++)
+        points[i] = sfTransform_transformPoint(transform, sfBezierCurve_calculatePoint(bezierCurve, (float)i / (count - 1)));
+    bounds = (sfFloatRect){points[0].x, points[0].y, points[0].x, points[0].y};
+    for (size_t i = 1; i < count; i++) {
+        bounds.left = fminf(bounds.left, points[i].x);
+        bounds.top = fminf(bounds.top, points[i].y);
+        bounds.width = fmaxf(bounds.width, points[i].x);
+        bounds.height = fmaxf(bounds.height, points[i].y);
+    }
+    reach = thickness / 2 + 2;
+    bounds = (sfFloatRect){bounds.left - reach, bounds.top - reach, bounds.width - bounds.left + 2 * reach, bounds.height - bounds.top + 2 * reach};
+    job.drawBand = sfRasterizer_drawCurveBand;
+    job.color = bezierCurve->color;
+    job.points = points;
+    job.pointCount = count;
+    job.thickness = thickness;
+    sfRasterizer_run(rasterizer, image, &job, bounds);
+    sfAllocator_releaseScratch(points, mark);
+}
+
+////////////////////////////////////////////////////////////
+void sfRasterizer_drawAnimatedSprite(sfRasterizer *rasterizer, sfImage *image, const sfAnimatedSprite *animatedSprite, const sfImage *sheet)
+{
+    sfRasterJob job = {0};
+    sfTransform transform;
+    sfVertex quad[4];
+    sfFloatRect bounds;
+    sfVector2f corner;
+
+    if (image == NULL || animatedSprite == NULL || sheet == NULL)
+        return;
+    // The quad carries the trim offset and the turn of rotated sheet frames
+    sfAnimatedSprite_getVertices(animatedSprite, quad);
+    transform = sfSprite_getTransform(animatedSprite->sprite);
+    job.drawBand = sfRasterizer_drawSpriteBand;
+    job.color = sfSprite_getColor(animatedSprite->sprite);
+    job.inverse = sfTransform_getInverse(&transform);
+    job.quad = (sfFloatRect){quad[0].position.x, quad[0].position.y,
+        quad[2].position.x - quad[0].position.x, quad[2].position.y - quad[0].position.y};
+    if (job.quad.width <= 0 || job.quad.height <= 0)
+        return;
+    job.texOrigin = quad[0].texCoords;
+    job.texAxisX = (sfVector2f){(quad[1].texCoords.x - quad[0].texCoords.x) / job.quad.width,
+        (quad[1].texCoords.y - quad[0].texCoords.y) / job.quad.width};
+    job.texAxisY = (sfVector2f){(quad[3].texCoords.x - quad[0].texCoords.x) / job.quad.height,
+        (quad[3].texCoords.y - quad[0].texCoords.y) / job.quad.height};
+    job.sheet = sfImage_getPixelsPtr(sheet);
+    job.sheetSize = sfImage_getSize(sheet);
+    if (job.sheet == NULL)
+        return;
+    corner = sfTransform_transformPoint(&transform, quad[0].position);
+    bounds = (sfFloatRect){corner.x, corner.y, corner.x, corner.y};
+    for (int i = 1; i < 4; i++) {
+        corner = sfTransform_transformPoint(&transform, quad[i].position);
+        bounds.left = fminf(bounds.left, corner.x);
+        bounds.top = fminf(bounds.top, corner.y);
+        bounds.width = fmaxf(bounds.width, corner.x);
+        bounds.height = fmaxf(bounds.height, corner.y);
+    }
+    bounds.width -= bounds.left;
+    bounds.height -= bounds.top;
+    sfRasterizer_run(rasterizer, image, &job, bounds);
+}
+
+////////////////////////////////////////////////////////////
+void sfImage_drawBezierCurve(sfImage *image, const sfBezierCurve *bezierCurve, float thickness, const sfTransform *transform)
+{
+    sfRasterizer_drawBezierCurve(NULL, image, bezierCurve, thickness, transform);
+}
+
+////////////////////////////////////////////////////////////
+void sfImage_drawAnimatedSprite(sfImage *image, const sfAnimatedSprite *animatedSprite, const sfImage *sheet)
+{
+    sfRasterizer_drawAnimatedSprite(NULL, image, animatedSprite, sheet);
+}
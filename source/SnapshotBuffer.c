@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdatomic.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/SnapshotBuffer.h>
+
+////////////////////////////////////////////////////////////
+/// Flag set on the exchanged index when the writer published
+/// a snapshot the reader did not take yet
+////////////////////////////////////////////////////////////
+#define SF_SNAPSHOT_FRESH 4u
+
+////////////////////////////////////////////////////////////
+/// Index of the snapshot left for the other thread, with the
+/// fresh flag
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    atomic_uint index;
+} sfSnapshotExchange;
+
+////////////////////////////////////////////////////////////
+/// Grow an array to hold at least count elements
+////////////////////////////////////////////////////////////
+static sfBool sfSnapshot_grow(void **array, size_t *capacity, size_t count, size_t size)
+{
+    size_t newCapacity = *capacity ? *capacity : 16;
+    void *newArray = NULL;
+
+    if (count <= *capacity)
+        return (sfTrue);
+    while (newCapacity < count)
+        newCapacity *= 2;
+    newArray = sfAllocator_realloc(*array, newCapacity * size);
+    if (newArray == NULL)
+        return (sfFalse);
+    *array = newArray;
+    *capacity = newCapacity;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfSnapshotBuffer *sfSnapshotBuffer_create(void)
+{
+    sfSnapshotBuffer *snapshotBuffer = sfAllocator_calloc(1, sizeof(sfSnapshotBuffer));
+    sfSnapshotExchange *exchange = NULL;
+
+    if (snapshotBuffer == NULL)
+        return (NULL);
+    exchange = sfAllocator_malloc(sizeof(sfSnapshotExchange));
+    if (exchange == NULL) {
+        sfAllocator_free(snapshotBuffer);
+        return (NULL);
+    }
+    // The writer fills snapshot 0, the reader holds 1 and 2 waits in between
+    atomic_init(&exchange->index, 2);
+    snapshotBuffer->exchange = exchange;
+    snapshotBuffer->writeIndex = 0;
+    snapshotBuffer->readIndex = 1;
+    return (snapshotBuffer);
+}
+
+////////////////////////////////////////////////////////////
+void sfSnapshotBuffer_destroy(sfSnapshotBuffer *snapshotBuffer)
+{
+    if (snapshotBuffer == NULL)
+        return;
+    for (size_t i = 0; i < 3; i++) {
+        sfAllocator_free(snapshotBuffer->snapshots[i].curves);
+        sfAllocator_free(snapshotBuffer->snapshots[i].points);
+        sfAllocator_free(snapshotBuffer->snapshots[i].vertices);
+        sfAllocator_free(snapshotBuffer->snapshots[i].textures);
+    }
+    sfAllocator_free(snapshotBuffer->curves);
+    sfAllocator_free(snapshotBuffer->animatedSprites);
+    sfAllocator_free(snapshotBuffer->exchange);
+    sfAllocator_free(snapshotBuffer);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_addBezierCurve(sfSnapshotBuffer *snapshotBuffer, const sfBezierCurve *bezierCurve)
+{
+    if (snapshotBuffer == NULL || bezierCurve == NULL)
+        return (sfFalse);
+    if (!sfSnapshot_grow((void **)&snapshotBuffer->curves, &snapshotBuffer->curveCapacity,
+        snapshotBuffer->curveCount + 1, sizeof(const sfBezierCurve *)))
+        return (sfFalse);
+    snapshotBuffer->curves[snapshotBuffer->curveCount++] = bezierCurve;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_addAnimatedSprite(sfSnapshotBuffer *snapshotBuffer, const sfAnimatedSprite *animatedSprite)
+{
+    if (snapshotBuffer == NULL || animatedSprite == NULL)
+        return (sfFalse);
+    if (!sfSnapshot_grow((void **)&snapshotBuffer->animatedSprites, &snapshotBuffer->animatedSpriteCapacity,
+        snapshotBuffer->animatedSpriteCount + 1, sizeof(const sfAnimatedSprite *)))
+        return (sfFalse);
+    snapshotBuffer->animatedSprites[snapshotBuffer->animatedSpriteCount++] = animatedSprite;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void sfSnapshotBuffer_clear(sfSnapshotBuffer *snapshotBuffer)
+{
+    if (snapshotBuffer == NULL)
+        return;
+    snapshotBuffer->curveCount = 0;
+    snapshotBuffer->animatedSpriteCount = 0;
+}
+
+////////////////////////////////////////////////////////////
+/// Copy the state of the objects to the snapshot of the writer
+////////////////////////////////////////////////////////////
+static sfBool sfSnapshotBuffer_capture(sfSnapshotBuffer *snapshotBuffer, sfSnapshot *snapshot)
+{
+    const sfAnimatedSprite *animatedSprite = NULL;
+    sfVertex *quad = NULL;
+    sfTransform transform;
+    size_t pointCount = 0;
+
+    for (size_t i = 0; i < snapshotBuffer->curveCount; i++)
+        pointCount += snapshotBuffer->curves[i]->pointCount;
+    if (!sfSnapshot_grow((void **)&snapshot->curves, &snapshot->curveCapacity, snapshotBuffer->curveCount, sizeof(sfBezierCurve)) ||
+        !sfSnapshot_grow((void **)&snapshot->points, &snapshot->pointCapacity, pointCount, sizeof(sfVector2f)))
+        return (sfFalse);
+    if (snapshotBuffer->animatedSpriteCount > snapshot->spriteCapacity) {
+        sfAllocator_free(snapshot->vertices);
+        sfAllocator_free(snapshot->textures);
+        snapshot->vertices = sfAllocator_malloc(snapshotBuffer->animatedSpriteCapacity * 4 * sizeof(sfVertex));
+        snapshot->textures = sfAllocator_malloc(snapshotBuffer->animatedSpriteCapacity * sizeof(const sfTexture *));
+        snapshot->spriteCapacity = snapshot->vertices && snapshot->textures ? snapshotBuffer->animatedSpriteCapacity : 0;
+        if (snapshot->spriteCapacity == 0)
+            return (sfFalse);
+    }
+    pointCount = 0;
+    for (size_t i = 0; i < snapshotBuffer->curveCount; i++) {
+        snapshot->curves[i] = *snapshotBuffer->curves[i];
+        snapshot->curves[i].points = snapshot->points + pointCount;
+        for (size_t j = 0; j < snapshot->curves[i].pointCount; j++)
+            snapshot->points[pointCount + j] = snapshotBuffer->curves[i]->points[j];
+        pointCount += snapshot->curves[i].pointCount;
+    }
+    for (size_t i = 0; i < snapshotBuffer->animatedSpriteCount; i++) {
+        animatedSprite = snapshotBuffer->animatedSprites[i];
+        quad = &snapshot->vertices[i * 4];
+        transform = sfSprite_getTransform(animatedSprite->sprite);
+        sfAnimatedSprite_getVertices(animatedSprite, quad);
+        for (size_t j = 0; j < 4; j++)
+            quad[j].position = sfTransform_transformPoint(&transform, quad[j].position);
+        snapshot->textures[i] = sfSprite_getTexture(animatedSprite->sprite);
+    }
+    snapshot->curveCount = snapshotBuffer->curveCount;
+    snapshot->spriteCount = snapshotBuffer->animatedSpriteCount;
+    snapshot->sequence = ++snapshotBuffer->sequence;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfSnapshotBuffer_publish(sfSnapshotBuffer *snapshotBuffer)
+{
+    sfSnapshotExchange *exchange = NULL;
+    unsigned int previous = 0;
+
+    if (snapshotBuffer == NULL)
+        return (sfFalse);
+    if (!sfSnapshotBuffer_capture(snapshotBuffer, &snapshotBuffer->snapshots[snapshotBuffer->writeIndex]))
+        return (sfFalse);
+    // Release the filled snapshot, and take back whichever one sits in the exchange
+    exchange = snapshotBuffer->exchange;
+    previous = atomic_exchange_explicit(&exchange->index, snapshotBuffer->writeIndex | SF_SNAPSHOT_FRESH, memory_order_acq_rel);
+    snapshotBuffer->writeIndex = previous & ~SF_SNAPSHOT_FRESH;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+const sfSnapshot *sfSnapshotBuffer_acquire(sfSnapshotBuffer *snapshotBuffer)
+{
+    sfSnapshotExchange *exchange = NULL;
+    unsigned int previous = 0;
+
+    if (snapshotBuffer == NULL)
+        return (NULL);
+    exchange = snapshotBuffer->exchange;
+    if (atomic_load_explicit(&exchange->index, memory_order_relaxed) & SF_SNAPSHOT_FRESH) {
+        previous = atomic_exchange_explicit(&exchange->index, snapshotBuffer->readIndex, memory_order_acq_rel);
+        snapshotBuffer->readIndex = previous & ~SF_SNAPSHOT_FRESH;
+    }
+    return (&snapshotBuffer->snapshots[snapshotBuffer->readIndex]);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawSnapshot(sfRenderWindow *renderWindow, const sfSnapshot *snapshot, const sfRenderStates *states)
+{
+    sfRenderStates spriteStates = {sfBlendAlpha, sfTransform_Identity, NULL, NULL};
+    size_t end = 0;
+
+    if (snapshot == NULL)
+        return;
+    for (size_t i = 0; i < snapshot->curveCount; i++)
+        sfRenderWindow_drawBezierCurve(renderWindow, &snapshot->curves[i], states);
+    if (states != NULL)
+        spriteStates = *states;
+    for (size_t i = 0; i < snapshot->spriteCount; i = end) {
+        end = i + 1;
+        while (end < snapshot->spriteCount && snapshot->textures[end] == snapshot->textures[i])
+            end++;
+        spriteStates.texture = snapshot->textures[i];
+        sfRenderWindow_drawPrimitives(renderWindow, &snapshot->vertices[i * 4], (end - i) * 4, sfQuads, &spriteStates);
+    }
+}
@@ -0,0 +1,590 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/SpriteSheet.h>
+
+////////////////////////////////////////////////////////////
+/// Size of the buffer files are read through
+////////////////////////////////////////////////////////////
+#define SF_SPRITESHEET_BUFFER_SIZE 4096
+
+////////////////////////////////////////////////////////////
+/// Deepest nesting of JSON values skipped by the parser
+////////////////////////////////////////////////////////////
+#define SF_SPRITESHEET_MAX_DEPTH 64
+
+////////////////////////////////////////////////////////////
+/// Bound of the frame indices of tags, which fits a size_t
+/// on every platform
+////////////////////////////////////////////////////////////
+#define SF_SPRITESHEET_MAX_INDEX 4294967295.0
+
+////////////////////////////////////////////////////////////
+/// Streaming reader over a file or a block of memory
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    FILE *file;
+    const char *data;
+    size_t size;
+    size_t position;
+    char buffer[SF_SPRITESHEET_BUFFER_SIZE];
+    sfBool failed;
+} sfSpriteSheetReader;
+
+////////////////////////////////////////////////////////////
+/// Frames, tags and names found by a pass of the parser, the
+/// arrays are NULL while counting and hold what was counted
+/// while filling
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSpriteSheetFrame *frames;
+    size_t frameCount;
+    sfSpriteSheetTag *tags;
+    size_t tagCount;
+    char *strings;
+    size_t stringSize;
+    const char *image;
+    size_t frameCapacity;
+    size_t tagCapacity;
+    size_t stringCapacity;
+} sfSpriteSheetTable;
+
+////////////////////////////////////////////////////////////
+static int sfSpriteSheetReader_peek(sfSpriteSheetReader *reader)
+{
+    if (reader->position < reader->size)
+        return ((unsigned char)reader->data[reader->position]);
+    if (reader->file == NULL || reader->failed)
+        return (EOF);
+    reader->size = fread(reader->buffer, 1, SF_SPRITESHEET_BUFFER_SIZE, reader->file);
+    reader->data = reader->buffer;
+    reader->position = 0;
+    return (reader->size > 0 ? (unsigned char)reader->data[0] : EOF);
+}
+
+////////////////////////////////////////////////////////////
+static int sfSpriteSheetReader_next(sfSpriteSheetReader *reader)
+{
+    int c = sfSpriteSheetReader_peek(reader);
+
+    if (c != EOF)
+        reader->position++;
+    return (c);
+}
+
+////////////////////////////////////////////////////////////
+static int sfSpriteSheetReader_skipSpace(sfSpriteSheetReader *reader)
+{
+    int c = sfSpriteSheetReader_peek(reader);
+
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+        reader->position++;
+        c = sfSpriteSheetReader_peek(reader);
+    }
+    return (c);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfSpriteSheetReader_expect(sfSpriteSheetReader *reader, int expected)
+{
+    if (sfSpriteSheetReader_skipSpace(reader) != expected) {
+        reader->failed = sfTrue;
+        return (sfFalse);
+    }
+    reader->position++;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Read a string, writing at most capacity - 1 bytes of it
+/// to output when there is one, and return its full length
+////////////////////////////////////////////////////////////
+static size_t sfSpriteSheetReader_readString(sfSpriteSheetReader *reader, char *output, size_t capacity)
+{
+    size_t length = 0;
+    unsigned int code = 0;
+    char bytes[3];
+    size_t count = 0;
+    int c = 0;
+
+    if (!sfSpriteSheetReader_expect(reader, '"'))
+        return (0);
+    for (;;) {
+        // Plain characters are copied straight from the buffer
+        while (reader->position < reader->size && reader->data[reader->position] != '"' && reader->data[reader->position] != '\\') {
+            if (output != NULL && length + 1 < capacity)
+                output[length] = reader->data[reader->position];
+            length++;
+            reader->position++;
+        }
+        c = sfSpriteSheetReader_next(reader);
+        if (c == '"')
+            break;
+        if (c == EOF) {
+            reader->failed = sfTrue;
+            break;
+        }
+        bytes[0] = (char)c;
+        count = 1;
+        if (c == '\\') {
+            c = sfSpriteSheetReader_next(reader);
+            bytes[0] = c == 'n' ? '\n' : c == 't' ? '\t' : c == 'r' ? '\r' : c == 'b' ? '\b' : c == 'f' ? '\f' : (char)c;
+            if (c == 'u') {
+                code = 0;
+                for (int i = 0; i < 4; i++) {
+                    c = sfSpriteSheetReader_next(reader);
+                    code = code * 16 + (c >= 'a' ? c - 'a' + 10 : c >= 'A' ? c - 'A' + 10 : c - '0');
+                }
+                // Code points are written as UTF-8, surrogates are kept as they are
+                if (code < 0x80) {
+                    bytes[0] = (char)code;
+                } else if (code < 0x800) {
+                    bytes[0] = (char)(0xC0 | (code >> 6));
+                    bytes[1] = (char)(0x80 | (code & 0x3F));
+                    count = 2;
+                } else {
+                    bytes[0] = (char)(0xE0 | (code >> 12));
+                    bytes[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+                    bytes[2] = (char)(0x80 | (code & 0x3F));
+                    count = 3;
+                }
+            }
+        }
+        for (size_t i = 0; i < count; i++, length++) {
+            if (output != NULL && length + 1 < capacity)
+                output[length] = bytes[i];
+        }
+    }
+    if (output != NULL && capacity > 0)
+        output[length < capacity ? length : capacity - 1] = '\0';
+    return (length);
+}
+
+////////////////////////////////////////////////////////////
+static double sfSpriteSheetReader_readNumber(sfSpriteSheetReader *reader)
+{
+    char text[32];
+    size_t length = 0;
+    double value = 0;
+    double scale = 0;
+    sfBool exponent = sfFalse;
+    int c = sfSpriteSheetReader_skipSpace(reader);
+
+    while ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+        if (c >= '0' && c <= '9' && scale == 0)
+            value = value * 10 + (c - '0');
+        else if (c >= '0' && c <= '9')
+            value += (c - '0') * (scale /= 10);
+        else if (c == '.')
+            scale = 1;
+        else if (c == 'e' || c == 'E')
+            exponent = sfTrue;
+        if (length + 1 < sizeof(text))
+            text[length++] = (char)c;
+        reader->position++;
+        c = sfSpriteSheetReader_peek(reader);
+    }
+    text[length] = '\0';
+    if (length == 0)
+        reader->failed = sfTrue;
+    // Metadata numbers are nearly always plain integers, strtod only handles the rest
+    if (exponent)
+        return (strtod(text, NULL));
+    return (length > 0 && text[0] == '-' ? -value : value);
+}
+
+////////////////////////////////////////////////////////////
+/// Read a frame index, failing on a negative, fractional or
+/// too large number instead of casting it
+////////////////////////////////////////////////////////////
+static size_t sfSpriteSheetReader_readIndex(sfSpriteSheetReader *reader)
+{
+    double value = sfSpriteSheetReader_readNumber(reader);
+
+    // The negated test also catches NaN
+    if (!(value >= 0 && value < (double)SF_SPRITESHEET_MAX_INDEX) || value != floor(value)) {
+        reader->failed = sfTrue;
+        return (0);
+    }
+    return ((size_t)value);
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfSpriteSheetReader_readBool(sfSpriteSheetReader *reader)
+{
+    int first = sfSpriteSheetReader_skipSpace(reader);
+    int c = first;
+
+    if (first != 't' && first != 'f') {
+        reader->failed = sfTrue;
+        return (sfFalse);
+    }
+    while (c >= 'a' && c <= 'z') {
+        reader->position++;
+        c = sfSpriteSheetReader_peek(reader);
+    }
+    return (first == 't');
+}
+
+////////////////////////////////////////////////////////////
+/// Move to the next member of an object, after its opening
+/// brace, and read its key
+////////////////////////////////////////////////////////////
+static sfBool sfSpriteSheetReader_nextMember(sfSpriteSheetReader *reader, char *key, size_t capacity)
+{
+    int c = sfSpriteSheetReader_skipSpace(reader);
+
+    if (c == '}' || c == EOF || reader->failed) {
+        reader->failed |= c == EOF;
+        reader->position += c == '}';
+        return (sfFalse);
+    }
+    if (c == ',')
+        reader->position++;
+    sfSpriteSheetReader_readString(reader, key, capacity);
+    return (sfSpriteSheetReader_expect(reader, ':'));
+}
+
+////////////////////////////////////////////////////////////
+/// Move to the next element of an array, after its opening
+/// bracket
+////////////////////////////////////////////////////////////
+static sfBool sfSpriteSheetReader_nextElement(sfSpriteSheetReader *reader)
+{
+    int c = sfSpriteSheetReader_skipSpace(reader);
+
+    if (c == ']' || c == EOF || reader->failed) {
+        reader->failed |= c == EOF;
+        reader->position += c == ']';
+        return (sfFalse);
+    }
+    if (c == ',')
+        reader->position++;
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetReader_skipValue(sfSpriteSheetReader *reader, size_t depth)
+{
+    char key[1];
+    int c = sfSpriteSheetReader_skipSpace(reader);
+
+    if (depth > SF_SPRITESHEET_MAX_DEPTH) {
+        reader->failed = sfTrue;
+        return;
+    }
+    if (c == '"') {
+        sfSpriteSheetReader_readString(reader, NULL, 0);
+    } else if (c == '{') {
+        reader->position++;
+        while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key)))
+            sfSpriteSheetReader_skipValue(reader, depth + 1);
+    } else if (c == '[') {
+        reader->position++;
+        while (sfSpriteSheetReader_nextElement(reader))
+            sfSpriteSheetReader_skipValue(reader, depth + 1);
+    } else if (c == 't' || c == 'f' || c == 'n') {
+        while (c >= 'a' && c <= 'z') {
+            reader->position++;
+            c = sfSpriteSheetReader_peek(reader);
+        }
+    } else {
+        sfSpriteSheetReader_readNumber(reader);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Read an object of x, y, w and h members
+////////////////////////////////////////////////////////////
+static sfIntRect sfSpriteSheetReader_readRect(sfSpriteSheetReader *reader)
+{
+    sfIntRect rect = {0, 0, 0, 0};
+    char key[8];
+
+    if (!sfSpriteSheetReader_expect(reader, '{'))
+        return (rect);
+    while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key))) {
+        if (strcmp(key, "x") == 0)
+            rect.left = (int)sfSpriteSheetReader_readNumber(reader);
+        else if (strcmp(key, "y") == 0)
+            rect.top = (int)sfSpriteSheetReader_readNumber(reader);
+        else if (strcmp(key, "w") == 0)
+            rect.width = (int)sfSpriteSheetReader_readNumber(reader);
+        else if (strcmp(key, "h") == 0)
+            rect.height = (int)sfSpriteSheetReader_readNumber(reader);
+        else
+            sfSpriteSheetReader_skipValue(reader, 1);
+    }
+    return (rect);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheet_parseFrame(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    sfSpriteSheetFrame frame = {{0, 0, 0, 0}, {0, 0}, {0, 0}, 0, sfFalse};
+    sfIntRect rect;
+    sfBool sourceSize = sfFalse;
+    char key[32];
+
+    if (!sfSpriteSheetReader_expect(reader, '{'))
+        return;
+    while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key))) {
+        if (strcmp(key, "frame") == 0) {
+            frame.rect = sfSpriteSheetReader_readRect(reader);
+        } else if (strcmp(key, "rotated") == 0) {
+            frame.rotated = sfSpriteSheetReader_readBool(reader);
+        } else if (strcmp(key, "spriteSourceSize") == 0) {
+            rect = sfSpriteSheetReader_readRect(reader);
+            frame.offset = (sfVector2f){(float)rect.left, (float)rect.top};
+        } else if (strcmp(key, "sourceSize") == 0) {
+            rect = sfSpriteSheetReader_readRect(reader);
+            frame.sourceSize = (sfVector2u){(unsigned int)rect.width, (unsigned int)rect.height};
+            sourceSize = sfTrue;
+        } else if (strcmp(key, "duration") == 0) {
+            // Durations are exported in milliseconds
+            frame.duration = (sfInt64)(sfSpriteSheetReader_readNumber(reader) * 1000);
+        } else {
+            sfSpriteSheetReader_skipValue(reader, 1);
+        }
+    }
+    if (!sourceSize)
+        frame.sourceSize = (sfVector2u){(unsigned int)frame.rect.width, (unsigned int)frame.rect.height};
+    if (table->frames != NULL && table->frameCount < table->frameCapacity)
+        table->frames[table->frameCount] = frame;
+    table->frameCount++;
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheet_parseFrames(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    char key[1];
+    int c = sfSpriteSheetReader_skipSpace(reader);
+
+    reader->position++;
+    if (c == '{') {
+        while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key)))
+            sfSpriteSheet_parseFrame(reader, table);
+    } else if (c == '[') {
+        while (sfSpriteSheetReader_nextElement(reader))
+            sfSpriteSheet_parseFrame(reader, table);
+    } else {
+        reader->failed = sfTrue;
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Read a string into the names of the table, or count its
+/// size while counting
+////////////////////////////////////////////////////////////
+static const char *sfSpriteSheet_parseName(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    char *name = NULL;
+    size_t capacity = 0;
+
+    if (table->strings != NULL && table->stringSize < table->stringCapacity) {
+        name = table->strings + table->stringSize;
+        capacity = table->stringCapacity - table->stringSize;
+    }
+    table->stringSize += sfSpriteSheetReader_readString(reader, name, capacity) + 1;
+    return (name);
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheet_parseTags(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    sfSpriteSheetTag tag;
+    char key[8];
+
+    if (!sfSpriteSheetReader_expect(reader, '['))
+        return;
+    while (sfSpriteSheetReader_nextElement(reader)) {
+        tag = (sfSpriteSheetTag){NULL, 0, 0};
+        if (!sfSpriteSheetReader_expect(reader, '{'))
+            return;
+        while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key))) {
+            if (strcmp(key, "name") == 0)
+                tag.name = sfSpriteSheet_parseName(reader, table);
+            else if (strcmp(key, "from") == 0)
+                tag.from = sfSpriteSheetReader_readIndex(reader);
+            else if (strcmp(key, "to") == 0)
+                tag.to = sfSpriteSheetReader_readIndex(reader);
+            else
+                sfSpriteSheetReader_skipValue(reader, 1);
+        }
+        if (table->tags != NULL && table->tagCount < table->tagCapacity)
+            table->tags[table->tagCount] = tag;
+        table->tagCount++;
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfSpriteSheet_parseMeta(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    char key[16];
+
+    if (!sfSpriteSheetReader_expect(reader, '{'))
+        return;
+    while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key))) {
+        if (strcmp(key, "image") == 0)
+            table->image = sfSpriteSheet_parseName(reader, table);
+        else if (strcmp(key, "frameTags") == 0)
+            sfSpriteSheet_parseTags(reader, table);
+        else
+            sfSpriteSheetReader_skipValue(reader, 1);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static sfBool sfSpriteSheet_parse(sfSpriteSheetReader *reader, sfSpriteSheetTable *table)
+{
+    char key[16];
+
+    table->frameCount = 0;
+    table->tagCount = 0;
+    table->stringSize = 0;
+    if (!sfSpriteSheetReader_expect(reader, '{'))
+        return (sfFalse);
+    while (sfSpriteSheetReader_nextMember(reader, key, sizeof(key))) {
+        if (strcmp(key, "frames") == 0)
+            sfSpriteSheet_parseFrames(reader, table);
+        else if (strcmp(key, "meta") == 0)
+            sfSpriteSheet_parseMeta(reader, table);
+        else
+            sfSpriteSheetReader_skipValue(reader, 1);
+    }
+    return (!reader->failed);
+}
+
+////////////////////////////////////////////////////////////
+/// Count the table, allocate it in one block and fill it,
+/// rewinding the reader between both passes
+////////////////////////////////////////////////////////////
+static sfSpriteSheet *sfSpriteSheet_load(sfSpriteSheetReader *reader)
+{
+    sfSpriteSheetTable table = {NULL, 0, NULL, 0, NULL, 0, NULL, 0, 0, 0};
+    sfSpriteSheet *spriteSheet = NULL;
+    size_t framesOffset = (sizeof(sfSpriteSheet) + 7) & ~(size_t)7;
+    size_t tagsOffset = 0;
+    size_t stringsOffset = 0;
+    const char *data = reader->data;
+    size_t size = reader->size;
+
+    if (!sfSpriteSheet_parse(reader, &table))
+        return (NULL);
+    tagsOffset = framesOffset + table.frameCount * sizeof(sfSpriteSheetFrame);
+    stringsOffset = tagsOffset + table.tagCount * sizeof(sfSpriteSheetTag);
+    spriteSheet = sfAllocator_malloc(stringsOffset + table.stringSize);
+    if (spriteSheet == NULL)
+        return (NULL);
+    table.frames = (sfSpriteSheetFrame *)((char *)spriteSheet + framesOffset);
+    table.tags = (sfSpriteSheetTag *)((char *)spriteSheet + tagsOffset);
+    table.strings = (char *)spriteSheet + stringsOffset;
+    table.frameCapacity = table.frameCount;
+    table.tagCapacity = table.tagCount;
+    table.stringCapacity = table.stringSize;
+    if (reader->file != NULL) {
+        rewind(reader->file);
+        reader->size = 0;
+    } else {
+        reader->data = data;
+        reader->size = size;
+    }
+    reader->position = 0;
+    // A file changed between both passes does not match what was counted
+    if (!sfSpriteSheet_parse(reader, &table) || table.frameCount != table.frameCapacity ||
+        table.tagCount != table.tagCapacity || table.stringSize != table.stringCapacity) {
+        sfAllocator_free(spriteSheet);
+        return (NULL);
+    }
+    for (size_t i = 0; i < table.tagCount; i++) {
+        if (table.tags[i].from > table.tags[i].to || table.tags[i].to >= table.frameCount) {
+            sfAllocator_free(spriteSheet);
+            return (NULL);
+        }
+    }
+    *spriteSheet = (sfSpriteSheet){table.frames, table.frameCount, table.tags, table.tagCount, table.image};
+    return (spriteSheet);
+}
+
+////////////////////////////////////////////////////////////
+sfSpriteSheet *sfSpriteSheet_createFromFile(const char *filename)
+{
+    sfSpriteSheetReader reader;
+    sfSpriteSheet *spriteSheet = NULL;
+
+    if (filename == NULL)
+        return (NULL);
+    reader.file = fopen(filename, "rb");
+    if (reader.file == NULL)
+        return (NULL);
+    reader.data = reader.buffer;
+    reader.size = 0;
+    reader.position = 0;
+    reader.failed = sfFalse;
+    spriteSheet = sfSpriteSheet_load(&reader);
+    fclose(reader.file);
+    return (spriteSheet);
+}
+
+////////////////////////////////////////////////////////////
+sfSpriteSheet *sfSpriteSheet_createFromMemory(const void *data, size_t size)
+{
+    sfSpriteSheetReader reader;
+
+    if (data == NULL)
+        return (NULL);
+    reader.file = NULL;
+    reader.data = data;
+    reader.size = size;
+    reader.position = 0;
+    reader.failed = sfFalse;
+    return (sfSpriteSheet_load(&reader));
+}
+
+////////////////////////////////////////////////////////////
+void sfSpriteSheet_destroy(sfSpriteSheet *spriteSheet)
+{
+    sfAllocator_free(spriteSheet);
+}
+
+////////////////////////////////////////////////////////////
+const sfSpriteSheetTag *sfSpriteSheet_getTag(const sfSpriteSheet *spriteSheet, const char *name)
+{
+    if (spriteSheet == NULL || name == NULL)
+        return (NULL);
+    for (size_t i = 0; i < spriteSheet->tagCount; i++) {
+        if (spriteSheet->tags[i].name != NULL && strcmp(spriteSheet->tags[i].name, name) == 0)
+            return (&spriteSheet->tags[i]);
+    }
+    return (NULL);
+}
@@ -0,0 +1,318 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <SFML/Addition/Allocator.h>
+#include "ProfilerInternal.h"
+#include "WorkerGroup.h"
+#include <SFML/Addition/Tessellator.h>
+
+////////////////////////////////////////////////////////////
+/// Range of curves [begin, end[ packed in 64 bits
+////////////////////////////////////////////////////////////
+#define SF_RANGE(begin, end) (((uint_least64_t)(begin) << 32) | (uint_least64_t)(end))
+#define SF_RANGE_BEGIN(range) ((size_t)((range) >> 32))
+#define SF_RANGE_END(range) ((size_t)((range) & 0xFFFFFFFF))
+
+////////////////////////////////////////////////////////////
+/// State of a thread, the last one is the calling thread
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfTessellator *tessellator;
+    unsigned int index;
+    atomic_uint_least64_t range;
+} sfTessellatorWorker;
+
+////////////////////////////////////////////////////////////
+/// Take the next curve of the own range of a thread
+////////////////////////////////////////////////////////////
+static sfBool sfTessellator_pop(sfTessellatorWorker *worker, size_t *curve)
+{
+    uint_least64_t range = atomic_load(&worker->range);
+
+    do {
+        if (SF_RANGE_BEGIN(range) >= SF_RANGE_END(range))
+            return (sfFalse);
+    } while (!atomic_compare_exchange_weak(&worker->range, &range, SF_RANGE(SF_RANGE_BEGIN(range) + 1, SF_RANGE_END(range))));
+    *curve = SF_RANGE_BEGIN(range);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Move the second half of the range of another thread to a thread
+////////////////////////////////////////////////////////////
+static sfBool sfTessellator_steal(sfTessellatorWorker *thief)
+{
+    sfTessellatorWorker *workers = thief->tessellator->workers;
+    unsigned int count = thief->tessellator->threadCount;
+    sfTessellatorWorker *victim = NULL;
+    uint_least64_t range = 0;
+    size_t middle = 0;
+
+    for (unsigned int i = 1; i < count; i++) {
+        victim = &workers[(thief->index + i) % count];
+        range = atomic_load(&victim->range);
+        while (SF_RANGE_BEGIN(range) < SF_RANGE_END(range)) {
+            middle = SF_RANGE_BEGIN(range) + (SF_RANGE_END(range) - SF_RANGE_BEGIN(range)) / 2;
+            if (atomic_compare_exchange_weak(&victim->range, &range, SF_RANGE(SF_RANGE_BEGIN(range), middle))) {
+                atomic_store(&thief->range, SF_RANGE(middle, SF_RANGE_END(range)));
+                return (sfTrue);
+            }
+        }
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+/// Write the vertices of a curve in its range of the buffer
+////////////////////////////////////////////////////////////
+static void sfTessellator_tessellateCurve(sfTessellator *tessellator, size_t curve)
+{
+    const sfBezierCurve *bezierCurve = tessellator->curves[curve];
+    sfVertex *vertices = tessellator->vertices + tessellator->offsets[curve];
+    size_t count = tessellator->offsets[curve + 1] - tessellator->offsets[curve];
+
+    for (size_t i = 0; i < count; i++) {
+        vertices[i].position = sfBezierCurve_calculatePoint(bezierCurve, (float)i / count);
+        vertices[i].color = bezierCurve->color;
+        vertices[i].texCoords = (sfVector2f){0, 0};
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Tessellate curves until no thread has any left
+////////////////////////////////////////////////////////////
+static void sfTessellator_work(void *userData)
+{
+    sfTessellatorWorker *worker = userData;
+    size_t curve = 0;
+
+    while (sfTessellator_pop(worker, &curve) || (sfTessellator_steal(worker) && sfTessellator_pop(worker, &curve)))
+        sfTessellator_tessellateCurve(worker->tessellator, curve);
+}
+
+////////////////////////////////////////////////////////////
+/// Entry point of the parked worker threads
+////////////////////////////////////////////////////////////
+static void sfTessellator_workerMain(void *userData, unsigned int index)
+{
+    sfTessellator *tessellator = userData;
+
+    sfTessellator_work(&((sfTessellatorWorker *)tessellator->workers)[index]);
+}
+
+////////////////////////////////////////////////////////////
+/// Compute the ranges of the curves in the buffer and share the curves between the first threads
+////////////////////////////////////////////////////////////
+static sfBool sfTessellator_prepare(sfTessellator *tessellator, size_t sampleCount, unsigned int threadCount)
+{
+    sfTessellatorWorker *workers = tessellator->workers;
+    const sfBezierCurve *curve = NULL;
+    sfVertex *vertices = NULL;
+    size_t count = 0;
+    float length = 0;
+
+    for (size_t i = 0; i < tessellator->curveCount; i++) {
+        curve = tessellator->curves[i];
+        count = curve->pointCount < 2 ? 0 : sampleCount;
+        if (curve->pointCount >= 2 && sampleCount == SF_TESSELLATOR_ADAPTIVE) {
+            length = 0;
+            for (size_t j = 0; j + 1 < curve->pointCount; j++)
+                length += hypotf(curve->points[j + 1].x - curve->points[j].x, curve->points[j + 1].y - curve->points[j].y);
+            count = (size_t)ceilf(length) + 1;
+            count = count > SF_BEZIERCURVE_SAMPLE_COUNT ? SF_BEZIERCURVE_SAMPLE_COUNT : count;
+        }
+        tessellator->offsets[i + 1] = tessellator->offsets[i] + count;
+    }
+    tessellator->vertexCount = tessellator->offsets[tessellator->curveCount];
+    if (tessellator->vertexCount > tessellator->vertexCapacity) {
+        vertices = sfAllocator_realloc(tessellator->vertices, tessellator->vertexCount * sizeof(sfVertex));
+        if (vertices == NULL) {
+            tessellator->vertexCount = 0;
+            return (sfFalse);
+        }
+        tessellator->vertices = vertices;
+        tessellator->vertexCapacity = tessellator->vertexCount;
+    }
+    for (unsigned int i = 0; i < tessellator->threadCount; i++) {
+        count = i < threadCount ? tessellator->curveCount * i / threadCount : 0;
+        atomic_store(&workers[i].range, SF_RANGE(count, i < threadCount ? tessellator->curveCount * (i + 1) / threadCount : 0));
+    }
+    SF_PROFILE_COUNT(curveSamples, tessellator->vertexCount);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+sfTessellator *sfTessellator_create(unsigned int threadCount)
+{
+    sfTessellator *tessellator = sfAllocator_calloc(1, sizeof(sfTessellator));
+    sfTessellatorWorker *workers = NULL;
+
+    if (tessellator == NULL)
+        return (NULL);
+    threadCount = threadCount < 1 ? 1 : threadCount;
+    tessellator->threadCount = threadCount;
+    tessellator->workers = sfAllocator_calloc(threadCount, sizeof(sfTessellatorWorker));
+    tessellator->offsets = sfAllocator_calloc(1, sizeof(size_t));
+    if (tessellator->workers == NULL || tessellator->offsets == NULL) {
+        sfTessellator_destroy(tessellator);
+        return (NULL);
+    }
+    workers = tessellator->workers;
+    for (unsigned int i = 0; i < threadCount; i++) {
+        workers[i].tessellator = tessellator;
+        workers[i].index = i;
+        atomic_init(&workers[i].range, 0);
+    }
+    if (threadCount > 1) {
+        tessellator->group = sfWorkerGroup_create(threadCount - 1, sfTessellator_workerMain, tessellator);
+        if (tessellator->group == NULL) {
+            sfTessellator_destroy(tessellator);
+            return (NULL);
+        }
+    }
+    return (tessellator);
+}
+
+////////////////////////////////////////////////////////////
+void sfTessellator_destroy(sfTessellator *tessellator)
+{
+    if (tessellator == NULL)
+        return;
+    sfTessellator_wait(tessellator);
+    sfWorkerGroup_destroy(tessellator->group);
+    sfAllocator_free(tessellator->workers);
+    sfAllocator_free(tessellator->curves);
+    sfAllocator_free(tessellator->offsets);
+    sfAllocator_free(tessellator->vertices);
+    sfAllocator_free(tessellator);
+}
+
+////////////////////////////////////////////////////////////
+void sfTessellator_clear(sfTessellator *tessellator)
+{
+    if (tessellator == NULL)
+        return;
+    sfTessellator_wait(tessellator);
+    tessellator->curveCount = 0;
+    tessellator->vertexCount = 0;
+}
+
+////////////////////////////////////////////////////////////
+size_t sfTessellator_addCurve(sfTessellator *tessellator, const sfBezierCurve *bezierCurve)
+{
+    const sfBezierCurve **curves = NULL;
+    size_t *offsets = NULL;
+    size_t capacity = 0;
+
+    if (tessellator == NULL || bezierCurve == NULL || tessellator->running || tessellator->curveCount >= 0xFFFFFFFF)
+        return (SF_TESSELLATOR_NO_CURVE);
+    if (tessellator->curveCount == tessellator->curveCapacity) {
+        capacity = tessellator->curveCapacity ? tessellator->curveCapacity * 2 : 64;
+        curves = sfAllocator_realloc(tessellator->curves, capacity * sizeof(const sfBezierCurve *));
+        if (curves == NULL)
+            return (SF_TESSELLATOR_NO_CURVE);
+        tessellator->curves = curves;
+        offsets = sfAllocator_realloc(tessellator->offsets, (capacity + 1) * sizeof(size_t));
+        if (offsets == NULL)
+            return (SF_TESSELLATOR_NO_CURVE);
+        tessellator->offsets = offsets;
+        tessellator->curveCapacity = capacity;
+    }
+    tessellator->curves[tessellator->curveCount] = bezierCurve;
+    tessellator->offsets[tessellator->curveCount + 1] = tessellator->offsets[tessellator->curveCount];
+    return (tessellator->curveCount++);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfTessellator_launch(sfTessellator *tessellator, size_t sampleCount)
+{
+    if (tessellator == NULL || tessellator->running)
+        return (sfFalse);
+    if (tessellator->threadCount < 2)
+        return (sfTessellator_run(tessellator, sampleCount));
+    if (!sfTessellator_prepare(tessellator, sampleCount, tessellator->threadCount - 1))
+        return (sfFalse);
+    tessellator->running = sfTrue;
+    sfWorkerGroup_launch(tessellator->group);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void sfTessellator_wait(sfTessellator *tessellator)
+{
+    if (tessellator == NULL || !tessellator->running)
+        return;
+    if (tessellator->group != NULL)
+        sfWorkerGroup_wait(tessellator->group);
+    tessellator->running = sfFalse;
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfTessellator_run(sfTessellator *tessellator, size_t sampleCount)
+{
+    sfTessellatorWorker *workers = NULL;
+
+    if (tessellator == NULL || tessellator->running)
+        return (sfFalse);
+    if (!sfTessellator_prepare(tessellator, sampleCount, tessellator->threadCount))
+        return (sfFalse);
+    workers = tessellator->workers;
+    tessellator->running = sfTrue;
+    if (tessellator->group != NULL)
+        sfWorkerGroup_launch(tessellator->group);
+    sfTessellator_work(&workers[tessellator->threadCount - 1]);
+    sfTessellator_wait(tessellator);
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+const sfVertex *sfTessellator_getCurveVertices(const sfTessellator *tessellator, size_t curve, size_t *count)
+{
+    if (count != NULL)
+        *count = 0;
+    if (tessellator == NULL || tessellator->running || curve >= tessellator->curveCount)
+        return (NULL);
+    if (count != NULL)
+        *count = tessellator->offsets[curve + 1] - tessellator->offsets[curve];
+    return (tessellator->vertices + tessellator->offsets[curve]);
+}
+
+////////////////////////////////////////////////////////////
+void sfRenderWindow_drawTessellator(sfRenderWindow *renderWindow, sfTessellator *tessellator, const sfRenderStates *states)
+{
+    if (tessellator == NULL)
+        return;
+    sfTessellator_wait(tessellator);
+    if (tessellator->vertexCount == 0)
+        return;
+    SF_PROFILE_COUNT(curveDraws, 1);
+    sfRenderWindow_drawPrimitives(renderWindow, tessellator->vertices, tessellator->vertexCount, sfPoints, states);
+}
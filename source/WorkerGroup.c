@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #define _POSIX_C_SOURCE 200809L
+    #include <pthread.h>
+#endif
+#include <SFML/System.h>
+#include <SFML/Addition/Allocator.h>
+#include "WorkerGroup.h"
+
+////////////////////////////////////////////////////////////
+/// Lock and condition variables of the platform, sfMutex has
+/// no condition variable to park the workers on
+////////////////////////////////////////////////////////////
+#ifdef _WIN32
+    typedef SRWLOCK sfWorkerLock;
+    typedef CONDITION_VARIABLE sfWorkerCondition;
+    #define SF_WORKER_LOCK_INIT(lock) (InitializeSRWLock(lock), sfTrue)
+    #define SF_WORKER_LOCK_DESTROY(lock) ((void)(lock))
+    #define SF_WORKER_LOCK(lock) AcquireSRWLockExclusive(lock)
+    #define SF_WORKER_UNLOCK(lock) ReleaseSRWLockExclusive(lock)
+    #define SF_WORKER_CONDITION_INIT(condition) (InitializeConditionVariable(condition), sfTrue)
+    #define SF_WORKER_CONDITION_DESTROY(condition) ((void)(condition))
+    #define SF_WORKER_CONDITION_WAIT(condition, lock) SleepConditionVariableSRW(condition, lock, INFINITE, 0)
+    #define SF_WORKER_CONDITION_SIGNAL(condition) WakeConditionVariable(condition)
+    #define SF_WORKER_CONDITION_BROADCAST(condition) WakeAllConditionVariable(condition)
+#else
+    typedef pthread_mutex_t sfWorkerLock;
+    typedef pthread_cond_t sfWorkerCondition;
+    #define SF_WORKER_LOCK_INIT(lock) (pthread_mutex_init(lock, NULL) == 0)
+    #define SF_WORKER_LOCK_DESTROY(lock) pthread_mutex_destroy(lock)
+    #define SF_WORKER_LOCK(lock) pthread_mutex_lock(lock)
+    #define SF_WORKER_UNLOCK(lock) pthread_mutex_unlock(lock)
+    #define SF_WORKER_CONDITION_INIT(condition) (pthread_cond_init(condition, NULL) == 0)
+    #define SF_WORKER_CONDITION_DESTROY(condition) pthread_cond_destroy(condition)
+    #define SF_WORKER_CONDITION_WAIT(condition, lock) pthread_cond_wait(condition, lock)
+    #define SF_WORKER_CONDITION_SIGNAL(condition) pthread_cond_signal(condition)
+    #define SF_WORKER_CONDITION_BROADCAST(condition) pthread_cond_broadcast(condition)
+#endif
+
+////////////////////////////////////////////////////////////
+/// State of a worker thread
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfWorkerGroup *group;
+    unsigned int index;
+    sfThread *thread;
+} sfWorker;
+
+////////////////////////////////////////////////////////////
+/// Worker threads and the job they wait for
+////////////////////////////////////////////////////////////
+struct sfWorkerGroup
+{
+    sfWorker *workers;
+    unsigned int count;
+    sfWorkerGroupFunction function;
+    void *userData;
+    sfWorkerLock lock;
+    sfWorkerCondition wake;
+    sfWorkerCondition done;
+    unsigned int job;
+    unsigned int pending;
+    sfBool quit;
+};
+
+////////////////////////////////////////////////////////////
+/// Run the jobs of a worker until the group is destroyed
+////////////////////////////////////////////////////////////
+static void sfWorkerGroup_main(void *userData)
+{
+    sfWorker *worker = userData;
+    sfWorkerGroup *group = worker->group;
+    unsigned int job = 0;
+
+    SF_WORKER_LOCK(&group->lock);
+    for (;;) {
+        while (group->job == job && !group->quit)
+            SF_WORKER_CONDITION_WAIT(&group->wake, &group->lock);
+        if (group->quit)
+            break;
+        job = group->job;
+        SF_WORKER_UNLOCK(&group->lock);
+        group->function(group->userData, worker->index);
+        SF_WORKER_LOCK(&group->lock);
+        if (--group->pending == 0)
+            SF_WORKER_CONDITION_SIGNAL(&group->done);
+    }
+    SF_WORKER_UNLOCK(&group->lock);
+}
+
+////////////////////////////////////////////////////////////
+sfWorkerGroup *sfWorkerGroup_create(unsigned int count, sfWorkerGroupFunction function, void *userData)
+{
+    sfWorkerGroup *group = sfAllocator_calloc(1, sizeof(sfWorkerGroup));
+
+    if (group == NULL)
+        return (NULL);
+    group->workers = sfAllocator_calloc(count, sizeof(sfWorker));
+    group->count = count;
+    group->function = function;
+    group->userData = userData;
+    if (group->workers == NULL || !SF_WORKER_LOCK_INIT(&group->lock)) {
+        sfAllocator_free(group->workers);
+        sfAllocator_free(group);
+        return (NULL);
+    }
+    if (!SF_WORKER_CONDITION_INIT(&group->wake)) {
+        SF_WORKER_LOCK_DESTROY(&group->lock);
+        sfAllocator_free(group->workers);
+        sfAllocator_free(group);
+        return (NULL);
+    }
+    if (!SF_WORKER_CONDITION_INIT(&group->done)) {
+        SF_WORKER_CONDITION_DESTROY(&group->wake);
+        SF_WORKER_LOCK_DESTROY(&group->lock);
+        sfAllocator_free(group->workers);
+        sfAllocator_free(group);
+        return (NULL);
+    }
+    for (unsigned int i = 0; i < count; i++) {
+        group->workers[i].group = group;
+        group->workers[i].index = i;
+        group->workers[i].thread = sfThread_create(sfWorkerGroup_main, &group->workers[i]);
+        if (group->workers[i].thread == NULL) {
+            sfWorkerGroup_destroy(group);
+            return (NULL);
+        }
+        sfThread_launch(group->workers[i].thread);
+    }
+    return (group);
+}
+
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_destroy(sfWorkerGroup *group)
+{
+    if (group == NULL)
+        return;
+    SF_WORKER_LOCK(&group->lock);
+    group->quit = sfTrue;
+    SF_WORKER_CONDITION_BROADCAST(&group->wake);
+    SF_WORKER_UNLOCK(&group->lock);
+    for (unsigned int i = 0; i < group->count; i++) {
+        if (group->workers[i].thread != NULL)
+            sfThread_destroy(group->workers[i].thread);
+    }
+    SF_WORKER_CONDITION_DESTROY(&group->done);
+    SF_WORKER_CONDITION_DESTROY(&group->wake);
+    SF_WORKER_LOCK_DESTROY(&group->lock);
+    sfAllocator_free(group->workers);
+    sfAllocator_free(group);
+}
+
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_launch(sfWorkerGroup *group)
+{
+    SF_WORKER_LOCK(&group->lock);
+    group->pending = group->count;
+    group->job++;
+    SF_WORKER_CONDITION_BROADCAST(&group->wake);
+    SF_WORKER_UNLOCK(&group->lock);
+}
+
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_wait(sfWorkerGroup *group)
+{
+    SF_WORKER_LOCK(&group->lock);
+    while (group->pending > 0)
+        SF_WORKER_CONDITION_WAIT(&group->done, &group->lock);
+    SF_WORKER_UNLOCK(&group->lock);
+}
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_WORKERGROUP_H
+    #define SFML_WORKERGROUP_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Worker threads started once and parked between jobs
+///
+/// This header is private to the library sources. The threads
+/// are started once and sleep on a condition variable until
+/// the next job, instead of being launched again for each job.
+///
+////////////////////////////////////////////////////////////
+typedef struct sfWorkerGroup sfWorkerGroup;
+
+////////////////////////////////////////////////////////////
+/// \brief Function run by every worker for each job
+///
+/// \param userData     Pointer given to sfWorkerGroup_create
+/// \param index        Index of the worker, in [0, count[
+///
+////////////////////////////////////////////////////////////
+typedef void (*sfWorkerGroupFunction)(void *userData, unsigned int index);
+
+////////////////////////////////////////////////////////////
+/// \brief Start a group of parked worker threads
+///
+/// \param count        Number of worker threads
+/// \param function     Function run by the workers for each job
+/// \param userData     Pointer given to the function
+///
+/// \return A new sfWorkerGroup object, or NULL if it failed
+///
+////////////////////////////////////////////////////////////
+sfWorkerGroup *sfWorkerGroup_create(unsigned int count, sfWorkerGroupFunction function, void *userData);
+
+////////////////////////////////////////////////////////////
+/// \brief Stop the workers and destroy the group
+///
+/// \param group    Worker group to destroy, must not be running a job
+///
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_destroy(sfWorkerGroup *group);
+
+////////////////////////////////////////////////////////////
+/// \brief Wake the workers to run the function once
+///
+/// \param group    Worker group object
+///
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_launch(sfWorkerGroup *group);
+
+////////////////////////////////////////////////////////////
+/// \brief Wait until every worker is done with the job started by sfWorkerGroup_launch
+///
+/// \param group    Worker group object
+///
+////////////////////////////////////////////////////////////
+void sfWorkerGroup_wait(sfWorkerGroup *group);
+
+#endif // SFML_WORKERGROUP_H
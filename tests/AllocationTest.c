@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string.h>
+#include <SFML/Addition/Allocator.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+#define SF_ALLOCATIONTEST_WARMUP_FRAMES 4
+#define SF_ALLOCATIONTEST_FRAMES 60
+
+////////////////////////////////////////////////////////////
+/// Number of blocks handed out by the counting allocator
+////////////////////////////////////////////////////////////
+static size_t sfAllocationTest_count = 0;
+
+////////////////////////////////////////////////////////////
+static void *sfAllocationTest_allocate(size_t size, void *userData)
+{
+    (void)userData;
+    sfAllocationTest_count++;
+    return (malloc(size));
+}
+
+////////////////////////////////////////////////////////////
+static void *sfAllocationTest_reallocate(void *pointer, size_t size, void *userData)
+{
+    (void)userData;
+    sfAllocationTest_count++;
+    return (realloc(pointer, size));
+}
+
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_deallocate(void *pointer, void *userData)
+{
+    (void)userData;
+    free(pointer);
+}
+
+////////////////////////////////////////////////////////////
+/// Two frames of a packed sheet, the second one trimmed and
+/// rotated
+////////////////////////////////////////////////////////////
+static const char sfAllocationTest_sheet[] = "{\"frames\": {"
+    "\"walk_0.png\": {\"frame\": {\"x\":0,\"y\":0,\"w\":28,\"h\":30}, \"rotated\": false, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":2,\"y\":1,\"w\":28,\"h\":30}, \"sourceSize\": {\"w\":32,\"h\":32}, \"duration\": 50},"
+    "\"walk_1.png\": {\"frame\": {\"x\":28,\"y\":0,\"w\":20,\"h\":10}, \"rotated\": true, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":6,\"y\":11,\"w\":20,\"h\":10}, \"sourceSize\": {\"w\":32,\"h\":32}, \"duration\": 30}},"
+    "\"meta\": {\"image\": \"sheet.png\", \"size\": {\"w\":64,\"h\":64},"
+    " \"frameTags\": [{\"name\":\"walk\",\"from\":0,\"to\":1,\"direction\":\"forward\"}]}}";
+
+////////////////////////////////////////////////////////////
+/// Objects drawn every frame
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfRenderWindow *window;
+    sfTexture *texture;
+    sfSpriteSheet *sheet;
+    sfBezierCurve *curves[4];
+    sfAnimatedSprite *sprites[2];
+} sfAllocationTestScene;
+
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_createScene(sfAllocationTestScene *scene)
+{
+    static const size_t pointCounts[4] = {4, 16, 17, 24};
+
+    scene->window = sfRenderWindow_create((sfVideoMode){320, 240, 32}, "test", 0, NULL);
+    scene->texture = sfTexture_create(256, 256);
+    scene->sheet = sfSpriteSheet_createFromMemory(sfAllocationTest_sheet, strlen(sfAllocationTest_sheet));
+    for (size_t i = 0; i < 4; i++) {
+        scene->curves[i] = sfBezierCurve_create();
+        for (size_t j = 0; j < pointCounts[i]; j++)
+            sfBezierCurve_addPoint(scene->curves[i], (sfVector2f){j * 8.f, (j % 2) * 200.f});
+    }
+    scene->sprites[0] = sfAnimatedSprite_create();
+    sfAnimatedSprite_setTexture(scene->sprites[0], scene->texture, sfTrue);
+    sfAnimatedSprite_setGridSize(scene->sprites[0], (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(scene->sprites[0], (sfVector2u){64, 64});
+    sfAnimatedSprite_setMaxFrame(scene->sprites[0], 16);
+    sfAnimatedSprite_setFrameRate(scene->sprites[0], 24);
+    scene->sprites[1] = sfAnimatedSprite_create();
+    sfAnimatedSprite_setTexture(scene->sprites[1], scene->texture, sfTrue);
+    sfAnimatedSprite_setSpriteSheet(scene->sprites[1], scene->sheet, "walk");
+    for (size_t i = 0; i < 2; i++) {
+        sfAnimatedSprite_setFixedStep(scene->sprites[i], sfMilliseconds(16));
+        sfAnimatedSprite_setRotation(scene->sprites[i], 30.f);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_destroyScene(sfAllocationTestScene *scene)
+{
+    for (size_t i = 0; i < 4; i++)
+        sfBezierCurve_destroy(scene->curves[i]);
+    for (size_t i = 0; i < 2; i++)
+        sfAnimatedSprite_destroy(scene->sprites[i]);
+    sfSpriteSheet_destroy(scene->sheet);
+    sfTexture_destroy(scene->texture);
+    sfRenderWindow_destroy(scene->window);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_drawFrame(sfAllocationTestScene *scene, sfArena *frameArena)
+{
+    for (size_t i = 0; i < 4; i++)
+        sfRenderWindow_drawBezierCurve(scene->window, scene->curves[i], NULL);
+    for (size_t i = 0; i < 2; i++)
+        sfRenderWindow_drawAnimatedSprite(scene->window, scene->sprites[i], NULL);
+    if (frameArena != NULL)
+        sfArena_reset(frameArena);
+}
+
+////////////////////////////////////////////////////////////
+/// With a frame arena, drawing curves of any degree and
+/// animated sprites allocates nothing once warmed up
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_steadyStateDraws(void)
+{
+    sfAllocationTestScene scene;
+    sfArena *frameArena = sfArena_create(1024 * 1024);
+    size_t allocations = 0;
+
+    sfAllocationTest_createScene(&scene);
+    SF_TEST_CHECK(scene.sheet != NULL);
+    sfAllocator_setFrameArena(frameArena);
+    for (size_t i = 0; i < SF_ALLOCATIONTEST_WARMUP_FRAMES; i++)
+        sfAllocationTest_drawFrame(&scene, frameArena);
+    allocations = sfAllocationTest_count;
+    for (size_t i = 0; i < SF_ALLOCATIONTEST_FRAMES; i++)
+        sfAllocationTest_drawFrame(&scene, frameArena);
+    SF_TEST_CHECK(sfAllocationTest_count == allocations);
+    sfAllocator_setFrameArena(NULL);
+    sfArena_destroy(frameArena);
+    sfAllocationTest_destroyScene(&scene);
+}
+
+////////////////////////////////////////////////////////////
+/// Without a frame arena, curves of more than 16 points take
+/// their scratch memory from the allocator, so the counter
+/// does see the allocations of the library
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_scratchFallback(void)
+{
+    sfAllocationTestScene scene;
+    size_t allocations = 0;
+
+    sfAllocationTest_createScene(&scene);
+    allocations = sfAllocationTest_count;
+    sfAllocationTest_drawFrame(&scene, NULL);
+    SF_TEST_CHECK(sfAllocationTest_count > allocations);
+    sfAllocationTest_destroyScene(&scene);
+}
+
+////////////////////////////////////////////////////////////
+/// A pool of zero blocks per chunk grows one block at a time
+////////////////////////////////////////////////////////////
+static void sfAllocationTest_emptyChunks(void)
+{
+    sfPool pool = SF_POOL_INIT(24, 0);
+    void *blocks[3] = {NULL, NULL, NULL};
+    size_t allocations = sfAllocationTest_count;
+
+    SF_TEST_CHECK(sfPool_reserve(&pool, 3));
+    SF_TEST_CHECK(sfAllocationTest_count == allocations + 3);
+    for (int i = 0; i < 3; i++)
+        blocks[i] = sfPool_allocate(&pool);
+    SF_TEST_CHECK(blocks[0] != NULL && blocks[1] != NULL && blocks[2] != NULL);
+    SF_TEST_CHECK(blocks[0] != blocks[1] && blocks[1] != blocks[2] && blocks[0] != blocks[2]);
+    SF_TEST_CHECK(sfAllocationTest_count == allocations + 3);
+    SF_TEST_CHECK(sfPool_allocate(&pool) != NULL);
+    SF_TEST_CHECK(sfAllocationTest_count == allocations + 4);
+    sfPool_free(&pool, blocks[1]);
+    SF_TEST_CHECK(sfPool_allocate(&pool) == blocks[1]);
+    sfPool_clear(&pool);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfAllocator allocator = {
+        sfAllocationTest_allocate,
+        sfAllocationTest_reallocate,
+        sfAllocationTest_deallocate,
+        NULL
+    };
+
+    sfAllocator_set(&allocator);
+    sfTest_run("allocation.steadyStateDraws", sfAllocationTest_steadyStateDraws);
+    sfTest_run("allocation.scratchFallback", sfAllocationTest_scratchFallback);
+    sfTest_run("allocation.emptyChunks", sfAllocationTest_emptyChunks);
+    sfAllocator_set(NULL);
+    return (sfTest_finish());
+}
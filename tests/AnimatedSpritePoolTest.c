@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/AnimatedSpritePool.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Handles of free slots, despawned or never spawned, are stale
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpritePoolTest_handles(void)
+{
+    sfAnimatedSpritePool *pool = sfAnimatedSpritePool_create(4, NULL, (sfVector2u){16, 16}, (sfVector2u){4, 1}, 10);
+    sfAnimatedSpriteHandle first = SF_ANIMATEDSPRITEHANDLE_INVALID;
+    sfAnimatedSpriteHandle second = SF_ANIMATEDSPRITEHANDLE_INVALID;
+
+    if (!SF_TEST_CHECK(pool != NULL))
+        return;
+    SF_TEST_CHECK(!sfAnimatedSpritePool_isAlive(pool, SF_ANIMATEDSPRITEHANDLE_INVALID));
+    for (sfUint64 slot = 0; slot < 4; slot++)
+        for (sfUint64 generation = 0; generation < 4; generation++)
+            SF_TEST_CHECK(!sfAnimatedSpritePool_isAlive(pool, (generation << 32) | slot));
+    first = sfAnimatedSpritePool_spawn(pool, (sfVector2f){0, 0});
+    SF_TEST_CHECK(sfAnimatedSpritePool_isAlive(pool, first));
+    SF_TEST_CHECK(sfAnimatedSpritePool_get(pool, first) != NULL);
+    SF_TEST_CHECK(sfAnimatedSpritePool_despawn(pool, first));
+    SF_TEST_CHECK(!sfAnimatedSpritePool_isAlive(pool, first));
+    SF_TEST_CHECK(!sfAnimatedSpritePool_despawn(pool, first));
+    SF_TEST_CHECK(!sfAnimatedSpritePool_isAlive(pool, first + ((sfUint64)1 << 32)));
+    second = sfAnimatedSpritePool_spawn(pool, (sfVector2f){0, 0});
+    SF_TEST_CHECK(second != first);
+    SF_TEST_CHECK(sfAnimatedSpritePool_isAlive(pool, second));
+    SF_TEST_CHECK(!sfAnimatedSpritePool_isAlive(pool, first));
+    SF_TEST_CHECK(sfAnimatedSpritePool_getCount(pool) == 1);
+    sfAnimatedSpritePool_destroy(pool);
+}
+
+////////////////////////////////////////////////////////////
+/// Frame rates not dividing a second do not drift
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpritePoolTest_frameRate(void)
+{
+    sfAnimatedSpritePool *pool = sfAnimatedSpritePool_create(1, NULL, (sfVector2u){16, 16}, (sfVector2u){1000, 1}, 7);
+    sfAnimatedSpriteInstance *instance = NULL;
+
+    if (!SF_TEST_CHECK(pool != NULL))
+        return;
+    instance = sfAnimatedSpritePool_get(pool, sfAnimatedSpritePool_spawn(pool, (sfVector2f){0, 0}));
+    if (!SF_TEST_CHECK(instance != NULL))
+        return;
+    // 7 frames per second over 60 seconds of 50 Hz updates
+    for (int i = 0; i < 3000; i++)
+        sfAnimatedSpritePool_advance(pool, sfMicroseconds(20000));
+    SF_TEST_CHECK(instance->currentFrame == 420);
+    // The next frame starts after 1/7 s, not 142857 microseconds
+    sfAnimatedSpritePool_advance(pool, sfMicroseconds(142857));
+    SF_TEST_CHECK(instance->currentFrame == 420);
+    sfAnimatedSpritePool_advance(pool, sfMicroseconds(1));
+    SF_TEST_CHECK(instance->currentFrame == 421);
+    sfAnimatedSpritePool_destroy(pool);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("animatedSpritePool.handles", sfAnimatedSpritePoolTest_handles);
+    sfTest_run("animatedSpritePool.frameRate", sfAnimatedSpritePoolTest_frameRate);
+    return (sfTest_finish());
+}
@@ -0,0 +1,414 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/HitTester.h>
+#include <SFML/Addition/LevelOfDetail.h>
+#include <SFML/Addition/MouseDispatcher.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// A trimmed frame and a trimmed, rotated one
+////////////////////////////////////////////////////////////
+static const char sfAnimatedSpriteTest_sheet[] = "{\"frames\": {"
+    "\"walk_0.png\": {\"frame\": {\"x\":0,\"y\":0,\"w\":12,\"h\":14}, \"rotated\": false, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":2,\"y\":1,\"w\":12,\"h\":14}, \"sourceSize\": {\"w\":16,\"h\":16}, \"duration\": 100},"
+    "\"walk_1.png\": {\"frame\": {\"x\":16,\"y\":32,\"w\":14,\"h\":6}, \"rotated\": true, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":1,\"y\":5,\"w\":14,\"h\":6}, \"sourceSize\": {\"w\":16,\"h\":16}, \"duration\": 100}},"
+    "\"meta\": {\"image\": \"sheet.png\", \"size\": {\"w\":64,\"h\":64},"
+    " \"frameTags\": [{\"name\":\"walk\",\"from\":0,\"to\":1,\"direction\":\"forward\"}]}}";
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_checkRect(sfFloatRect rect, float left, float top, float width, float height)
+{
+    SF_TEST_CHECK_NEAR(rect.left, left, 1e-3);
+    SF_TEST_CHECK_NEAR(rect.top, top, 1e-3);
+    SF_TEST_CHECK_NEAR(rect.width, width, 1e-3);
+    SF_TEST_CHECK_NEAR(rect.height, height, 1e-3);
+}
+
+////////////////////////////////////////////////////////////
+/// Grid frames keep the bounds of the underlying sprite
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_gridBounds(void)
+{
+    sfTexture *texture = sfTexture_create(64, 64);
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprite, (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprite, (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_setFrameRate(sprite, 10);
+    sfAnimatedSprite_seek(sprite, sfMilliseconds(350));
+    sfAnimatedSprite_setPosition(sprite, (sfVector2f){10, 20});
+    sfAnimatedSprite_setScale(sprite, (sfVector2f){2, 3});
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getLocalBounds(sprite), 0, 0, 16, 16);
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getGlobalBounds(sprite), 10, 20, 32, 48);
+    sfAnimatedSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+}
+
+////////////////////////////////////////////////////////////
+/// Sheet frames are bounded by their trimmed quad, rotated
+/// frames by their size once turned back
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_sheetBounds(void)
+{
+    sfTexture *texture = sfTexture_create(64, 64);
+    sfSpriteSheet *sheet = sfSpriteSheet_createFromMemory(sfAnimatedSpriteTest_sheet, strlen(sfAnimatedSpriteTest_sheet));
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(sheet != NULL))
+        return;
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    SF_TEST_CHECK(sfAnimatedSprite_setSpriteSheet(sprite, sheet, "walk"));
+    sfAnimatedSprite_setPosition(sprite, (sfVector2f){100, 50});
+    sfAnimatedSprite_setScale(sprite, (sfVector2f){2, 2});
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getLocalBounds(sprite), 2, 1, 12, 14);
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getGlobalBounds(sprite), 104, 52, 24, 28);
+    sfAnimatedSprite_seek(sprite, sfMilliseconds(150));
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getLocalBounds(sprite), 1, 5, 14, 6);
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getGlobalBounds(sprite), 102, 60, 28, 12);
+    sfAnimatedSprite_setRotation(sprite, 90);
+    sfAnimatedSpriteTest_checkRect(sfAnimatedSprite_getGlobalBounds(sprite), 78, 52, 12, 28);
+    sfAnimatedSprite_destroy(sprite);
+    sfSpriteSheet_destroy(sheet);
+    sfTexture_destroy(texture);
+}
+
+////////////////////////////////////////////////////////////
+/// Sheet texture: the trimmed frame is solid but its first
+/// texel, the rotated frame only has the texel of its top
+/// left corner once turned back
+////////////////////////////////////////////////////////////
+static sfTexture *sfAnimatedSpriteTest_createSheetTexture(void)
+{
+    sfImage *image = sfImage_createFromColor(64, 64, sfTransparent);
+    sfTexture *texture = NULL;
+
+    for (unsigned int y = 0; y < 14; y++)
+        for (unsigned int x = 0; x < 12; x++)
+            sfImage_setPixel(image, x, y, sfWhite);
+    sfImage_setPixel(image, 0, 0, sfTransparent);
+    sfImage_setPixel(image, 21, 32, sfWhite);
+    texture = sfTexture_createFromImage(image, NULL);
+    sfImage_destroy(image);
+    return (texture);
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_onEnter(const sfMouseTargetEvent *event, void *userData)
+{
+    if (event->type == sfMouseTargetEnter)
+        (*(int *)userData)++;
+}
+
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_move(sfMouseDispatcher *dispatcher, int x, int y)
+{
+    sfEvent event = {0};
+
+    event.mouseMove.type = sfEvtMouseMoved;
+    event.mouseMove.x = x;
+    event.mouseMove.y = y;
+    sfMouseDispatcher_handleEvent(dispatcher, &event);
+}
+
+////////////////////////////////////////////////////////////
+/// Trimmed and rotated frames are hit where they are drawn,
+/// by the hit mask, the hit tester and the mouse dispatcher
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_sheetHover(void)
+{
+    sfTexture *texture = sfAnimatedSpriteTest_createSheetTexture();
+    sfSpriteSheet *sheet = sfSpriteSheet_createFromMemory(sfAnimatedSpriteTest_sheet, strlen(sfAnimatedSpriteTest_sheet));
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfHitTester *hitTester = sfHitTester_create(4);
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    int enters = 0;
+
+    if (!SF_TEST_CHECK(sheet != NULL && texture != NULL))
+        return;
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    SF_TEST_CHECK(sfAnimatedSprite_setSpriteSheet(sprite, sheet, "walk"));
+    SF_TEST_CHECK(sfAnimatedSprite_createHitMask(sprite, 0));
+    sfAnimatedSprite_setPosition(sprite, (sfVector2f){100, 50});
+    // Trimmed frame: the quad starts at (2, 1), on its transparent first texel
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){100.5f, 50.5f}));
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){102.5f, 51.5f}));
+    SF_TEST_CHECK(sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){103.5f, 51.5f}));
+    SF_TEST_CHECK(sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){113.5f, 64.5f}));
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){114.5f, 64.5f}));
+    sfHitTester_addAnimatedSprite(hitTester, sprite);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){101.5f, 50.5f}) == (size_t)-1);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){102.5f, 51.5f}) == 0);
+    sfMouseDispatcher_addAnimatedSprite(dispatcher, sprite, sfAnimatedSpriteTest_onEnter, &enters);
+    sfAnimatedSpriteTest_move(dispatcher, 102, 51);
+    SF_TEST_CHECK(enters == 0);
+    sfAnimatedSpriteTest_move(dispatcher, 103, 51);
+    SF_TEST_CHECK(enters == 1);
+    sfAnimatedSpriteTest_move(dispatcher, 0, 0);
+    // Rotated frame: the quad is at (1, 5), its top left corner is texel (21, 32)
+    sfAnimatedSprite_seek(sprite, sfMilliseconds(150));
+    SF_TEST_CHECK(sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){101.5f, 55.5f}));
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){102.5f, 55.5f}));
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){101.5f, 60.5f}));
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelHit(sprite, (sfVector2f){100.5f, 50.5f}));
+    sfHitTester_setAnimatedSprite(hitTester, 0, sprite);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){114.5f, 55.5f}) == 0);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){101.5f, 54.5f}) == (size_t)-1);
+    sfAnimatedSpriteTest_move(dispatcher, 102, 56);
+    SF_TEST_CHECK(enters == 1);
+    sfAnimatedSpriteTest_move(dispatcher, 101, 56);
+    SF_TEST_CHECK(enters == 2);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfHitTester_destroy(hitTester);
+    sfAnimatedSprite_destroy(sprite);
+    sfSpriteSheet_destroy(sheet);
+    sfTexture_destroy(texture);
+}
+
+////////////////////////////////////////////////////////////
+/// Pixel collisions use the frames where they are drawn
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_sheetCollision(void)
+{
+    sfTexture *texture = sfAnimatedSpriteTest_createSheetTexture();
+    sfSpriteSheet *sheet = sfSpriteSheet_createFromMemory(sfAnimatedSpriteTest_sheet, strlen(sfAnimatedSpriteTest_sheet));
+    sfAnimatedSprite *trimmed = sfAnimatedSprite_create();
+    sfAnimatedSprite *rotated = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(sheet != NULL && texture != NULL))
+        return;
+    sfAnimatedSprite_setTexture(trimmed, texture, sfTrue);
+    sfAnimatedSprite_setTexture(rotated, texture, sfTrue);
+    SF_TEST_CHECK(sfAnimatedSprite_setSpriteSheet(trimmed, sheet, "walk"));
+    SF_TEST_CHECK(sfAnimatedSprite_setSpriteSheet(rotated, sheet, "walk"));
+    sfAnimatedSprite_createHitMask(trimmed, 0);
+    sfAnimatedSprite_createHitMask(rotated, 0);
+    sfAnimatedSprite_seek(rotated, sfMilliseconds(150));
+    // The single solid texel of the rotated frame is drawn at (1, 5)
+    sfAnimatedSprite_setPosition(rotated, (sfVector2f){2, -4});
+    SF_TEST_CHECK(sfAnimatedSprite_isPixelCollision(trimmed, rotated));
+    sfAnimatedSprite_setPosition(rotated, (sfVector2f){1, -4});
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelCollision(trimmed, rotated));
+    sfAnimatedSprite_setPosition(rotated, (sfVector2f){12, 9});
+    SF_TEST_CHECK(sfAnimatedSprite_isPixelCollision(trimmed, rotated));
+    sfAnimatedSprite_setPosition(rotated, (sfVector2f){13, 9});
+    SF_TEST_CHECK(!sfAnimatedSprite_isPixelCollision(trimmed, rotated));
+    sfAnimatedSprite_destroy(trimmed);
+    sfAnimatedSprite_destroy(rotated);
+    sfSpriteSheet_destroy(sheet);
+    sfTexture_destroy(texture);
+}
+
+////////////////////////////////////////////////////////////
+/// Frame rate animations wrap their time every numerator loops
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_elapsedTimeWrap(void)
+{
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(sprite != NULL))
+        return;
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    SF_TEST_CHECK(sfAnimatedSprite_setFrameRateRatio(sprite, 10, 3));
+    // A loop lasts 4.8 seconds, the time wraps after 10 loops
+    sfAnimatedSprite_seek(sprite, sfSeconds(24));
+    SF_TEST_CHECK(sfAnimatedSprite_getElapsedTime(sprite).microseconds == 24000000);
+    sfAnimatedSprite_seek(sprite, sfSeconds(50));
+    SF_TEST_CHECK(sfAnimatedSprite_getElapsedTime(sprite).microseconds == 2000000);
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfSeconds(50)) == sfAnimatedSprite_getFrameAt(sprite, sfSeconds(2)));
+    sfAnimatedSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Grid animation of 16 frames of 16x16 pixels
+////////////////////////////////////////////////////////////
+static sfAnimatedSprite *sfAnimatedSpriteTest_createGrid(sfTexture *texture)
+{
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (sprite == NULL)
+        return (NULL);
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprite, (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprite, (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_seek(sprite, sfMicroseconds(0));
+    return (sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// After n fixed step updates the frame shown is the frame at
+/// n steps, for frame rates above the update rate too
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_fixedStep(void)
+{
+    static const size_t frameRates[] = {10, 60, 144, 240, 1000};
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfTime step = sfMicroseconds(16667);
+
+    if (!SF_TEST_CHECK(sprite != NULL))
+        return;
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_setFixedStep(sprite, step);
+    for (size_t i = 0; i < sizeof(frameRates) / sizeof(*frameRates); i++) {
+        sfAnimatedSprite_setFrameRate(sprite, frameRates[i]);
+        sfAnimatedSprite_seek(sprite, sfMicroseconds(0));
+        for (sfInt64 n = 1; n <= 500; n++) {
+            sfAnimatedSprite_update(sprite);
+            if (!SF_TEST_CHECK(sprite->currentFrame == sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(n * step.microseconds))) ||
+                !SF_TEST_CHECK(sprite->currentFrame == (size_t)(n * step.microseconds * (sfInt64)frameRates[i] / 1000000 % 16)))
+                break;
+        }
+    }
+    // One frame per update at a rate matching the step
+    sfAnimatedSprite_setFrameRate(sprite, 1000);
+    sfAnimatedSprite_setFixedStep(sprite, sfMilliseconds(1));
+    sfAnimatedSprite_seek(sprite, sfMicroseconds(0));
+    for (size_t n = 1; n <= 40; n++) {
+        sfAnimatedSprite_update(sprite);
+        if (!SF_TEST_CHECK(sprite->currentFrame == n % 16))
+            break;
+    }
+    sfAnimatedSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// 30000 / 1001 frames per second does not drift, however
+/// small the steps are
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_ntscFrameRate(void)
+{
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(sprite != NULL))
+        return;
+    sfAnimatedSprite_setMaxFrame(sprite, 30);
+    SF_TEST_CHECK(sfAnimatedSprite_setFrameRateRatio(sprite, 30000, 1001));
+    // 1001 seconds are exactly 30000 frames, 1000 whole loops
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(1001000000)) == 0);
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(1001000000 - 1)) == 29);
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(1001 * 1000000 + 33367)) == 1);
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds((sfInt64)31 * 1001000000)) == 0);
+    for (int i = 0; i < 1001000; i++)
+        sfAnimatedSprite_advance(sprite, sfMilliseconds(1));
+    SF_TEST_CHECK(sfAnimatedSprite_getElapsedTime(sprite).microseconds == 1001000000);
+    SF_TEST_CHECK(sprite->currentFrame == 0);
+    sfAnimatedSprite_advance(sprite, sfMicroseconds(33366));
+    SF_TEST_CHECK(sprite->currentFrame == 0);
+    sfAnimatedSprite_advance(sprite, sfMicroseconds(1));
+    SF_TEST_CHECK(sprite->currentFrame == 1);
+    sfAnimatedSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Frames with their own durations, from the frame at a time
+/// and from fixed step updates
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_frameDurations(void)
+{
+    const sfTime durations[] = {sfMilliseconds(100), sfMilliseconds(50), sfMilliseconds(200)};
+    static const sfInt64 times[] = {0, 99999, 100000, 149999, 150000, 349999, 350000, 450000};
+    static const size_t frames[] = {0, 0, 1, 1, 2, 2, 0, 1};
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(sprite != NULL))
+        return;
+    SF_TEST_CHECK(sfAnimatedSprite_setFrameDurations(sprite, durations, 3));
+    for (size_t i = 0; i < sizeof(times) / sizeof(*times); i++)
+        SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(times[i])) == frames[i]);
+    sfAnimatedSprite_setFixedStep(sprite, sfMilliseconds(30));
+    for (sfInt64 n = 1; n <= 100; n++) {
+        sfAnimatedSprite_update(sprite);
+        if (!SF_TEST_CHECK(sprite->currentFrame == sfAnimatedSprite_getFrameAt(sprite, sfMicroseconds(n * 30000))))
+            break;
+    }
+    SF_TEST_CHECK(sfAnimatedSprite_getElapsedTime(sprite).microseconds == 100 * 30000 % 350000);
+    // Back to the frame rate
+    SF_TEST_CHECK(sfAnimatedSprite_setFrameDurations(sprite, NULL, 0));
+    sfAnimatedSprite_setMaxFrame(sprite, 4);
+    sfAnimatedSprite_setFrameRate(sprite, 10);
+    SF_TEST_CHECK(sfAnimatedSprite_getFrameAt(sprite, sfMilliseconds(350)) == 3);
+    sfAnimatedSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Sprites updated once every few draws by the level of
+/// detail still move by one fixed step per draw
+////////////////////////////////////////////////////////////
+static void sfAnimatedSpriteTest_fixedStepLod(void)
+{
+    sfRenderWindow *window = sfRenderWindow_create((sfVideoMode){200, 200, 32}, "lod", 0, NULL);
+    sfTexture *texture = sfTexture_create(64, 64);
+    sfAnimatedSprite *sprites[2] = {sfAnimatedSpriteTest_createGrid(texture), sfAnimatedSpriteTest_createGrid(texture)};
+    sfLevelOfDetail lod = sfLevelOfDetail_getDefault();
+    sfInt64 step = 16667;
+
+    if (!SF_TEST_CHECK(window != NULL && sprites[0] != NULL && sprites[1] != NULL))
+        return;
+    for (int i = 0; i < 2; i++) {
+        sfAnimatedSprite_setFrameRate(sprites[i], 24);
+        sfAnimatedSprite_setFixedStep(sprites[i], sfMicroseconds(step));
+    }
+    // 8 pixels on screen, updated every 8 draws, against 16 pixels updated on every draw
+    sfAnimatedSprite_setScale(sprites[0], (sfVector2f){0.5f, 0.5f});
+    sfAnimatedSprite_setScale(sprites[1], (sfVector2f){8, 8});
+    for (sfInt64 n = 1; n <= 161; n++) {
+        sfRenderWindow_drawAnimatedSpriteLod(window, sprites[0], &lod, NULL);
+        sfRenderWindow_drawAnimatedSpriteLod(window, sprites[1], &lod, NULL);
+        if (n % 8 != 1)
+            continue;
+        SF_TEST_CHECK(sfAnimatedSprite_getElapsedTime(sprites[0]).microseconds == n * step % 16000000);
+        SF_TEST_CHECK(sprites[0]->currentFrame == sfAnimatedSprite_getFrameAt(sprites[0], sfMicroseconds(n * step)));
+        SF_TEST_CHECK(sprites[0]->currentFrame == sprites[1]->currentFrame);
+    }
+    SF_TEST_CHECK(lod.counts[3] == 161 && lod.counts[0] == 161);
+    sfAnimatedSprite_destroy(sprites[0]);
+    sfAnimatedSprite_destroy(sprites[1]);
+    sfTexture_destroy(texture);
+    sfRenderWindow_destroy(window);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("animatedSprite.gridBounds", sfAnimatedSpriteTest_gridBounds);
+    sfTest_run("animatedSprite.sheetBounds", sfAnimatedSpriteTest_sheetBounds);
+    sfTest_run("animatedSprite.sheetHover", sfAnimatedSpriteTest_sheetHover);
+    sfTest_run("animatedSprite.sheetCollision", sfAnimatedSpriteTest_sheetCollision);
+    sfTest_run("animatedSprite.elapsedTimeWrap", sfAnimatedSpriteTest_elapsedTimeWrap);
+    sfTest_run("animatedSprite.fixedStep", sfAnimatedSpriteTest_fixedStep);
+    sfTest_run("animatedSprite.ntscFrameRate", sfAnimatedSpriteTest_ntscFrameRate);
+    sfTest_run("animatedSprite.frameDurations", sfAnimatedSpriteTest_frameDurations);
+    sfTest_run("animatedSprite.fixedStepLod", sfAnimatedSpriteTest_fixedStepLod);
+    return (sfTest_finish());
+}
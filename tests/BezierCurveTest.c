@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/BezierCurve.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+static sfBezierCurve *sfBezierCurveTest_create(size_t pointCount)
+{
+    sfBezierCurve *curve = sfBezierCurve_create();
+
+    for (size_t i = 0; i < pointCount; i++)
+        sfBezierCurve_addPoint(curve, (sfVector2f){i * 40.f, (i % 2) * 300.f - i * 7.f});
+    return (curve);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveTest_endPoints(void)
+{
+    for (size_t count = 2; count <= 20; count++) {
+        sfBezierCurve *curve = sfBezierCurveTest_create(count);
+        sfVector2f first = sfBezierCurve_calculatePoint(curve, 0.f);
+        sfVector2f last = sfBezierCurve_calculatePoint(curve, 1.f);
+
+        SF_TEST_CHECK_NEAR(first.x, curve->points[0].x, 1e-3);
+        SF_TEST_CHECK_NEAR(first.y, curve->points[0].y, 1e-3);
+        SF_TEST_CHECK_NEAR(last.x, curve->points[count - 1].x, 1e-2);
+        SF_TEST_CHECK_NEAR(last.y, curve->points[count - 1].y, 1e-2);
+        sfBezierCurve_destroy(curve);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveTest_kernelsMatchGeneric(void)
+{
+    for (size_t count = 2; count <= 6; count++) {
+        sfBezierCurve *curve = sfBezierCurveTest_create(count);
+
+        for (int i = 0; i <= 64; i++) {
+            sfVector2f fast = sfBezierCurve_calculatePoint(curve, i / 64.f);
+            sfVector2f generic = sfBezierCurve_calculatePointGeneric(curve, i / 64.f);
+
+            SF_TEST_CHECK(fast.x == generic.x && fast.y == generic.y);
+        }
+        sfBezierCurve_destroy(curve);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveTest_boundsEncloseSamples(void)
+{
+    sfVertex vertices[257];
+
+    for (size_t count = 2; count <= 20; count += 3) {
+        sfBezierCurve *curve = sfBezierCurveTest_create(count);
+        sfFloatRect bounds = sfBezierCurve_getBounds(curve);
+
+        sfBezierCurve_sample(curve, vertices, 257);
+        for (size_t i = 0; i < 257; i++) {
+            SF_TEST_CHECK(vertices[i].position.x >= bounds.left - 1e-2f);
+            SF_TEST_CHECK(vertices[i].position.y >= bounds.top - 1e-2f);
+            SF_TEST_CHECK(vertices[i].position.x <= bounds.left + bounds.width + 1e-2f);
+            SF_TEST_CHECK(vertices[i].position.y <= bounds.top + bounds.height + 1e-2f);
+        }
+        sfBezierCurve_destroy(curve);
+    }
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierCurveTest_moveKeepsBounds(void)
+{
+    sfBezierCurve *curve = sfBezierCurveTest_create(5);
+    sfFloatRect before = sfBezierCurve_getBounds(curve);
+    sfFloatRect after;
+
+    sfBezierCurve_move(curve, (sfVector2f){12.f, -30.f});
+    after = sfBezierCurve_getBounds(curve);
+    SF_TEST_CHECK_NEAR(after.left, before.left + 12.f, 1e-3);
+    SF_TEST_CHECK_NEAR(after.top, before.top - 30.f, 1e-3);
+    SF_TEST_CHECK_NEAR(after.width, before.width, 1e-3);
+    SF_TEST_CHECK_NEAR(after.height, before.height, 1e-3);
+    sfBezierCurve_destroy(curve);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("bezierCurve.endPoints", sfBezierCurveTest_endPoints);
+    sfTest_run("bezierCurve.kernelsMatchGeneric", sfBezierCurveTest_kernelsMatchGeneric);
+    sfTest_run("bezierCurve.boundsEncloseSamples", sfBezierCurveTest_boundsEncloseSamples);
+    sfTest_run("bezierCurve.moveKeepsBounds", sfBezierCurveTest_moveKeepsBounds);
+    return (sfTest_finish());
+}
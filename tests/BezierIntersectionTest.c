@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <SFML/Addition/BezierIntersection.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTIONTEST_TRIALS 300
+#define SF_BEZIERINTERSECTIONTEST_TOLERANCE 0.01f
+#define SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS 64
+
+////////////////////////////////////////////////////////////
+/// The reference samples the curves densely in double
+/// precision, and crosses chunks of segments whose boxes meet
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTIONTEST_SAMPLES 3000
+#define SF_BEZIERINTERSECTIONTEST_CHUNK 50
+
+////////////////////////////////////////////////////////////
+/// Largest distance between a crossing and its reference,
+/// and between a crossing and its curves at its times
+////////////////////////////////////////////////////////////
+#define SF_BEZIERINTERSECTIONTEST_MATCH 0.1
+#define SF_BEZIERINTERSECTIONTEST_ON_CURVE 0.05
+
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    double x;
+    double y;
+} sfBezierIntersectionTestPoint;
+
+////////////////////////////////////////////////////////////
+static unsigned int sfBezierIntersectionTest_seed = 3;
+static sfBezierIntersectionTestPoint sfBezierIntersectionTest_samplesA[SF_BEZIERINTERSECTIONTEST_SAMPLES + 1];
+static sfBezierIntersectionTestPoint sfBezierIntersectionTest_samplesB[SF_BEZIERINTERSECTIONTEST_SAMPLES + 1];
+
+////////////////////////////////////////////////////////////
+static float sfBezierIntersectionTest_random(void)
+{
+    sfBezierIntersectionTest_seed = sfBezierIntersectionTest_seed * 1103515245u + 12345u;
+    return ((sfBezierIntersectionTest_seed >> 8) / 16777216.f);
+}
+
+////////////////////////////////////////////////////////////
+static sfBezierCurve *sfBezierIntersectionTest_randomCurve(size_t pointCount)
+{
+    sfBezierCurve *curve = sfBezierCurve_create();
+
+    for (size_t i = 0; i < pointCount; i++) {
+        sfBezierCurve_addPoint(curve, (sfVector2f){sfBezierIntersectionTest_random() * 100,
+            sfBezierIntersectionTest_random() * 100});
+    }
+    return (curve);
+}
+
+////////////////////////////////////////////////////////////
+/// De Casteljau's algorithm in double precision
+////////////////////////////////////////////////////////////
+static sfBezierIntersectionTestPoint sfBezierIntersectionTest_evaluate(const sfBezierCurve *curve, double time)
+{
+    sfBezierIntersectionTestPoint points[SF_BEZIERINTERSECTION_MAX_POINTS];
+
+    for (size_t i = 0; i < curve->pointCount; i++)
+        points[i] = (sfBezierIntersectionTestPoint){curve->points[i].x, curve->points[i].y};
+    for (size_t k = 1; k < curve->pointCount; k++) {
+        for (size_t i = 0; i < curve->pointCount - k; i++) {
+            points[i].x += (points[i + 1].x - points[i].x) * time;
+            points[i].y += (points[i + 1].y - points[i].y) * time;
+        }
+    }
+    return (points[0]);
+}
+
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_sample(const sfBezierCurve *curve, sfBezierIntersectionTestPoint *samples)
+{
+    for (int i = 0; i <= SF_BEZIERINTERSECTIONTEST_SAMPLES; i++)
+        samples[i] = sfBezierIntersectionTest_evaluate(curve, (double)i / SF_BEZIERINTERSECTIONTEST_SAMPLES);
+}
+
+////////////////////////////////////////////////////////////
+/// Box of the chunk of samples starting at first
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_chunkBox(const sfBezierIntersectionTestPoint *samples, int first, double box[4])
+{
+    box[0] = box[2] = samples[first].x;
+    box[1] = box[3] = samples[first].y;
+    for (int i = first + 1; i <= first + SF_BEZIERINTERSECTIONTEST_CHUNK; i++) {
+        box[0] = fmin(box[0], samples[i].x);
+        box[1] = fmin(box[1], samples[i].y);
+        box[2] = fmax(box[2], samples[i].x);
+        box[3] = fmax(box[3], samples[i].y);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Cross the segments of two chunks, adding the new points
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_crossChunks(int firstA, int firstB, sfBezierIntersectionTestPoint *crossings, size_t *count)
+{
+    const sfBezierIntersectionTestPoint *a = sfBezierIntersectionTest_samplesA;
+    const sfBezierIntersectionTestPoint *b = sfBezierIntersectionTest_samplesB;
+    sfBezierIntersectionTestPoint r, s, q, point;
+    double denominator, t, u;
+    sfBool duplicate;
+
+    for (int i = firstA; i < firstA + SF_BEZIERINTERSECTIONTEST_CHUNK; i++) {
+        for (int j = firstB; j < firstB + SF_BEZIERINTERSECTIONTEST_CHUNK; j++) {
+            r = (sfBezierIntersectionTestPoint){a[i + 1].x - a[i].x, a[i + 1].y - a[i].y};
+            s = (sfBezierIntersectionTestPoint){b[j + 1].x - b[j].x, b[j + 1].y - b[j].y};
+            q = (sfBezierIntersectionTestPoint){b[j].x - a[i].x, b[j].y - a[i].y};
+            denominator = r.x * s.y - r.y * s.x;
+            if (denominator == 0)
+                continue;
+            t = (q.x * s.y - q.y * s.x) / denominator;
+            u = (q.x * r.y - q.y * r.x) / denominator;
+            if (t < 0 || t >= 1 || u < 0 || u >= 1)
+                continue;
+            point = (sfBezierIntersectionTestPoint){a[i].x + r.x * t, a[i].y + r.y * t};
+            duplicate = sfFalse;
+            for (size_t k = 0; k < *count; k++)
+                duplicate |= fabs(crossings[k].x - point.x) < 0.05 && fabs(crossings[k].y - point.y) < 0.05;
+            if (!duplicate && *count < SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS)
+                crossings[(*count)++] = point;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Crossings of the dense polylines of two curves
+////////////////////////////////////////////////////////////
+static size_t sfBezierIntersectionTest_reference(const sfBezierCurve *curveA, const sfBezierCurve *curveB, sfBezierIntersectionTestPoint *crossings)
+{
+    double boxA[4];
+    double boxB[4];
+    size_t count = 0;
+
+    sfBezierIntersectionTest_sample(curveA, sfBezierIntersectionTest_samplesA);
+    sfBezierIntersectionTest_sample(curveB, sfBezierIntersectionTest_samplesB);
+    for (int i = 0; i < SF_BEZIERINTERSECTIONTEST_SAMPLES; i += SF_BEZIERINTERSECTIONTEST_CHUNK) {
+        sfBezierIntersectionTest_chunkBox(sfBezierIntersectionTest_samplesA, i, boxA);
+        for (int j = 0; j < SF_BEZIERINTERSECTIONTEST_SAMPLES; j += SF_BEZIERINTERSECTIONTEST_CHUNK) {
+            sfBezierIntersectionTest_chunkBox(sfBezierIntersectionTest_samplesB, j, boxB);
+            if (boxA[0] <= boxB[2] && boxB[0] <= boxA[2] && boxA[1] <= boxB[3] && boxB[1] <= boxA[3])
+                sfBezierIntersectionTest_crossChunks(i, j, crossings, &count);
+        }
+    }
+    return (count);
+}
+
+////////////////////////////////////////////////////////////
+/// Every crossing found has a reference crossing next to it,
+/// and every reference crossing was found
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_match(const sfBezierIntersection *found, size_t foundCount, const sfBezierIntersectionTestPoint *reference, size_t referenceCount)
+{
+    sfBool matched;
+
+    for (size_t i = 0; i < foundCount; i++) {
+        matched = sfFalse;
+        for (size_t k = 0; k < referenceCount; k++)
+            matched |= hypot(reference[k].x - found[i].point.x, reference[k].y - found[i].point.y) < SF_BEZIERINTERSECTIONTEST_MATCH;
+        SF_TEST_CHECK(matched);
+        if (i > 0)
+            SF_TEST_CHECK(found[i].timeA >= found[i - 1].timeA);
+    }
+    for (size_t k = 0; k < referenceCount; k++) {
+        matched = sfFalse;
+        for (size_t i = 0; i < foundCount; i++)
+            matched |= hypot(reference[k].x - found[i].point.x, reference[k].y - found[i].point.y) < SF_BEZIERINTERSECTIONTEST_MATCH;
+        SF_TEST_CHECK(matched);
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// The point of a crossing lies on both curves at its times
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_checkTimes(const sfBezierIntersection *crossing, const sfBezierCurve *curveA, const sfBezierCurve *curveB)
+{
+    sfBezierIntersectionTestPoint a = sfBezierIntersectionTest_evaluate(curveA, crossing->timeA);
+    sfBezierIntersectionTestPoint b = sfBezierIntersectionTest_evaluate(curveB, crossing->timeB);
+
+    SF_TEST_CHECK(hypot(a.x - crossing->point.x, a.y - crossing->point.y) < SF_BEZIERINTERSECTIONTEST_ON_CURVE);
+    SF_TEST_CHECK(hypot(b.x - crossing->point.x, b.y - crossing->point.y) < SF_BEZIERINTERSECTIONTEST_ON_CURVE);
+}
+
+////////////////////////////////////////////////////////////
+/// Random pairs of curves of 2 to 5 points, and a few of 10
+/// points and more
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_randomCurves(void)
+{
+    sfBezierIntersection found[SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS];
+    sfBezierIntersectionTestPoint reference[SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS];
+    size_t foundCount = 0;
+    size_t referenceCount = 0;
+    size_t total = 0;
+
+    sfBezierIntersectionTest_seed = 3;
+    for (int trial = 0; trial < SF_BEZIERINTERSECTIONTEST_TRIALS; trial++) {
+        sfBezierCurve *a = sfBezierIntersectionTest_randomCurve(2 + trial % 4);
+        sfBezierCurve *b = sfBezierIntersectionTest_randomCurve(2 + trial / 4 % 5 + (trial % 37 == 0 ? 8 : 0));
+
+        foundCount = sfBezierCurve_intersectCurve(a, b, SF_BEZIERINTERSECTIONTEST_TOLERANCE, found, SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS);
+        referenceCount = sfBezierIntersectionTest_reference(a, b, reference);
+        sfBezierIntersectionTest_match(found, foundCount, reference, referenceCount);
+        for (size_t i = 0; i < foundCount; i++)
+            sfBezierIntersectionTest_checkTimes(&found[i], a, b);
+        total += foundCount;
+        sfBezierCurve_destroy(a);
+        sfBezierCurve_destroy(b);
+    }
+    SF_TEST_CHECK(total > SF_BEZIERINTERSECTIONTEST_TRIALS / 4);
+}
+
+////////////////////////////////////////////////////////////
+/// Random curves against random segments
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_randomLines(void)
+{
+    sfBezierIntersection found[SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS];
+    sfBezierIntersectionTestPoint reference[SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS];
+    size_t foundCount = 0;
+    size_t referenceCount = 0;
+    size_t total = 0;
+
+    sfBezierIntersectionTest_seed = 5;
+    for (int trial = 0; trial < SF_BEZIERINTERSECTIONTEST_TRIALS; trial++) {
+        sfBezierCurve *curve = sfBezierIntersectionTest_randomCurve(2 + trial % 5);
+        sfBezierCurve *line = sfBezierIntersectionTest_randomCurve(2);
+
+        foundCount = sfBezierCurve_intersectLine(curve, line->points[0], line->points[1],
+            SF_BEZIERINTERSECTIONTEST_TOLERANCE, found, SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS);
+        referenceCount = sfBezierIntersectionTest_reference(curve, line, reference);
+        sfBezierIntersectionTest_match(found, foundCount, reference, referenceCount);
+        for (size_t i = 0; i < foundCount; i++)
+            sfBezierIntersectionTest_checkTimes(&found[i], curve, line);
+        total += foundCount;
+        sfBezierCurve_destroy(curve);
+        sfBezierCurve_destroy(line);
+    }
+    SF_TEST_CHECK(total > SF_BEZIERINTERSECTIONTEST_TRIALS / 4);
+}
+
+////////////////////////////////////////////////////////////
+/// A line touching the apex of a parabola is found once, at
+/// the apex, and nothing is found once they are apart
+////////////////////////////////////////////////////////////
+static void sfBezierIntersectionTest_tangent(void)
+{
+    sfBezierIntersection found[SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS];
+    sfBezierCurve *curve = sfBezierCurve_create();
+    size_t count = 0;
+
+    sfBezierCurve_addPoint(curve, (sfVector2f){0, 0});
+    sfBezierCurve_addPoint(curve, (sfVector2f){50, 100});
+    sfBezierCurve_addPoint(curve, (sfVector2f){100, 0});
+    count = sfBezierCurve_intersectLine(curve, (sfVector2f){0, 50}, (sfVector2f){100, 50},
+        SF_BEZIERINTERSECTIONTEST_TOLERANCE, found, SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS);
+    if (SF_TEST_CHECK(count == 1)) {
+        SF_TEST_CHECK_NEAR(found[0].point.x, 50, 0.5);
+        SF_TEST_CHECK_NEAR(found[0].point.y, 50, SF_BEZIERINTERSECTIONTEST_ON_CURVE);
+        SF_TEST_CHECK_NEAR(found[0].timeA, 0.5, 0.01);
+        SF_TEST_CHECK_NEAR(found[0].timeB, 0.5, 0.01);
+    }
+    sfBezierCurve_move(curve, (sfVector2f){1000, 0});
+    count = sfBezierCurve_intersectLine(curve, (sfVector2f){0, 50}, (sfVector2f){100, 50},
+        SF_BEZIERINTERSECTIONTEST_TOLERANCE, found, SF_BEZIERINTERSECTIONTEST_MAX_CROSSINGS);
+    SF_TEST_CHECK(count == 0);
+    sfBezierCurve_destroy(curve);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("bezierIntersection.randomCurves", sfBezierIntersectionTest_randomCurves);
+    sfTest_run("bezierIntersection.randomLines", sfBezierIntersectionTest_randomLines);
+    sfTest_run("bezierIntersection.tangent", sfBezierIntersectionTest_tangent);
+    return (sfTest_finish());
+}
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/Broadphase.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Number of sprites of the brute force scene
+////////////////////////////////////////////////////////////
+#define SF_BROADPHASE_TEST_SPRITES 48
+
+////////////////////////////////////////////////////////////
+/// Sprites of a scene with the proxy of each, -1 when it is
+/// not tracked
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSprite *sprites[SF_BROADPHASE_TEST_SPRITES];
+    size_t proxies[SF_BROADPHASE_TEST_SPRITES];
+    unsigned int seed;
+} sfBroadphaseTestScene;
+
+////////////////////////////////////////////////////////////
+static unsigned int sfBroadphaseTest_random(sfBroadphaseTestScene *scene, unsigned int range)
+{
+    scene->seed = scene->seed * 1103515245u + 12345u;
+    return ((scene->seed >> 16) % range);
+}
+
+////////////////////////////////////////////////////////////
+/// Place a sprite on whole coordinates, so that its bounds
+/// are exact
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_place(sfBroadphaseTestScene *scene, size_t index)
+{
+    sfSprite_setPosition(scene->sprites[index], (sfVector2f){(float)sfBroadphaseTest_random(scene, 200),
+        (float)sfBroadphaseTest_random(scene, 200)});
+}
+
+////////////////////////////////////////////////////////////
+/// Check the pairs of the last update against every couple of
+/// tracked sprites
+////////////////////////////////////////////////////////////
+static sfBool sfBroadphaseTest_bruteForce(sfBroadphase *broadphase, const sfBroadphaseTestScene *scene)
+{
+    sfBool found[SF_BROADPHASE_TEST_SPRITES][SF_BROADPHASE_TEST_SPRITES] = {{sfFalse}};
+    size_t indices[SF_BROADPHASE_TEST_SPRITES * 2];
+    size_t expected = 0;
+    size_t count = 0;
+    const sfBroadphasePair *pairs = sfBroadphase_getPairs(broadphase, &count);
+
+    for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES * 2; i++)
+        indices[i] = SF_BROADPHASE_TEST_SPRITES;
+    for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES; i++) {
+        if (scene->proxies[i] != (size_t)-1 && !SF_TEST_CHECK(sfBroadphase_getUserData(broadphase, scene->proxies[i]) == scene->sprites[i]))
+            return (sfFalse);
+        if (scene->proxies[i] != (size_t)-1)
+            indices[scene->proxies[i]] = i;
+    }
+    for (size_t i = 0; i < count; i++) {
+        size_t a = indices[pairs[i].first];
+        size_t b = indices[pairs[i].second];
+
+        if (!SF_TEST_CHECK(pairs[i].first < pairs[i].second && a < SF_BROADPHASE_TEST_SPRITES && b < SF_BROADPHASE_TEST_SPRITES))
+            return (sfFalse);
+        if (!SF_TEST_CHECK(!found[a][b]))
+            return (sfFalse);
+        found[a][b] = sfTrue;
+        found[b][a] = sfTrue;
+    }
+    for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES; i++) {
+        for (size_t j = i + 1; j < SF_BROADPHASE_TEST_SPRITES; j++) {
+            sfFloatRect a = sfSprite_getGlobalBounds(scene->sprites[i]);
+            sfFloatRect b = sfSprite_getGlobalBounds(scene->sprites[j]);
+            sfBool overlap = scene->proxies[i] != (size_t)-1 && scene->proxies[j] != (size_t)-1 &&
+                a.left < b.left + b.width && b.left < a.left + a.width &&
+                a.top < b.top + b.height && b.top < a.top + a.height;
+
+            if (!SF_TEST_CHECK(found[i][j] == overlap))
+                return (sfFalse);
+            expected += overlap;
+        }
+    }
+    return (SF_TEST_CHECK(count == expected && expected > 0));
+}
+
+////////////////////////////////////////////////////////////
+/// Pairs match a brute force test after sprites are added,
+/// moved and removed, and after removed proxies are given to
+/// new sprites before an update
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_pairs(void)
+{
+    sfBroadphaseTestScene scene;
+    sfBroadphase *broadphase = sfBroadphase_create(4);
+
+    if (!SF_TEST_CHECK(broadphase != NULL))
+        return;
+    scene.seed = 7;
+    for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES; i++) {
+        scene.sprites[i] = sfSprite_create();
+        sfSprite_setTextureRect(scene.sprites[i], (sfIntRect){0, 0, 4 + (int)sfBroadphaseTest_random(&scene, 30),
+            4 + (int)sfBroadphaseTest_random(&scene, 30)});
+        sfBroadphaseTest_place(&scene, i);
+        scene.proxies[i] = i < SF_BROADPHASE_TEST_SPRITES / 2 ? sfBroadphase_addSprite(broadphase, scene.sprites[i], scene.sprites[i]) : (size_t)-1;
+    }
+    sfBroadphase_update(broadphase);
+    sfBroadphaseTest_bruteForce(broadphase, &scene);
+    for (size_t round = 0; round < 20; round++) {
+        // Small moves keep the list almost sorted, a few jumps make the sort start over
+        for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES; i++) {
+            if (round % 5 == 4 || sfBroadphaseTest_random(&scene, 8) == 0)
+                sfBroadphaseTest_place(&scene, i);
+            else
+                sfSprite_move(scene.sprites[i], (sfVector2f){(float)sfBroadphaseTest_random(&scene, 7) - 3,
+                    (float)sfBroadphaseTest_random(&scene, 7) - 3});
+        }
+        for (size_t i = 0; i < 6; i++) {
+            size_t index = sfBroadphaseTest_random(&scene, SF_BROADPHASE_TEST_SPRITES);
+
+            if (scene.proxies[index] == (size_t)-1) {
+                scene.proxies[index] = sfBroadphase_addSprite(broadphase, scene.sprites[index], scene.sprites[index]);
+            } else {
+                sfBroadphase_remove(broadphase, scene.proxies[index]);
+                scene.proxies[index] = (size_t)-1;
+            }
+        }
+        sfBroadphase_update(broadphase);
+        if (!sfBroadphaseTest_bruteForce(broadphase, &scene))
+            break;
+    }
+    for (size_t i = 0; i < SF_BROADPHASE_TEST_SPRITES; i++)
+        sfSprite_destroy(scene.sprites[i]);
+    sfBroadphase_destroy(broadphase);
+}
+
+////////////////////////////////////////////////////////////
+/// A proxy removed and given to another sprite before the
+/// update only pairs the new sprite
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_reuse(void)
+{
+    sfBroadphase *broadphase = sfBroadphase_create(0);
+    sfSprite *sprites[3] = {sfSprite_create(), sfSprite_create(), sfSprite_create()};
+    size_t proxies[3];
+    const sfBroadphasePair *pairs = NULL;
+    size_t count = 0;
+
+    if (!SF_TEST_CHECK(broadphase != NULL))
+        return;
+    for (size_t i = 0; i < 3; i++)
+        sfSprite_setTextureRect(sprites[i], (sfIntRect){0, 0, 10, 10});
+    sfSprite_setPosition(sprites[1], (sfVector2f){5, 5});
+    sfSprite_setPosition(sprites[2], (sfVector2f){100, 100});
+    proxies[0] = sfBroadphase_addSprite(broadphase, sprites[0], sprites[0]);
+    proxies[1] = sfBroadphase_addSprite(broadphase, sprites[1], sprites[1]);
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 1);
+    // Removed then reused twice in the same frame, the stale entries must all be dropped
+    sfBroadphase_remove(broadphase, proxies[1]);
+    proxies[2] = sfBroadphase_addSprite(broadphase, sprites[1], NULL);
+    sfBroadphase_remove(broadphase, proxies[2]);
+    sfBroadphase_remove(broadphase, proxies[2]);
+    proxies[2] = sfBroadphase_addSprite(broadphase, sprites[2], sprites[2]);
+    SF_TEST_CHECK(proxies[2] == proxies[1]);
+    SF_TEST_CHECK(sfBroadphase_getUserData(broadphase, proxies[2]) == sprites[2]);
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 0);
+    sfSprite_setPosition(sprites[2], (sfVector2f){-5, 5});
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 1);
+    pairs = sfBroadphase_getPairs(broadphase, &count);
+    SF_TEST_CHECK(count == 1 && pairs[0].first == proxies[0] && pairs[0].second == proxies[2]);
+    for (size_t i = 0; i < 3; i++)
+        sfSprite_destroy(sprites[i]);
+    sfBroadphase_destroy(broadphase);
+}
+
+////////////////////////////////////////////////////////////
+/// Corners of a square of the given half diagonal turned 45
+/// degrees around a center
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_diamond(sfVector2f corners[4], float x, float y, float radius)
+{
+    corners[0] = (sfVector2f){x, y - radius};
+    corners[1] = (sfVector2f){x + radius, y};
+    corners[2] = (sfVector2f){x, y + radius};
+    corners[3] = (sfVector2f){x - radius, y};
+}
+
+////////////////////////////////////////////////////////////
+/// Rotated boxes whose bounding boxes overlap do not always
+/// intersect
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_orientedBox(void)
+{
+    sfVector2f a[4];
+    sfVector2f b[4];
+    const sfVector2f square[4] = {{3, 3}, {5, 3}, {5, 5}, {3, 5}};
+    const sfVector2f bar[4] = {{-10, 9}, {9, -10}, {10, -9}, {-9, 10}};
+
+    sfBroadphaseTest_diamond(a, 0, 0, 5);
+    // Diagonal neighbours: the bounding boxes overlap, the diamonds do not
+    sfBroadphaseTest_diamond(b, 7, 7, 5);
+    SF_TEST_CHECK(!sfOrientedBox_intersects(a, b));
+    SF_TEST_CHECK(!sfOrientedBox_intersects(b, a));
+    sfBroadphaseTest_diamond(b, 4, 4, 5);
+    SF_TEST_CHECK(sfOrientedBox_intersects(a, b));
+    SF_TEST_CHECK(sfOrientedBox_intersects(b, a));
+    // An axis aligned box in the corner of the bounding box of a diamond
+    SF_TEST_CHECK(!sfOrientedBox_intersects(a, square));
+    SF_TEST_CHECK(!sfOrientedBox_intersects(square, a));
+    // A thin bar across the diamond, with none of its corners inside
+    SF_TEST_CHECK(sfOrientedBox_intersects(a, bar));
+    SF_TEST_CHECK(sfOrientedBox_intersects(bar, a));
+    // Boxes that only touch do not overlap
+    sfBroadphaseTest_diamond(b, 10, 0, 5);
+    SF_TEST_CHECK(!sfOrientedBox_intersects(a, b));
+    SF_TEST_CHECK(!sfOrientedBox_intersects(a, NULL));
+}
+
+////////////////////////////////////////////////////////////
+/// The narrow phase drops pairs of rotated sprites that only
+/// overlap by their bounding boxes
+////////////////////////////////////////////////////////////
+static void sfBroadphaseTest_narrowPhase(void)
+{
+    sfBroadphase *broadphase = sfBroadphase_create(2);
+    sfSprite *sprites[2] = {sfSprite_create(), sfSprite_create()};
+
+    if (!SF_TEST_CHECK(broadphase != NULL))
+        return;
+    for (size_t i = 0; i < 2; i++) {
+        sfSprite_setTextureRect(sprites[i], (sfIntRect){0, 0, 10, 10});
+        sfSprite_setOrigin(sprites[i], (sfVector2f){5, 5});
+        sfSprite_setRotation(sprites[i], 45);
+        sfBroadphase_addSprite(broadphase, sprites[i], NULL);
+    }
+    sfSprite_setPosition(sprites[1], (sfVector2f){9, 9});
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 1);
+    sfBroadphase_setNarrowPhase(broadphase, sfTrue);
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 0);
+    sfSprite_setPosition(sprites[1], (sfVector2f){5, 5});
+    SF_TEST_CHECK(sfBroadphase_update(broadphase) == 1);
+    for (size_t i = 0; i < 2; i++)
+        sfSprite_destroy(sprites[i]);
+    sfBroadphase_destroy(broadphase);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("broadphase.pairs", sfBroadphaseTest_pairs);
+    sfTest_run("broadphase.reuse", sfBroadphaseTest_reuse);
+    sfTest_run("broadphase.orientedBox", sfBroadphaseTest_orientedBox);
+    sfTest_run("broadphase.narrowPhase", sfBroadphaseTest_narrowPhase);
+    return (sfTest_finish());
+}
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/CachedLayer.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Layer of 200x100 pixels
+////////////////////////////////////////////////////////////
+#define SF_CACHEDLAYERTEST_AREA 20000.f
+
+////////////////////////////////////////////////////////////
+/// Render a layer and get the fraction of it rendered again
+////////////////////////////////////////////////////////////
+static float sfCachedLayerTest_frame(sfCachedLayer *layer)
+{
+    sfCachedLayer_update(layer);
+    sfCachedLayer_render(layer);
+    return (sfCachedLayer_getStats(layer).redrawFraction);
+}
+
+////////////////////////////////////////////////////////////
+/// Moving the inner points of a curve keeps its bounds but
+/// still renders it again
+////////////////////////////////////////////////////////////
+static void sfCachedLayerTest_curveChanges(void)
+{
+    sfCachedLayer *layer = sfCachedLayer_create((sfFloatRect){0, 0, 200, 100});
+    sfBezierCurve *curve = sfBezierCurve_create();
+    sfFloatRect bounds;
+
+    if (!SF_TEST_CHECK(layer != NULL))
+        return;
+    for (size_t i = 1; i <= 4; i++)
+        sfBezierCurve_addPoint(curve, (sfVector2f){i * 10.f, i * 10.f});
+    sfCachedLayer_addBezierCurve(layer, curve);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 1, 1e-6);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 0, 1e-6);
+    SF_TEST_CHECK(sfCachedLayer_getStats(layer).cacheHits == 1);
+    bounds = sfBezierCurve_getBounds(curve);
+    curve->points[1] = (sfVector2f){30, 12};
+    curve->points[2] = (sfVector2f){38, 20};
+    SF_TEST_CHECK_NEAR(sfBezierCurve_getBounds(curve).width, bounds.width, 1e-4);
+    SF_TEST_CHECK_NEAR(sfBezierCurve_getBounds(curve).height, bounds.height, 1e-4);
+    // The padded 30x30 bounds, once for the old and the new shape, merged
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 32 * 32 / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    sfBezierCurve_setCurveColor(curve, (sfColor){255, 0, 0, 255});
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 32 * 32 / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 0, 1e-6);
+    SF_TEST_CHECK(sfCachedLayer_getStats(layer).frames == 5);
+    SF_TEST_CHECK(sfCachedLayer_getStats(layer).cacheHits == 2);
+    SF_TEST_CHECK_NEAR(sfCachedLayer_getStats(layer).averageRedrawFraction, (1 + 2 * 32 * 32 / SF_CACHEDLAYERTEST_AREA) / 5, 1e-6);
+    sfCachedLayer_destroy(layer);
+    sfBezierCurve_destroy(curve);
+}
+
+////////////////////////////////////////////////////////////
+/// A new texture or a flip keeps the bounds of a sprite but
+/// still renders it again
+////////////////////////////////////////////////////////////
+static void sfCachedLayerTest_spriteChanges(void)
+{
+    sfCachedLayer *layer = sfCachedLayer_create((sfFloatRect){0, 0, 200, 100});
+    sfTexture *first = sfTexture_create(16, 16);
+    sfTexture *second = sfTexture_create(16, 16);
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+
+    if (!SF_TEST_CHECK(layer != NULL))
+        return;
+    sfAnimatedSprite_setTexture(sprite, first, sfTrue);
+    sfAnimatedSprite_setPosition(sprite, (sfVector2f){58, 28});
+    sfAnimatedSprite_setOrigin(sprite, (sfVector2f){8, 8});
+    sfCachedLayer_addAnimatedSprite(layer, sprite);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 1, 1e-6);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 0, 1e-6);
+    sfAnimatedSprite_setTexture(sprite, second, sfFalse);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 18 * 18 / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    sfAnimatedSprite_setScale(sprite, (sfVector2f){-1, 1});
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 18 * 18 / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 0, 1e-6);
+    sfCachedLayer_destroy(layer);
+    sfAnimatedSprite_destroy(sprite);
+    sfTexture_destroy(first);
+    sfTexture_destroy(second);
+}
+
+////////////////////////////////////////////////////////////
+/// Overlapping dirty rectangles merge, too many collapse into
+/// their bounds, and more than half the layer renders it all
+////////////////////////////////////////////////////////////
+static void sfCachedLayerTest_dirtyRects(void)
+{
+    sfCachedLayer *layer = sfCachedLayer_create((sfFloatRect){0, 0, 200, 100});
+
+    if (!SF_TEST_CHECK(layer != NULL))
+        return;
+    sfCachedLayerTest_frame(layer);
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){10, 10, 10, 10});
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){100, 50, 10, 10});
+    SF_TEST_CHECK(layer->dirtyCount == 2);
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){15, 15, 10, 10});
+    SF_TEST_CHECK(layer->dirtyCount == 2);
+    // (9, 9, 17, 17) and (99, 49, 12, 12) once padded and merged
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), (17 * 17 + 12 * 12) / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    for (int i = 0; i < SF_CACHEDLAYER_MAX_DIRTY_RECTS; i++)
+        sfCachedLayer_invalidateRect(layer, (sfFloatRect){2 + i * 12, 2, 2, 2});
+    SF_TEST_CHECK(layer->dirtyCount == SF_CACHEDLAYER_MAX_DIRTY_RECTS);
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){2, 50, 2, 2});
+    SF_TEST_CHECK(layer->dirtyCount == 1);
+    SF_TEST_CHECK(layer->dirtyRects[0].left == 1 && layer->dirtyRects[0].top == 1);
+    SF_TEST_CHECK(layer->dirtyRects[0].width == 184 && layer->dirtyRects[0].height == 52);
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 184 * 52 / SF_CACHEDLAYERTEST_AREA, 1e-6);
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){-50, 20, 100, 100});
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){120, 0, 60, 80});
+    SF_TEST_CHECK(layer->dirtyCount == 2);
+    sfCachedLayer_invalidateRect(layer, (sfFloatRect){60, 10, 50, 80});
+    SF_TEST_CHECK_NEAR(sfCachedLayerTest_frame(layer), 1, 1e-6);
+    sfCachedLayer_resetStats(layer);
+    SF_TEST_CHECK(sfCachedLayer_getStats(layer).frames == 0);
+    sfCachedLayer_destroy(layer);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("cachedLayer.curveChanges", sfCachedLayerTest_curveChanges);
+    sfTest_run("cachedLayer.spriteChanges", sfCachedLayerTest_spriteChanges);
+    sfTest_run("cachedLayer.dirtyRects", sfCachedLayerTest_dirtyRects);
+    return (sfTest_finish());
+}
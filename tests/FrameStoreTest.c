@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string.h>
+#include <SFML/Addition/FrameStore.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Size of a frame of the test sheet, odd on both axes so that
+/// rows and palette indices do not end on a byte
+////////////////////////////////////////////////////////////
+static const sfVector2u sfFrameStoreTest_frameSize = {13, 9};
+
+////////////////////////////////////////////////////////////
+/// Sheet of 3 x 2 frames with a margin that is not a frame:
+/// noise, few colors, a gradient of many colors repeated every
+/// other row, stripes, a flat color and an empty frame
+////////////////////////////////////////////////////////////
+static sfImage *sfFrameStoreTest_createSheet(void)
+{
+    sfImage *image = sfImage_createFromColor(41, 19, sfTransparent);
+    unsigned int seed = 3;
+
+    for (unsigned int y = 0; y < 19; y++) {
+        for (unsigned int x = 0; x < 41; x++) {
+            unsigned int frame = x / 13 + y / 9 * 3;
+            unsigned int u = x % 13;
+            unsigned int v = y % 9;
+            sfColor color = sfTransparent;
+
+            seed = seed * 1103515245u + 12345u;
+            if (x >= 39 || y >= 18)
+                color = sfColor_fromRGBA(255, 0, 255, 255);
+            else if (frame == 0)
+                color = sfColor_fromRGBA((sfUint8)(seed >> 8), (sfUint8)(seed >> 16), (sfUint8)(seed >> 24), 255);
+            else if (frame == 1)
+                color = sfColor_fromRGBA((sfUint8)((seed >> 16) % 20 * 12), 40, 80, 255);
+            else if (frame == 2)
+                color = sfColor_fromRGBA((sfUint8)(u * 19), (sfUint8)(v / 2 * 60), 90, 255);
+            else if (frame == 3)
+                color = v % 2 ? sfColor_fromRGBA(255, 0, 0, 255) : sfColor_fromRGBA(0, 0, 255, 255);
+            else if (frame == 4)
+                color = sfColor_fromRGBA(10, 200, 30, 128);
+            sfImage_setPixel(image, x, y, color);
+        }
+    }
+    return (image);
+}
+
+////////////////////////////////////////////////////////////
+/// Check pixels against the area of a frame in the sheet
+////////////////////////////////////////////////////////////
+static sfBool sfFrameStoreTest_checkFrame(const sfImage *image, sfIntRect rect, const sfUint8 *pixels)
+{
+    if (!SF_TEST_CHECK(pixels != NULL))
+        return (sfFalse);
+    for (int y = 0; y < rect.height; y++) {
+        for (int x = 0; x < rect.width; x++) {
+            sfColor expected = sfImage_getPixel(image, (unsigned int)(rect.left + x), (unsigned int)(rect.top + y));
+            const sfUint8 *pixel = pixels + ((size_t)y * rect.width + x) * 4;
+
+            if (!SF_TEST_CHECK(pixel[0] == expected.r && pixel[1] == expected.g && pixel[2] == expected.b && pixel[3] == expected.a))
+                return (sfFalse);
+        }
+    }
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+/// Every frame comes back as it was, whichever way it was
+/// stored
+////////////////////////////////////////////////////////////
+static void sfFrameStoreTest_roundTrip(void)
+{
+    sfImage *image = sfFrameStoreTest_createSheet();
+    sfFrameStore *frameStore = sfFrameStore_createFromImage(image, sfFrameStoreTest_frameSize, 2);
+    sfUint8 pixels[13 * 9 * 4];
+    size_t encodings[3] = {0, 0, 0};
+
+    if (!SF_TEST_CHECK(frameStore != NULL))
+        return;
+    SF_TEST_CHECK(frameStore->gridSize.x == 3 && frameStore->gridSize.y == 2);
+    SF_TEST_CHECK(frameStore->frameCount == 6);
+    SF_TEST_CHECK(frameStore->frames[0].encoding == sfFrameRaw);
+    SF_TEST_CHECK(frameStore->frames[1].encoding == sfFramePalette);
+    SF_TEST_CHECK(frameStore->frames[2].encoding == sfFrameLz);
+    for (size_t i = 0; i < frameStore->frameCount; i++) {
+        sfIntRect rect = sfFrameStore_getFrameRect(frameStore, i);
+
+        encodings[frameStore->frames[i].encoding]++;
+        memset(pixels, 0xCD, sizeof(pixels));
+        SF_TEST_CHECK(sfFrameStore_decompressFrame(frameStore, i, pixels));
+        sfFrameStoreTest_checkFrame(image, rect, pixels);
+        sfFrameStoreTest_checkFrame(image, rect, sfFrameStore_getFrame(frameStore, i));
+    }
+    SF_TEST_CHECK(encodings[sfFrameRaw] > 0 && encodings[sfFrameLz] > 0 && encodings[sfFramePalette] > 0);
+    SF_TEST_CHECK(sfFrameStore_getCompressionRatio(frameStore) > 1);
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 6) == NULL);
+    SF_TEST_CHECK(!sfFrameStore_decompressFrame(frameStore, 6, pixels));
+    SF_TEST_CHECK(sfFrameStore_createFromImage(image, (sfVector2u){42, 9}, 2) == NULL);
+    sfFrameStore_destroy(frameStore);
+    sfImage_destroy(image);
+}
+
+////////////////////////////////////////////////////////////
+/// The least recently used frame is the one evicted
+////////////////////////////////////////////////////////////
+static void sfFrameStoreTest_eviction(void)
+{
+    sfImage *image = sfFrameStoreTest_createSheet();
+    sfFrameStore *frameStore = sfFrameStore_createFromImage(image, sfFrameStoreTest_frameSize, 2);
+    const sfUint8 *first = NULL;
+    const sfUint8 *second = NULL;
+
+    if (!SF_TEST_CHECK(frameStore != NULL))
+        return;
+    first = sfFrameStore_getFrame(frameStore, 0);
+    second = sfFrameStore_getFrame(frameStore, 1);
+    SF_TEST_CHECK(first != NULL && second != NULL && first != second);
+    SF_TEST_CHECK(frameStore->hits == 0 && frameStore->misses == 2);
+    // Frame 0 is used again, so frame 1 is the one replaced by frame 2
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 0) == first);
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 2) == second);
+    sfFrameStoreTest_checkFrame(image, sfFrameStore_getFrameRect(frameStore, 2), second);
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 0) == first);
+    SF_TEST_CHECK(frameStore->hits == 2 && frameStore->misses == 3);
+    // Now frame 2 was used last, frame 0 makes room for frame 1
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 2) == second);
+    SF_TEST_CHECK(sfFrameStore_getFrame(frameStore, 1) == first);
+    sfFrameStoreTest_checkFrame(image, sfFrameStore_getFrameRect(frameStore, 1), first);
+    sfFrameStoreTest_checkFrame(image, sfFrameStore_getFrameRect(frameStore, 2), second);
+    SF_TEST_CHECK(frameStore->hits == 3 && frameStore->misses == 4);
+    sfFrameStore_destroy(frameStore);
+    sfImage_destroy(image);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("frameStore.roundTrip", sfFrameStoreTest_roundTrip);
+    sfTest_run("frameStore.eviction", sfFrameStoreTest_eviction);
+    return (sfTest_finish());
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/HitMask.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Mask of an image whose solid pixels are listed, or every
+/// pixel when there is none
+////////////////////////////////////////////////////////////
+static sfHitMask *sfHitMaskTest_create(unsigned int width, unsigned int height, const sfVector2u *solid, size_t count)
+{
+    sfImage *image = sfImage_createFromColor(width, height, count > 0 ? sfTransparent : sfWhite);
+    sfHitMask *hitMask = NULL;
+
+    for (size_t i = 0; i < count; i++)
+        sfImage_setPixel(image, solid[i].x, solid[i].y, sfWhite);
+    hitMask = sfHitMask_createFromImage(image, 0);
+    sfImage_destroy(image);
+    return (hitMask);
+}
+
+////////////////////////////////////////////////////////////
+/// Mask of an image with about one solid pixel out of seven
+////////////////////////////////////////////////////////////
+static sfHitMask *sfHitMaskTest_createRandom(unsigned int width, unsigned int height, unsigned int seed)
+{
+    sfImage *image = sfImage_createFromColor(width, height, sfTransparent);
+    sfHitMask *hitMask = NULL;
+
+    for (unsigned int y = 0; y < height; y++) {
+        for (unsigned int x = 0; x < width; x++) {
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 7 == 0)
+                sfImage_setPixel(image, x, y, sfWhite);
+        }
+    }
+    hitMask = sfHitMask_createFromImage(image, 0);
+    sfImage_destroy(image);
+    return (hitMask);
+}
+
+////////////////////////////////////////////////////////////
+/// Overlap of two areas placed at integer offsets, one pixel
+/// at a time
+////////////////////////////////////////////////////////////
+static sfBool sfHitMaskTest_bruteForce(const sfHitMask *hitMaskA, sfIntRect rectA, sfVector2i offsetA, const sfHitMask *hitMaskB, sfIntRect rectB, sfVector2i offsetB)
+{
+    for (int y = 0; y < rectA.height; y++) {
+        for (int x = 0; x < rectA.width; x++) {
+            int bx = x + offsetA.x - offsetB.x;
+            int by = y + offsetA.y - offsetB.y;
+
+            if (bx < 0 || by < 0 || bx >= rectB.width || by >= rectB.height)
+                continue;
+            if (sfHitMask_getPixel(hitMaskA, rectA.left + x, rectA.top + y) && sfHitMask_getPixel(hitMaskB, rectB.left + bx, rectB.top + by))
+                return (sfTrue);
+        }
+    }
+    return (sfFalse);
+}
+
+////////////////////////////////////////////////////////////
+/// Local points read the displayed area, flipped or not
+////////////////////////////////////////////////////////////
+static void sfHitMaskTest_containsLocalPoint(void)
+{
+    const sfVector2u solid[] = {{6, 1}};
+    sfHitMask *hitMask = sfHitMaskTest_create(8, 4, solid, 1);
+
+    if (!SF_TEST_CHECK(hitMask != NULL))
+        return;
+    SF_TEST_CHECK(sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 0, 4, 4}, (sfVector2f){2.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 0, 4, 4}, (sfVector2f){1.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 0, 4, 4}, (sfVector2f){-0.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 0, 2, 4}, (sfVector2f){2.5f, 1.5f}));
+    // Mirrored horizontally, vertically and both
+    SF_TEST_CHECK(sfHitMask_containsLocalPoint(hitMask, (sfIntRect){8, 0, -4, 4}, (sfVector2f){1.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){8, 0, -4, 4}, (sfVector2f){2.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){8, 0, -4, 4}, (sfVector2f){4.5f, 1.5f}));
+    SF_TEST_CHECK(sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 4, 4, -4}, (sfVector2f){2.5f, 2.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){4, 4, 4, -4}, (sfVector2f){2.5f, 1.5f}));
+    SF_TEST_CHECK(sfHitMask_containsLocalPoint(hitMask, (sfIntRect){8, 4, -4, -4}, (sfVector2f){1.5f, 2.5f}));
+    // Flipped areas reaching past the mask
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(hitMask, (sfIntRect){2, 0, -4, 4}, (sfVector2f){3.5f, 1.5f}));
+    SF_TEST_CHECK(!sfHitMask_containsLocalPoint(NULL, (sfIntRect){4, 0, 4, 4}, (sfVector2f){2.5f, 1.5f}));
+    sfHitMask_destroy(hitMask);
+}
+
+////////////////////////////////////////////////////////////
+/// Bits past the right edge of an area never collide, at the
+/// end of a word or inside one
+////////////////////////////////////////////////////////////
+static void sfHitMaskTest_wordEdges(void)
+{
+    sfHitMask *wide = sfHitMaskTest_create(130, 1, NULL, 0);
+    sfHitMask *dot = sfHitMaskTest_create(1, 1, NULL, 0);
+    sfTransform transform = sfTransform_Identity;
+    sfTransform dotTransform = sfTransform_Identity;
+    static const sfIntRect rects[] = {{0, 0, 70, 1}, {60, 0, 10, 1}, {0, 0, 64, 1}, {65, 0, 64, 1}};
+
+    if (!SF_TEST_CHECK(wide != NULL && dot != NULL))
+        return;
+    for (size_t i = 0; i < sizeof(rects) / sizeof(*rects); i++) {
+        dotTransform = sfTransform_fromMatrix(1, 0, rects[i].width - 1, 0, 1, 0, 0, 0, 1);
+        SF_TEST_CHECK(sfHitMask_intersects(wide, rects[i], &transform, dot, (sfIntRect){0, 0, 1, 1}, &dotTransform));
+        dotTransform = sfTransform_fromMatrix(1, 0, rects[i].width, 0, 1, 0, 0, 0, 1);
+        SF_TEST_CHECK(!sfHitMask_intersects(wide, rects[i], &transform, dot, (sfIntRect){0, 0, 1, 1}, &dotTransform));
+        dotTransform = sfTransform_fromMatrix(1, 0, -1, 0, 1, 0, 0, 0, 1);
+        SF_TEST_CHECK(!sfHitMask_intersects(wide, rects[i], &transform, dot, (sfIntRect){0, 0, 1, 1}, &dotTransform));
+        // The same from the other mask
+        SF_TEST_CHECK(!sfHitMask_intersects(dot, (sfIntRect){0, 0, 1, 1}, &dotTransform, wide, rects[i], &transform));
+    }
+    sfHitMask_destroy(wide);
+    sfHitMask_destroy(dot);
+}
+
+////////////////////////////////////////////////////////////
+/// The word path, and the per-pixel path taken by a mirrored
+/// copy of the same placement, agree with a brute force test
+////////////////////////////////////////////////////////////
+static void sfHitMaskTest_intersects(void)
+{
+    sfHitMask *hitMaskA = sfHitMaskTest_createRandom(150, 3, 7);
+    sfHitMask *hitMaskB = sfHitMaskTest_createRandom(70, 3, 11);
+    sfIntRect rectA = {3, 0, 140, 3};
+    sfIntRect rectB = {5, 1, 61, 2};
+    sfIntRect mirroredB = {rectB.left + rectB.width, rectB.top, -rectB.width, rectB.height};
+    sfTransform transformA = sfTransform_fromMatrix(1, 0, 0, 0, 1, 0, 0, 0, 1);
+    sfTransform transformB;
+    sfBool expected = sfFalse;
+    size_t hits = 0;
+    size_t misses = 0;
+
+    if (!SF_TEST_CHECK(hitMaskA != NULL && hitMaskB != NULL))
+        return;
+    for (int y = -2; y <= 3; y++) {
+        for (int x = -62; x <= 141; x++) {
+            expected = sfHitMaskTest_bruteForce(hitMaskA, rectA, (sfVector2i){0, 0}, hitMaskB, rectB, (sfVector2i){x, y});
+            hits += expected;
+            misses += !expected;
+            transformB = sfTransform_fromMatrix(1, 0, x, 0, 1, y, 0, 0, 1);
+            if (!SF_TEST_CHECK(sfHitMask_intersects(hitMaskA, rectA, &transformA, hitMaskB, rectB, &transformB) == expected))
+                break;
+            transformB = sfTransform_fromMatrix(-1, 0, x + rectB.width, 0, 1, y, 0, 0, 1);
+            if (!SF_TEST_CHECK(sfHitMask_intersects(hitMaskA, rectA, &transformA, hitMaskB, mirroredB, &transformB) == expected))
+                break;
+        }
+    }
+    SF_TEST_CHECK(hits > 0 && misses > 0);
+    sfHitMask_destroy(hitMaskA);
+    sfHitMask_destroy(hitMaskB);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("hitMask.containsLocalPoint", sfHitMaskTest_containsLocalPoint);
+    sfTest_run("hitMask.wordEdges", sfHitMaskTest_wordEdges);
+    sfTest_run("hitMask.intersects", sfHitMaskTest_intersects);
+    return (sfTest_finish());
+}
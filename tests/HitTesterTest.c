@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/HitTester.h>
+#include <SFML/Addition/Mouse.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Sprite covering a 10x10 square of the scene
+////////////////////////////////////////////////////////////
+static sfSprite *sfHitTesterTest_createSprite(float x, float y)
+{
+    sfSprite *sprite = sfSprite_create();
+
+    sfSprite_setTextureRect(sprite, (sfIntRect){0, 0, 10, 10});
+    sfSprite_setPosition(sprite, (sfVector2f){x, y});
+    return (sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Entries added last are on top, past the initial capacity
+/// too, and moved or cleared entries stop being hit
+////////////////////////////////////////////////////////////
+static void sfHitTesterTest_zOrder(void)
+{
+    sfHitTester *hitTester = sfHitTester_create(2);
+    sfSprite *sprites[3] = {sfHitTesterTest_createSprite(0, 0), sfHitTesterTest_createSprite(5, 5), sfHitTesterTest_createSprite(8, 8)};
+    sfUint8 results[3] = {0};
+
+    if (!SF_TEST_CHECK(hitTester != NULL))
+        return;
+    for (size_t i = 0; i < 3; i++)
+        SF_TEST_CHECK(sfHitTester_addSprite(hitTester, sprites[i]) == i);
+    SF_TEST_CHECK(sfHitTester_addSprite(hitTester, NULL) == (size_t)-1);
+    SF_TEST_CHECK(sfHitTester_testPoint(hitTester, (sfVector2f){9, 9}, results) == 3);
+    SF_TEST_CHECK(results[0] && results[1] && results[2]);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){9, 9}) == 2);
+    SF_TEST_CHECK(sfHitTester_testPoint(hitTester, (sfVector2f){6, 6}, results) == 2);
+    SF_TEST_CHECK(results[0] && results[1] && !results[2]);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){6, 6}) == 1);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){2, 2}) == 0);
+    // Bounds are half open, like sfFloatRect_contains
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){18, 18}) == (size_t)-1);
+    SF_TEST_CHECK(sfHitTester_testPoint(hitTester, (sfVector2f){20, 20}, results) == 0);
+    // The top entry moved away
+    sfSprite_setPosition(sprites[2], (sfVector2f){100, 100});
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){9, 9}) == 2);
+    sfHitTester_setSprite(hitTester, 2, sprites[2]);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){9, 9}) == 1);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){105, 105}) == 2);
+    // Removed by rebuilding the batch without it
+    sfHitTester_clear(hitTester);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){9, 9}) == (size_t)-1);
+    SF_TEST_CHECK(sfHitTester_testPoint(hitTester, (sfVector2f){9, 9}, results) == 0);
+    sfHitTester_addSprite(hitTester, sprites[0]);
+    sfHitTester_addSprite(hitTester, sprites[2]);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){9, 9}) == 0);
+    SF_TEST_CHECK(sfHitTester_findTop(hitTester, (sfVector2f){105, 105}) == 1);
+    sfHitTester_destroy(hitTester);
+    for (size_t i = 0; i < 3; i++)
+        sfSprite_destroy(sprites[i]);
+}
+
+////////////////////////////////////////////////////////////
+/// A rotated sprite is only hit inside its oriented bounds,
+/// not in the corners of its global bounds
+////////////////////////////////////////////////////////////
+static void sfHitTesterTest_orientedBounds(void)
+{
+    sfHitTester *hitTester = sfHitTester_create(0);
+    sfSprite *sprite = sfSprite_create();
+    sfAnimatedSprite *animatedSprite = sfAnimatedSprite_create();
+    sfTexture *texture = sfTexture_create(20, 10);
+    sfFloatRect bounds;
+    static const sfVector2f hits[] = {{50, 50}, {56.8f, 56.8f}, {43.2f, 43.2f}, {51.5f, 48.5f}};
+    static const sfVector2f misses[] = {{60, 40}, {40, 60}, {57.8f, 57.8f}, {54, 46}};
+
+    if (!SF_TEST_CHECK(hitTester != NULL))
+        return;
+    // 20x10 centered on (50, 50), its long side along the diagonal
+    sfSprite_setTextureRect(sprite, (sfIntRect){0, 0, 20, 10});
+    sfSprite_setOrigin(sprite, (sfVector2f){10, 5});
+    sfSprite_setPosition(sprite, (sfVector2f){50, 50});
+    sfSprite_setRotation(sprite, 45);
+    sfAnimatedSprite_setTexture(animatedSprite, texture, sfTrue);
+    sfAnimatedSprite_setOrigin(animatedSprite, (sfVector2f){10, 5});
+    sfAnimatedSprite_setPosition(animatedSprite, (sfVector2f){50, 50});
+    sfAnimatedSprite_setRotation(animatedSprite, 45);
+    sfHitTester_addSprite(hitTester, sprite);
+    bounds = sfSprite_getGlobalBounds(sprite);
+    for (size_t i = 0; i < sizeof(hits) / sizeof(*hits); i++)
+        SF_TEST_CHECK(sfHitTester_findTop(hitTester, hits[i]) == 0);
+    for (size_t i = 0; i < sizeof(misses) / sizeof(*misses); i++) {
+        SF_TEST_CHECK(sfFloatRect_contains(&bounds, misses[i].x, misses[i].y));
+        SF_TEST_CHECK(sfHitTester_findTop(hitTester, misses[i]) == (size_t)-1);
+    }
+    sfHitTester_clear(hitTester);
+    sfHitTester_addAnimatedSprite(hitTester, animatedSprite);
+    for (size_t i = 0; i < sizeof(hits) / sizeof(*hits); i++)
+        SF_TEST_CHECK(sfHitTester_findTop(hitTester, hits[i]) == 0);
+    for (size_t i = 0; i < sizeof(misses) / sizeof(*misses); i++)
+        SF_TEST_CHECK(sfHitTester_findTop(hitTester, misses[i]) == (size_t)-1);
+    sfHitTester_destroy(hitTester);
+    sfAnimatedSprite_destroy(animatedSprite);
+    sfTexture_destroy(texture);
+    sfSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Points in the notches of concave polygons are outside
+////////////////////////////////////////////////////////////
+static void sfHitTesterTest_concavePolygon(void)
+{
+    // A U open at the bottom, and an arrow pointing right
+    static const sfVector2f u[] = {{0, 0}, {30, 0}, {30, 30}, {20, 30}, {20, 10}, {10, 10}, {10, 30}, {0, 30}};
+    static const sfVector2f arrow[] = {{0, 0}, {20, 10}, {0, 20}, {8, 10}};
+
+    SF_TEST_CHECK(sfPolygon_contains(u, 8, (sfVector2f){5, 20}));
+    SF_TEST_CHECK(sfPolygon_contains(u, 8, (sfVector2f){25, 20}));
+    SF_TEST_CHECK(sfPolygon_contains(u, 8, (sfVector2f){15, 5}));
+    SF_TEST_CHECK(sfPolygon_contains(u, 8, (sfVector2f){25, 10}));
+    SF_TEST_CHECK(!sfPolygon_contains(u, 8, (sfVector2f){15, 20}));
+    SF_TEST_CHECK(!sfPolygon_contains(u, 8, (sfVector2f){15, 29}));
+    SF_TEST_CHECK(!sfPolygon_contains(u, 8, (sfVector2f){35, 5}));
+    SF_TEST_CHECK(!sfPolygon_contains(u, 8, (sfVector2f){-5, 20}));
+    SF_TEST_CHECK(sfPolygon_contains(arrow, 4, (sfVector2f){12, 10}));
+    SF_TEST_CHECK(sfPolygon_contains(arrow, 4, (sfVector2f){3, 3}));
+    SF_TEST_CHECK(!sfPolygon_contains(arrow, 4, (sfVector2f){4, 10}));
+    SF_TEST_CHECK(!sfPolygon_contains(arrow, 4, (sfVector2f){18, 3}));
+    // Fewer than three points have no inside
+    SF_TEST_CHECK(!sfPolygon_contains(arrow, 2, (sfVector2f){5, 3}));
+    SF_TEST_CHECK(!sfPolygon_contains(NULL, 4, (sfVector2f){12, 10}));
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("hitTester.zOrder", sfHitTesterTest_zOrder);
+    sfTest_run("hitTester.orientedBounds", sfHitTesterTest_orientedBounds);
+    sfTest_run("hitTester.concavePolygon", sfHitTesterTest_concavePolygon);
+    return (sfTest_finish());
+}
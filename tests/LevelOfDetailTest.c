@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/LevelOfDetail.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Straight curve whose bounds are a square of the given side
+////////////////////////////////////////////////////////////
+static sfBezierCurve *sfLevelOfDetailTest_createCurve(float side)
+{
+    sfBezierCurve *curve = sfBezierCurve_create();
+
+    if (curve == NULL)
+        return (NULL);
+    sfBezierCurve_addPoint(curve, (sfVector2f){0, 0});
+    sfBezierCurve_addPoint(curve, (sfVector2f){side, side});
+    return (curve);
+}
+
+////////////////////////////////////////////////////////////
+/// Levels change strictly below each threshold
+////////////////////////////////////////////////////////////
+static void sfLevelOfDetailTest_select(void)
+{
+    sfLevelOfDetail lod = sfLevelOfDetail_getDefault();
+    static const float sizes[] = {1000, 128, 127.9f, 48, 47.9f, 16, 15.9f, 0, -1};
+    static const size_t levels[] = {0, 0, 1, 1, 2, 2, 3, 3, 3};
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++)
+        SF_TEST_CHECK(sfLevelOfDetail_select(&lod, sizes[i]) == levels[i]);
+    // Equal thresholds skip a level, zero ones are never crossed
+    lod.thresholds[0] = 64;
+    lod.thresholds[1] = 64;
+    lod.thresholds[2] = 0;
+    SF_TEST_CHECK(sfLevelOfDetail_select(&lod, 64) == 0);
+    SF_TEST_CHECK(sfLevelOfDetail_select(&lod, 63) == 2);
+    SF_TEST_CHECK(sfLevelOfDetail_select(&lod, 0) == 2);
+    SF_TEST_CHECK(sfLevelOfDetail_select(NULL, 0) == 0);
+}
+
+////////////////////////////////////////////////////////////
+/// Each draw counts at the level of its size on screen, after
+/// the render states and the view
+////////////////////////////////////////////////////////////
+static void sfLevelOfDetailTest_counts(void)
+{
+    sfRenderWindow *window = sfRenderWindow_create((sfVideoMode){400, 400, 32}, "lod", 0, NULL);
+    sfTexture *texture = sfTexture_create(64, 64);
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfLevelOfDetail lod = sfLevelOfDetail_getDefault();
+    sfRenderStates states = {sfBlendAlpha, sfTransform_Identity, NULL, NULL};
+    sfView *view = sfView_createFromRect((sfFloatRect){0, 0, 800, 800});
+    static const float sides[] = {200, 100, 20, 10, 130, 50};
+    static const float scales[] = {10, 4, 2, 0.5f};
+    sfBezierCurve *curves[6];
+
+    if (!SF_TEST_CHECK(window != NULL && texture != NULL && sprite != NULL && view != NULL))
+        return;
+    for (size_t i = 0; i < 6; i++)
+        curves[i] = sfLevelOfDetailTest_createCurve(sides[i]);
+    for (size_t i = 0; i < 6; i++)
+        sfRenderWindow_drawBezierCurveLod(window, curves[i], &lod, NULL);
+    SF_TEST_CHECK(lod.counts[0] == 2 && lod.counts[1] == 2 && lod.counts[2] == 1 && lod.counts[3] == 1);
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprite, (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprite, (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_seek(sprite, sfMicroseconds(0));
+    for (size_t i = 0; i < 4; i++) {
+        sfAnimatedSprite_setScale(sprite, (sfVector2f){scales[i], scales[i]});
+        sfRenderWindow_drawAnimatedSpriteLod(window, sprite, &lod, NULL);
+    }
+    SF_TEST_CHECK(lod.counts[0] == 3 && lod.counts[1] == 3 && lod.counts[2] == 2 && lod.counts[3] == 2);
+    sfLevelOfDetail_resetCounts(&lod);
+    SF_TEST_CHECK(lod.counts[0] == 0 && lod.counts[1] == 0 && lod.counts[2] == 0 && lod.counts[3] == 0);
+    // Twice the size through the render states, then half the size through the view
+    sfTransform_scale(&states.transform, 2, 2);
+    sfRenderWindow_drawBezierCurveLod(window, curves[1], &lod, &states);
+    sfRenderWindow_drawBezierCurveLod(window, curves[3], &lod, &states);
+    SF_TEST_CHECK(lod.counts[0] == 1 && lod.counts[2] == 1);
+    sfLevelOfDetail_resetCounts(&lod);
+    sfRenderWindow_setView(window, view);
+    sfRenderWindow_drawBezierCurveLod(window, curves[0], &lod, NULL);
+    sfRenderWindow_drawBezierCurveLod(window, curves[2], &lod, NULL);
+    sfAnimatedSprite_setScale(sprite, (sfVector2f){10, 10});
+    sfRenderWindow_drawAnimatedSpriteLod(window, sprite, &lod, NULL);
+    SF_TEST_CHECK(lod.counts[0] == 0 && lod.counts[1] == 2 && lod.counts[3] == 1);
+    for (size_t i = 0; i < 6; i++)
+        sfBezierCurve_destroy(curves[i]);
+    sfAnimatedSprite_destroy(sprite);
+    sfView_destroy(view);
+    sfTexture_destroy(texture);
+    sfRenderWindow_destroy(window);
+}
+
+////////////////////////////////////////////////////////////
+/// Each reduced sheet averages blocks of 2 x 2 pixels of the
+/// previous one, rounding to the nearest value
+////////////////////////////////////////////////////////////
+static void sfLevelOfDetailTest_lodTextures(void)
+{
+    sfImage *image = sfImage_createFromColor(8, 6, sfTransparent);
+    sfTexture *texture = NULL;
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfImage *reduced = NULL;
+    sfColor pixel;
+
+    for (unsigned int y = 0; y < 6; y++) {
+        for (unsigned int x = 0; x < 8; x++)
+            sfImage_setPixel(image, x, y, sfColor_fromRGBA((sfUint8)(x * 30 + y), (sfUint8)(y * 40), (x + y) % 2 ? 255 : 0, 255));
+    }
+    texture = sfTexture_createFromImage(image, NULL);
+    if (!SF_TEST_CHECK(texture != NULL && sprite != NULL))
+        return;
+    SF_TEST_CHECK(!sfAnimatedSprite_createLodTextures(sprite, 2));
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    SF_TEST_CHECK(sfAnimatedSprite_createLodTextures(sprite, 2));
+    SF_TEST_CHECK(sfAnimatedSprite_getLodTexture(sprite, 0) == texture);
+    SF_TEST_CHECK(sfTexture_getSize(sfAnimatedSprite_getLodTexture(sprite, 1)).x == 4);
+    SF_TEST_CHECK(sfTexture_getSize(sfAnimatedSprite_getLodTexture(sprite, 1)).y == 3);
+    SF_TEST_CHECK(sfTexture_getSize(sfAnimatedSprite_getLodTexture(sprite, 2)).x == 2);
+    SF_TEST_CHECK(sfTexture_getSize(sfAnimatedSprite_getLodTexture(sprite, 2)).y == 1);
+    // Levels past the last one built fall back to it
+    SF_TEST_CHECK(sfAnimatedSprite_getLodTexture(sprite, 3) == sfAnimatedSprite_getLodTexture(sprite, 2));
+    reduced = sfTexture_copyToImage(sfAnimatedSprite_getLodTexture(sprite, 1));
+    for (unsigned int y = 0; y < 3; y++) {
+        for (unsigned int x = 0; x < 4; x++) {
+            pixel = sfImage_getPixel(reduced, x, y);
+            // A block holds the reds r, r + 1, r + 30 and r + 31, the greens g and g + 40 twice
+            SF_TEST_CHECK(pixel.r == 60 * x + 2 * y + 16 && pixel.g == 80 * y + 20);
+            SF_TEST_CHECK(pixel.b == 128 && pixel.a == 255);
+        }
+    }
+    sfImage_destroy(reduced);
+    reduced = sfTexture_copyToImage(sfAnimatedSprite_getLodTexture(sprite, 2));
+    pixel = sfImage_getPixel(reduced, 1, 0);
+    SF_TEST_CHECK(pixel.r == 167 && pixel.g == 60 && pixel.b == 128);
+    sfImage_destroy(reduced);
+    // Building again replaces the sheets
+    SF_TEST_CHECK(sfAnimatedSprite_createLodTextures(sprite, 1));
+    SF_TEST_CHECK(sfAnimatedSprite_getLodTexture(sprite, 2) == sfAnimatedSprite_getLodTexture(sprite, 1));
+    SF_TEST_CHECK(sfAnimatedSprite_createLodTextures(sprite, 0));
+    SF_TEST_CHECK(sfAnimatedSprite_getLodTexture(sprite, 1) == texture);
+    sfAnimatedSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+    sfImage_destroy(image);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("levelOfDetail.select", sfLevelOfDetailTest_select);
+    sfTest_run("levelOfDetail.counts", sfLevelOfDetailTest_counts);
+    sfTest_run("levelOfDetail.lodTextures", sfLevelOfDetailTest_lodTextures);
+    return (sfTest_finish());
+}
@@ -0,0 +1,324 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Addition/MouseDispatcher.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Count the clicks received by a target
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_onEvent(const sfMouseTargetEvent *event, void *userData)
+{
+    if (event->type == sfMouseTargetClick)
+        (*(int *)userData)++;
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_click(sfMouseDispatcher *dispatcher, int x, int y)
+{
+    sfEvent event = {0};
+
+    event.mouseButton.type = sfEvtMouseButtonPressed;
+    event.mouseButton.button = sfMouseLeft;
+    event.mouseButton.x = x;
+    event.mouseButton.y = y;
+    sfMouseDispatcher_handleEvent(dispatcher, &event);
+    event.mouseButton.type = sfEvtMouseButtonReleased;
+    sfMouseDispatcher_handleEvent(dispatcher, &event);
+}
+
+////////////////////////////////////////////////////////////
+/// Events received by every target, in order
+////////////////////////////////////////////////////////////
+#define SF_MOUSEDISPATCHERTEST_EVENTS 32
+
+typedef struct
+{
+    int target;
+    sfMouseTargetEvent event;
+} sfMouseDispatcherTestEntry;
+
+static sfMouseDispatcherTestEntry sfMouseDispatcherTest_log[SF_MOUSEDISPATCHERTEST_EVENTS];
+static size_t sfMouseDispatcherTest_logCount = 0;
+
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_onRecord(const sfMouseTargetEvent *event, void *userData)
+{
+    if (sfMouseDispatcherTest_logCount < SF_MOUSEDISPATCHERTEST_EVENTS)
+        sfMouseDispatcherTest_log[sfMouseDispatcherTest_logCount++] = (sfMouseDispatcherTestEntry){*(int *)userData, *event};
+}
+
+////////////////////////////////////////////////////////////
+/// Check the next event of the log and consume it
+////////////////////////////////////////////////////////////
+static sfBool sfMouseDispatcherTest_expect(size_t *next, int target, sfMouseTargetEventType type, sfMouseButton button)
+{
+    if (!SF_TEST_CHECK(*next < sfMouseDispatcherTest_logCount))
+        return (sfFalse);
+    (*next)++;
+    return (SF_TEST_CHECK(sfMouseDispatcherTest_log[*next - 1].target == target) &&
+        SF_TEST_CHECK(sfMouseDispatcherTest_log[*next - 1].event.type == type) &&
+        SF_TEST_CHECK(sfMouseDispatcherTest_log[*next - 1].event.button == button));
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_move(sfMouseDispatcher *dispatcher, int x, int y)
+{
+    sfEvent event = {0};
+
+    event.mouseMove.type = sfEvtMouseMoved;
+    event.mouseMove.x = x;
+    event.mouseMove.y = y;
+    SF_TEST_CHECK(sfMouseDispatcher_handleEvent(dispatcher, &event));
+}
+
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_button(sfMouseDispatcher *dispatcher, sfEventType type, sfMouseButton button, int x, int y)
+{
+    sfEvent event = {0};
+
+    event.mouseButton.type = type;
+    event.mouseButton.button = button;
+    event.mouseButton.x = x;
+    event.mouseButton.y = y;
+    SF_TEST_CHECK(sfMouseDispatcher_handleEvent(dispatcher, &event));
+}
+
+////////////////////////////////////////////////////////////
+/// Sprite covering a 10x10 square of the window
+////////////////////////////////////////////////////////////
+static sfSprite *sfMouseDispatcherTest_createSprite(float x, float y)
+{
+    sfSprite *sprite = sfSprite_create();
+
+    sfSprite_setTextureRect(sprite, (sfIntRect){0, 0, 10, 10});
+    sfSprite_setPosition(sprite, (sfVector2f){x, y});
+    return (sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Enter, press, drag out, release outside then a click, with
+/// the positions and deltas of the events
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_sequence(void)
+{
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    sfSprite *sprite = sfMouseDispatcherTest_createSprite(0, 0);
+    int name = 1;
+    size_t next = 0;
+
+    if (!SF_TEST_CHECK(dispatcher != NULL))
+        return;
+    sfMouseDispatcherTest_logCount = 0;
+    sfMouseDispatcher_addSprite(dispatcher, sprite, sfMouseDispatcherTest_onRecord, &name);
+    sfMouseDispatcherTest_move(dispatcher, 20, 20);
+    SF_TEST_CHECK(sfMouseDispatcherTest_logCount == 0);
+    sfMouseDispatcherTest_move(dispatcher, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    SF_TEST_CHECK(dispatcher->targets[0].hovered);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseRight, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetPress, sfMouseRight);
+    sfMouseDispatcherTest_move(dispatcher, 8, 6);
+    if (sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetDrag, sfMouseRight)) {
+        SF_TEST_CHECK(sfMouseDispatcherTest_log[next - 1].event.delta.x == 3 && sfMouseDispatcherTest_log[next - 1].event.delta.y == 1);
+        SF_TEST_CHECK(sfMouseDispatcherTest_log[next - 1].event.position.x == 8 && sfMouseDispatcherTest_log[next - 1].event.position.y == 6);
+    }
+    // The drag goes on outside the target, after its leave event
+    sfMouseDispatcherTest_move(dispatcher, 30, 16);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetLeave, sfMouseButtonCount);
+    if (sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetDrag, sfMouseRight))
+        SF_TEST_CHECK(sfMouseDispatcherTest_log[next - 1].event.delta.x == 22 && sfMouseDispatcherTest_log[next - 1].event.delta.y == 10);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonReleased, sfMouseRight, 30, 16);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetRelease, sfMouseRight);
+    // Released over the target it was pressed on
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseLeft, 2, 3);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetPress, sfMouseLeft);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonReleased, sfMouseLeft, 2, 3);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetRelease, sfMouseLeft);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetClick, sfMouseLeft);
+    sfMouseDispatcherTest_move(dispatcher, 40, 40);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetLeave, sfMouseButtonCount);
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// The mouse leaving the window clears the hover of every
+/// target, it enters again at the same position
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_mouseLeft(void)
+{
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    sfSprite *sprite = sfMouseDispatcherTest_createSprite(0, 0);
+    sfEvent event = {0};
+    int name = 1;
+    size_t next = 0;
+
+    if (!SF_TEST_CHECK(dispatcher != NULL))
+        return;
+    sfMouseDispatcherTest_logCount = 0;
+    sfMouseDispatcher_addSprite(dispatcher, sprite, sfMouseDispatcherTest_onRecord, &name);
+    sfMouseDispatcherTest_move(dispatcher, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    event.type = sfEvtMouseLeft;
+    SF_TEST_CHECK(sfMouseDispatcher_handleEvent(dispatcher, &event));
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetLeave, sfMouseButtonCount);
+    SF_TEST_CHECK(!dispatcher->inside && !dispatcher->targets[0].hovered);
+    SF_TEST_CHECK(sfMouseDispatcher_handleEvent(dispatcher, &event));
+    sfMouseDispatcher_update(dispatcher);
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    sfMouseDispatcherTest_move(dispatcher, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    event.type = sfEvtKeyPressed;
+    SF_TEST_CHECK(!sfMouseDispatcher_handleEvent(dispatcher, &event));
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Every target under the mouse is hovered, the last added
+/// one receives the buttons
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_topmost(void)
+{
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    sfSprite *bottom = sfMouseDispatcherTest_createSprite(0, 0);
+    sfSprite *top = sfMouseDispatcherTest_createSprite(5, 5);
+    sfMouseTargetId topId = SF_MOUSETARGETID_INVALID;
+    int names[2] = {1, 2};
+    size_t next = 0;
+
+    if (!SF_TEST_CHECK(dispatcher != NULL))
+        return;
+    sfMouseDispatcherTest_logCount = 0;
+    sfMouseDispatcher_addSprite(dispatcher, bottom, sfMouseDispatcherTest_onRecord, &names[0]);
+    topId = sfMouseDispatcher_addSprite(dispatcher, top, sfMouseDispatcherTest_onRecord, &names[1]);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseLeft, 7, 7);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    sfMouseDispatcherTest_expect(&next, 2, sfMouseTargetEnter, sfMouseButtonCount);
+    sfMouseDispatcherTest_expect(&next, 2, sfMouseTargetPress, sfMouseLeft);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonReleased, sfMouseLeft, 7, 7);
+    sfMouseDispatcherTest_expect(&next, 2, sfMouseTargetRelease, sfMouseLeft);
+    sfMouseDispatcherTest_expect(&next, 2, sfMouseTargetClick, sfMouseLeft);
+    // Only the bottom target is under (2, 2)
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseLeft, 2, 2);
+    sfMouseDispatcherTest_expect(&next, 2, sfMouseTargetLeave, sfMouseButtonCount);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetPress, sfMouseLeft);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonReleased, sfMouseLeft, 2, 2);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetRelease, sfMouseLeft);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetClick, sfMouseLeft);
+    // Without the top target the bottom one gets the buttons
+    SF_TEST_CHECK(sfMouseDispatcher_remove(dispatcher, topId));
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseLeft, 7, 7);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetPress, sfMouseLeft);
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfSprite_destroy(bottom);
+    sfSprite_destroy(top);
+}
+
+////////////////////////////////////////////////////////////
+/// A move to the same position tests nothing, targets moved
+/// under a still mouse are only seen by sfMouseDispatcher_update
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_stillMouse(void)
+{
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    sfSprite *sprite = sfMouseDispatcherTest_createSprite(0, 0);
+    int name = 1;
+    size_t next = 0;
+
+    if (!SF_TEST_CHECK(dispatcher != NULL))
+        return;
+    sfMouseDispatcherTest_logCount = 0;
+    sfMouseDispatcher_addSprite(dispatcher, sprite, sfMouseDispatcherTest_onRecord, &name);
+    sfMouseDispatcherTest_move(dispatcher, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetEnter, sfMouseButtonCount);
+    sfMouseDispatcherTest_button(dispatcher, sfEvtMouseButtonPressed, sfMouseLeft, 5, 5);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetPress, sfMouseLeft);
+    sfSprite_setPosition(sprite, (sfVector2f){50, 50});
+    // No drag without a delta, no leave without a hit test
+    sfMouseDispatcherTest_move(dispatcher, 5, 5);
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    SF_TEST_CHECK(dispatcher->targets[0].hovered);
+    sfMouseDispatcher_update(dispatcher);
+    sfMouseDispatcherTest_expect(&next, 1, sfMouseTargetLeave, sfMouseButtonCount);
+    SF_TEST_CHECK(next == sfMouseDispatcherTest_logCount);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfSprite_destroy(sprite);
+}
+
+////////////////////////////////////////////////////////////
+/// Identifiers of removed targets do not alias the targets reusing their slot
+////////////////////////////////////////////////////////////
+static void sfMouseDispatcherTest_staleIdentifiers(void)
+{
+    sfMouseDispatcher *dispatcher = sfMouseDispatcher_create();
+    sfSprite *first = sfSprite_create();
+    sfSprite *second = sfSprite_create();
+    sfMouseTargetId firstId = SF_MOUSETARGETID_INVALID;
+    sfMouseTargetId secondId = SF_MOUSETARGETID_INVALID;
+    int firstClicks = 0;
+    int secondClicks = 0;
+
+    if (!SF_TEST_CHECK(dispatcher != NULL))
+        return;
+    sfSprite_setTextureRect(first, (sfIntRect){0, 0, 10, 10});
+    sfSprite_setTextureRect(second, (sfIntRect){0, 0, 10, 10});
+    SF_TEST_CHECK(!sfMouseDispatcher_remove(dispatcher, SF_MOUSETARGETID_INVALID));
+    firstId = sfMouseDispatcher_addSprite(dispatcher, first, sfMouseDispatcherTest_onEvent, &firstClicks);
+    SF_TEST_CHECK(firstId != SF_MOUSETARGETID_INVALID);
+    sfMouseDispatcherTest_click(dispatcher, 5, 5);
+    SF_TEST_CHECK(firstClicks == 1);
+    SF_TEST_CHECK(sfMouseDispatcher_remove(dispatcher, firstId));
+    secondId = sfMouseDispatcher_addSprite(dispatcher, second, sfMouseDispatcherTest_onEvent, &secondClicks);
+    SF_TEST_CHECK(secondId != SF_MOUSETARGETID_INVALID && secondId != firstId);
+    SF_TEST_CHECK(!sfMouseDispatcher_remove(dispatcher, firstId));
+    sfMouseDispatcherTest_click(dispatcher, 5, 5);
+    SF_TEST_CHECK(firstClicks == 1);
+    SF_TEST_CHECK(secondClicks == 1);
+    SF_TEST_CHECK(sfMouseDispatcher_remove(dispatcher, secondId));
+    sfMouseDispatcherTest_click(dispatcher, 5, 5);
+    SF_TEST_CHECK(secondClicks == 1);
+    sfMouseDispatcher_destroy(dispatcher);
+    sfSprite_destroy(first);
+    sfSprite_destroy(second);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("mouseDispatcher.staleIdentifiers", sfMouseDispatcherTest_staleIdentifiers);
+    sfTest_run("mouseDispatcher.sequence", sfMouseDispatcherTest_sequence);
+    sfTest_run("mouseDispatcher.mouseLeft", sfMouseDispatcherTest_mouseLeft);
+    sfTest_run("mouseDispatcher.topmost", sfMouseDispatcherTest_topmost);
+    sfTest_run("mouseDispatcher.stillMouse", sfMouseDispatcherTest_stillMouse);
+    return (sfTest_finish());
+}
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <SFML/Addition/AnimatedSprite.h>
+#include <SFML/Addition/BezierCurve.h>
+#include <SFML/Addition/HitTester.h>
+#include <SFML/Addition/Profiler.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Written next to the test and removed once checked
+////////////////////////////////////////////////////////////
+#define SF_PROFILERTEST_TRACE "profiler-test-trace.json"
+
+////////////////////////////////////////////////////////////
+static sfBezierCurve *sfProfilerTest_createCurve(void)
+{
+    sfBezierCurve *curve = sfBezierCurve_create();
+
+    for (size_t i = 0; i < 4; i++)
+        sfBezierCurve_addPoint(curve, (sfVector2f){i * 20.f, (i % 2) * 60.f});
+    return (curve);
+}
+
+////////////////////////////////////////////////////////////
+/// Every counter follows the calls made since the last reset
+////////////////////////////////////////////////////////////
+static void sfProfilerTest_counters(void)
+{
+    sfRenderWindow *window = sfRenderWindow_create((sfVideoMode){160, 120, 32}, "test", 0, NULL);
+    sfBezierCurve *curve = sfProfilerTest_createCurve();
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfTexture *texture = sfTexture_create(64, 64);
+    sfHitTester *hitTester = sfHitTester_create(4);
+    sfUint8 hits[3];
+    sfProfilerStats stats;
+
+    if (!SF_TEST_CHECK(window != NULL))
+        return;
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprite, (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprite, (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_setFrameRate(sprite, 10);
+    sfAnimatedSprite_setFixedStep(sprite, sfMilliseconds(100));
+    for (size_t i = 0; i < 3; i++)
+        sfHitTester_addAnimatedSprite(hitTester, sprite);
+    sfRenderWindow_drawBezierCurve(window, curve, NULL);
+    sfProfiler_resetStats();
+    stats = sfProfiler_getStats();
+    SF_TEST_CHECK(stats.curveDraws == 0 && stats.curveSamples == 0 && stats.curveDrawTime == 0);
+    for (size_t i = 0; i < 5; i++)
+        sfRenderWindow_drawBezierCurve(window, curve, NULL);
+    for (size_t i = 0; i < 4; i++)
+        sfRenderWindow_drawAnimatedSprite(window, sprite, NULL);
+    sfHitTester_testPoint(hitTester, (sfVector2f){8, 8}, hits);
+    sfHitTester_findTop(hitTester, (sfVector2f){100, 100});
+    stats = sfProfiler_getStats();
+    SF_TEST_CHECK(stats.curveDraws == 5);
+    SF_TEST_CHECK(stats.curveSamples > 0 && stats.curveSamples % 5 == 0);
+    SF_TEST_CHECK(stats.curveDrawTime >= 0);
+    SF_TEST_CHECK(stats.animatedSpriteDraws == 4);
+    SF_TEST_CHECK(stats.animatedSpriteUpdates == 4);
+    SF_TEST_CHECK(stats.textureRectChanges == 4);
+    SF_TEST_CHECK(stats.hitTests == 6);
+    sfProfiler_resetStats();
+    stats = sfProfiler_getStats();
+    SF_TEST_CHECK(stats.curveDraws == 0 && stats.animatedSpriteDraws == 0 && stats.hitTests == 0);
+    sfHitTester_destroy(hitTester);
+    sfAnimatedSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+    sfBezierCurve_destroy(curve);
+    sfRenderWindow_destroy(window);
+}
+
+////////////////////////////////////////////////////////////
+/// The trace keeps the first events up to its capacity
+////////////////////////////////////////////////////////////
+static void sfProfilerTest_trace(void)
+{
+    sfRenderWindow *window = sfRenderWindow_create((sfVideoMode){160, 120, 32}, "test", 0, NULL);
+    sfBezierCurve *curve = sfProfilerTest_createCurve();
+    char line[256];
+    FILE *file = NULL;
+    size_t events = 0;
+    sfBool named = sfTrue;
+
+    if (!SF_TEST_CHECK(window != NULL))
+        return;
+    SF_TEST_CHECK(sfProfiler_startTrace(4));
+    for (size_t i = 0; i < 6; i++)
+        sfRenderWindow_drawBezierCurve(window, curve, NULL);
+    sfProfiler_stopTrace();
+    sfRenderWindow_drawBezierCurve(window, curve, NULL);
+    SF_TEST_CHECK(sfProfiler_saveTrace(SF_PROFILERTEST_TRACE));
+    file = fopen(SF_PROFILERTEST_TRACE, "r");
+    if (!SF_TEST_CHECK(file != NULL))
+        return;
+    SF_TEST_CHECK(fgets(line, sizeof(line), file) != NULL && strncmp(line, "{\"traceEvents\":[", 16) == 0);
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (strstr(line, "\"ph\":\"X\"") == NULL)
+            continue;
+        events++;
+        named = named && strstr(line, "\"name\":\"drawBezierCurve\"") != NULL;
+    }
+    fclose(file);
+    remove(SF_PROFILERTEST_TRACE);
+    SF_TEST_CHECK(events == 4);
+    SF_TEST_CHECK(named);
+    sfBezierCurve_destroy(curve);
+    sfRenderWindow_destroy(window);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("profiler.counters", sfProfilerTest_counters);
+    sfTest_run("profiler.trace", sfProfilerTest_trace);
+    return (sfTest_finish());
+}
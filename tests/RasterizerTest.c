@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <SFML/Addition/Rasterizer.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+#define SF_RASTERIZERTEST_WIDTH 96
+#define SF_RASTERIZERTEST_HEIGHT 72
+
+////////////////////////////////////////////////////////////
+/// Largest difference of a channel with the reference, and
+/// share of pixels allowed above it, to absorb the rounding
+/// of compilers contracting float operations differently
+////////////////////////////////////////////////////////////
+#define SF_RASTERIZERTEST_TOLERANCE 2
+#define SF_RASTERIZERTEST_MAX_MISMATCH 0.005
+
+////////////////////////////////////////////////////////////
+/// Set by --update to rewrite the reference images
+////////////////////////////////////////////////////////////
+static sfBool sfRasterizerTest_update = sfFalse;
+
+////////////////////////////////////////////////////////////
+/// A trimmed frame and a trimmed, rotated one
+////////////////////////////////////////////////////////////
+static const char sfRasterizerTest_sheetData[] = "{\"frames\": {"
+    "\"walk_0.png\": {\"frame\": {\"x\":0,\"y\":0,\"w\":12,\"h\":14}, \"rotated\": false, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":2,\"y\":1,\"w\":12,\"h\":14}, \"sourceSize\": {\"w\":16,\"h\":16}, \"duration\": 100},"
+    "\"walk_1.png\": {\"frame\": {\"x\":16,\"y\":32,\"w\":14,\"h\":6}, \"rotated\": true, \"trimmed\": true,"
+    " \"spriteSourceSize\": {\"x\":1,\"y\":5,\"w\":14,\"h\":6}, \"sourceSize\": {\"w\":16,\"h\":16}, \"duration\": 100}},"
+    "\"meta\": {\"image\": \"sheet.png\", \"size\": {\"w\":64,\"h\":64},"
+    " \"frameTags\": [{\"name\":\"walk\",\"from\":0,\"to\":1,\"direction\":\"forward\"}]}}";
+
+////////////////////////////////////////////////////////////
+/// Texels telling their position apart, with transparent
+/// lines every 16 texels
+////////////////////////////////////////////////////////////
+static sfImage *sfRasterizerTest_createSheet(void)
+{
+    sfImage *sheet = sfImage_create(64, 64);
+
+    for (unsigned int y = 0; y < 64; y++) {
+        for (unsigned int x = 0; x < 64; x++) {
+            sfColor color = {x * 4, y * 4, ((x / 4 + y / 4) % 2) ? 255 : 64, 255};
+
+            if (x % 16 == 15 || y % 16 == 15)
+                color.a = 0;
+            sfImage_setPixel(sheet, x, y, color);
+        }
+    }
+    return (sheet);
+}
+
+////////////////////////////////////////////////////////////
+/// Read a reference image, a binary RGBA PAM file
+////////////////////////////////////////////////////////////
+static sfUint8 *sfRasterizerTest_readGolden(const char *filename, unsigned int width, unsigned int height)
+{
+    FILE *file = fopen(filename, "rb");
+    size_t size = (size_t)width * height * 4;
+    unsigned int fileWidth = 0;
+    unsigned int fileHeight = 0;
+    sfUint8 *pixels = NULL;
+
+    if (file == NULL)
+        return (NULL);
+    if (fscanf(file, "P7 WIDTH %u HEIGHT %u DEPTH 4 MAXVAL 255 TUPLTYPE RGB_ALPHA ENDHDR", &fileWidth, &fileHeight) != 2 ||
+        fgetc(file) != '\n' || fileWidth != width || fileHeight != height) {
+        fclose(file);
+        return (NULL);
+    }
+    pixels = malloc(size);
+    if (pixels != NULL && fread(pixels, 1, size, file) != size) {
+        free(pixels);
+        pixels = NULL;
+    }
+    fclose(file);
+    return (pixels);
+}
+
+////////////////////////////////////////////////////////////
+static void sfRasterizerTest_writeGolden(const char *filename, const sfImage *image)
+{
+    FILE *file = fopen(filename, "wb");
+    sfVector2u size = sfImage_getSize(image);
+
+    if (file == NULL)
+        return;
+    fprintf(file, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n", size.x, size.y);
+    fwrite(sfImage_getPixelsPtr(image), 1, (size_t)size.x * size.y * 4, file);
+    fclose(file);
+}
+
+////////////////////////////////////////////////////////////
+/// Compare an image with its reference, or rewrite it
+////////////////////////////////////////////////////////////
+static void sfRasterizerTest_compare(const sfImage *image, const char *filename)
+{
+    sfVector2u size = sfImage_getSize(image);
+    const sfUint8 *pixels = sfImage_getPixelsPtr(image);
+    sfUint8 *golden = NULL;
+    size_t mismatches = 0;
+
+    if (sfRasterizerTest_update) {
+        sfRasterizerTest_writeGolden(filename, image);
+        return;
+    }
+    golden = sfRasterizerTest_readGolden(filename, size.x, size.y);
+    if (!SF_TEST_CHECK(golden != NULL))
+        return;
+    for (size_t i = 0; i < (size_t)size.x * size.y; i++) {
+        for (size_t c = 0; c < 4; c++) {
+            if (abs(pixels[i * 4 + c] - golden[i * 4 + c]) > SF_RASTERIZERTEST_TOLERANCE) {
+                mismatches++;
+                break;
+            }
+        }
+    }
+    SF_TEST_CHECK(mismatches <= (size_t)(size.x * size.y * SF_RASTERIZERTEST_MAX_MISMATCH));
+    free(golden);
+}
+
+////////////////////////////////////////////////////////////
+/// A hairline, a thick translucent stroke and a transformed
+/// curve of 20 points
+////////////////////////////////////////////////////////////
+static void sfRasterizerTest_bezierCurves(void)
+{
+    sfImage *image = sfImage_createFromColor(SF_RASTERIZERTEST_WIDTH, SF_RASTERIZERTEST_HEIGHT, (sfColor){20, 20, 30, 255});
+    sfBezierCurve *curves[3] = {sfBezierCurve_create(), sfBezierCurve_create(), sfBezierCurve_create()};
+    sfTransform transform = sfTransform_Identity;
+
+    sfBezierCurve_setCurveColor(curves[0], (sfColor){255, 0, 0, 255});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){4, 60});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){30, 0});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){60, 80});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){92, 10});
+    sfBezierCurve_setCurveColor(curves[1], (sfColor){0, 200, 255, 160});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){10, 10});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){48, 70});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){86, 10});
+    sfBezierCurve_setCurveColor(curves[2], (sfColor){255, 220, 0, 255});
+    for (int i = 0; i < 20; i++)
+        sfBezierCurve_addPoint(curves[2], (sfVector2f){i * 5.f, (i % 2) * 40.f + 16});
+    sfTransform_translate(&transform, 48, 36);
+    sfTransform_rotate(&transform, 10);
+    sfTransform_scale(&transform, 0.8f, 0.8f);
+    sfTransform_translate(&transform, -48, -36);
+    sfImage_drawBezierCurve(image, curves[0], 1, NULL);
+    sfImage_drawBezierCurve(image, curves[1], 5, NULL);
+    sfImage_drawBezierCurve(image, curves[2], 2, &transform);
+    sfRasterizerTest_compare(image, "golden/bezierCurves.pam");
+    for (int i = 0; i < 3; i++)
+        sfBezierCurve_destroy(curves[i]);
+    sfImage_destroy(image);
+}
+
+////////////////////////////////////////////////////////////
+/// A grid frame turned and scaled, and the trimmed and the
+/// rotated frames of a sprite sheet
+////////////////////////////////////////////////////////////
+static void sfRasterizerTest_animatedSprites(void)
+{
+    sfImage *image = sfImage_createFromColor(SF_RASTERIZERTEST_WIDTH, SF_RASTERIZERTEST_HEIGHT, (sfColor){20, 20, 30, 255});
+    sfImage *sheet = sfRasterizerTest_createSheet();
+    sfTexture *texture = sfTexture_createFromImage(sheet, NULL);
+    sfSpriteSheet *spriteSheet = sfSpriteSheet_createFromMemory(sfRasterizerTest_sheetData, strlen(sfRasterizerTest_sheetData));
+    sfAnimatedSprite *sprites[3] = {sfAnimatedSprite_create(), sfAnimatedSprite_create(), sfAnimatedSprite_create()};
+
+    SF_TEST_CHECK(spriteSheet != NULL);
+    for (int i = 0; i < 3; i++)
+        sfAnimatedSprite_setTexture(sprites[i], texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprites[0], (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprites[0], (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprites[0], 16);
+    sfAnimatedSprite_setFrameRate(sprites[0], 10);
+    sfAnimatedSprite_seek(sprites[0], sfMilliseconds(350));
+    sfAnimatedSprite_setPosition(sprites[0], (sfVector2f){12, 4});
+    sfAnimatedSprite_setRotation(sprites[0], 15);
+    sfAnimatedSprite_setScale(sprites[0], (sfVector2f){2, 2});
+    sfAnimatedSprite_setSpriteSheet(sprites[1], spriteSheet, "walk");
+    sfAnimatedSprite_setPosition(sprites[1], (sfVector2f){56, 4});
+    sfAnimatedSprite_setScale(sprites[1], (sfVector2f){1.5f, 1.5f});
+    sfAnimatedSprite_setSpriteSheet(sprites[2], spriteSheet, "walk");
+    sfAnimatedSprite_seek(sprites[2], sfMilliseconds(150));
+    sfAnimatedSprite_setPosition(sprites[2], (sfVector2f){56, 36});
+    sfAnimatedSprite_setScale(sprites[2], (sfVector2f){2, 2});
+    for (int i = 0; i < 3; i++)
+        sfImage_drawAnimatedSprite(image, sprites[i], sheet);
+    sfRasterizerTest_compare(image, "golden/animatedSprites.pam");
+    for (int i = 0; i < 3; i++)
+        sfAnimatedSprite_destroy(sprites[i]);
+    sfSpriteSheet_destroy(spriteSheet);
+    sfTexture_destroy(texture);
+    sfImage_destroy(sheet);
+    sfImage_destroy(image);
+}
+
+////////////////////////////////////////////////////////////
+/// Draw curves and a sprite larger than the parallel area of
+/// the rasterizer into a new image
+////////////////////////////////////////////////////////////
+static sfImage *sfRasterizerTest_drawLarge(sfRasterizer *rasterizer, sfBezierCurve **curves, sfAnimatedSprite *sprite, const sfImage *sheet)
+{
+    sfImage *image = sfImage_createFromColor(400, 320, (sfColor){20, 20, 30, 255});
+
+    // Twice, so that the workers of the rasterizer run several draws
+    for (int i = 0; i < 2; i++) {
+        sfRasterizer_drawAnimatedSprite(rasterizer, image, sprite, sheet);
+        sfRasterizer_drawBezierCurve(rasterizer, image, curves[0], 1, NULL);
+        sfRasterizer_drawBezierCurve(rasterizer, image, curves[1], 9, NULL);
+    }
+    return (image);
+}
+
+////////////////////////////////////////////////////////////
+/// Draws above the parallel area give the same pixels on any
+/// number of threads and with any band height
+////////////////////////////////////////////////////////////
+static void sfRasterizerTest_threads(void)
+{
+    sfImage *sheet = sfRasterizerTest_createSheet();
+    sfTexture *texture = sfTexture_createFromImage(sheet, NULL);
+    sfAnimatedSprite *sprite = sfAnimatedSprite_create();
+    sfBezierCurve *curves[2] = {sfBezierCurve_create(), sfBezierCurve_create()};
+    sfImage *expected = NULL;
+    sfImage *image = NULL;
+    static const unsigned int threadCounts[] = {2, 4, 7};
+    static const unsigned int tileHeights[] = {32, 5, 1};
+    size_t covered = 0;
+
+    sfBezierCurve_setCurveColor(curves[0], (sfColor){255, 0, 0, 255});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){4, 300});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){120, -40});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){260, 400});
+    sfBezierCurve_addPoint(curves[0], (sfVector2f){396, 12});
+    sfBezierCurve_setCurveColor(curves[1], (sfColor){0, 200, 255, 160});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){20, 20});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){200, 340});
+    sfBezierCurve_addPoint(curves[1], (sfVector2f){380, 30});
+    sfAnimatedSprite_setTexture(sprite, texture, sfTrue);
+    sfAnimatedSprite_setGridSize(sprite, (sfVector2u){4, 4});
+    sfAnimatedSprite_setFrameSize(sprite, (sfVector2u){16, 16});
+    sfAnimatedSprite_setMaxFrame(sprite, 16);
+    sfAnimatedSprite_seek(sprite, sfMicroseconds(0));
+    sfAnimatedSprite_setPosition(sprite, (sfVector2f){130, -20});
+    sfAnimatedSprite_setRotation(sprite, 20);
+    sfAnimatedSprite_setScale(sprite, (sfVector2f){17, 17});
+    expected = sfRasterizerTest_drawLarge(NULL, curves, sprite, sheet);
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(*threadCounts); i++) {
+        sfRasterizer *rasterizer = sfRasterizer_create(threadCounts[i]);
+
+        if (!SF_TEST_CHECK(rasterizer != NULL))
+            break;
+        rasterizer->tileHeight = tileHeights[i];
+        image = sfRasterizerTest_drawLarge(rasterizer, curves, sprite, sheet);
+        SF_TEST_CHECK(memcmp(sfImage_getPixelsPtr(image), sfImage_getPixelsPtr(expected), 400 * 320 * 4) == 0);
+        sfImage_destroy(image);
+        sfRasterizer_destroy(rasterizer);
+    }
+    // The sprite alone covers more than a quarter of the image
+    for (unsigned int y = 0; y < 320; y++) {
+        for (unsigned int x = 0; x < 400; x++)
+            covered += sfImage_getPixel(expected, x, y).r != 20 || sfImage_getPixel(expected, x, y).b != 30;
+    }
+    SF_TEST_CHECK(covered > 400 * 320 / 4);
+    sfImage_destroy(expected);
+    for (int i = 0; i < 2; i++)
+        sfBezierCurve_destroy(curves[i]);
+    sfAnimatedSprite_destroy(sprite);
+    sfTexture_destroy(texture);
+    sfImage_destroy(sheet);
+}
+
+////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+    sfRasterizerTest_update = argc > 1 && strcmp(argv[1], "--update") == 0;
+    sfTest_run("rasterizer.bezierCurves", sfRasterizerTest_bezierCurves);
+    sfTest_run("rasterizer.animatedSprites", sfRasterizerTest_animatedSprites);
+    sfTest_run("rasterizer.threads", sfRasterizerTest_threads);
+    return (sfTest_finish());
+}
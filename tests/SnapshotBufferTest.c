@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <pthread.h>
+#include <stdatomic.h>
+#include <SFML/Addition/SnapshotBuffer.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+#define SF_SNAPSHOTBUFFERTEST_TICKS 4000
+#define SF_SNAPSHOTBUFFERTEST_CURVES 32
+#define SF_SNAPSHOTBUFFERTEST_ADDED_CURVES 32
+#define SF_SNAPSHOTBUFFERTEST_SPRITES 128
+
+////////////////////////////////////////////////////////////
+/// Objects owned by the writer thread
+///
+/// At tick t every curve i has its first point at (t, i + t)
+/// and every sprite is placed at (t, t), so a snapshot is
+/// consistent when all its objects agree with its sequence.
+////////////////////////////////////////////////////////////
+typedef struct
+{
+    sfSnapshotBuffer *buffer;
+    sfTexture *texture;
+    sfBezierCurve *curves[SF_SNAPSHOTBUFFERTEST_CURVES + SF_SNAPSHOTBUFFERTEST_ADDED_CURVES];
+    size_t curveCount;
+    sfAnimatedSprite *sprites[SF_SNAPSHOTBUFFERTEST_SPRITES];
+    atomic_int done;
+} sfSnapshotBufferTestWorld;
+
+////////////////////////////////////////////////////////////
+static void sfSnapshotBufferTest_addCurve(sfSnapshotBufferTestWorld *world, int tick)
+{
+    sfBezierCurve *curve = sfBezierCurve_create();
+    float index = (float)world->curveCount;
+
+    for (int j = 0; j < 4; j++)
+        sfBezierCurve_addPoint(curve, (sfVector2f){(float)tick + j, index + tick});
+    sfSnapshotBuffer_addBezierCurve(world->buffer, curve);
+    world->curves[world->curveCount++] = curve;
+}
+
+////////////////////////////////////////////////////////////
+/// Move, animate and publish, adding curves on the way so
+/// the snapshots grow while the reader holds one of them
+////////////////////////////////////////////////////////////
+static void *sfSnapshotBufferTest_writer(void *userData)
+{
+    sfSnapshotBufferTestWorld *world = userData;
+
+    for (int tick = 1; tick <= SF_SNAPSHOTBUFFERTEST_TICKS; tick++) {
+        if (tick % 100 == 0 && world->curveCount < SF_SNAPSHOTBUFFERTEST_CURVES + SF_SNAPSHOTBUFFERTEST_ADDED_CURVES)
+            sfSnapshotBufferTest_addCurve(world, tick - 1);
+        for (size_t i = 0; i < world->curveCount; i++)
+            sfBezierCurve_move(world->curves[i], (sfVector2f){1, 1});
+        for (size_t i = 0; i < SF_SNAPSHOTBUFFERTEST_SPRITES; i++) {
+            sfAnimatedSprite_setPosition(world->sprites[i], (sfVector2f){(float)tick, (float)tick});
+            sfAnimatedSprite_advance(world->sprites[i], sfMicroseconds(16667));
+        }
+        sfSnapshotBuffer_publish(world->buffer);
+    }
+    atomic_store(&world->done, 1);
+    return (NULL);
+}
+
+////////////////////////////////////////////////////////////
+/// The reader never sees a snapshot older than the previous
+/// one, nor one mixing objects of different ticks
+////////////////////////////////////////////////////////////
+static void sfSnapshotBufferTest_writerAndReader(void)
+{
+    sfSnapshotBufferTestWorld world = {0};
+    const sfSnapshot *snapshot = NULL;
+    sfUint64 last = 0;
+    size_t reads = 0;
+    size_t stale = 0;
+    size_t torn = 0;
+    pthread_t writer;
+
+    world.buffer = sfSnapshotBuffer_create();
+    world.texture = sfTexture_create(256, 256);
+    for (int i = 0; i < SF_SNAPSHOTBUFFERTEST_CURVES; i++)
+        sfSnapshotBufferTest_addCurve(&world, 0);
+    for (size_t i = 0; i < SF_SNAPSHOTBUFFERTEST_SPRITES; i++) {
+        world.sprites[i] = sfAnimatedSprite_create();
+        sfAnimatedSprite_setTexture(world.sprites[i], world.texture, sfTrue);
+        sfAnimatedSprite_setGridSize(world.sprites[i], (sfVector2u){4, 4});
+        sfAnimatedSprite_setFrameSize(world.sprites[i], (sfVector2u){64, 64});
+        sfAnimatedSprite_setMaxFrame(world.sprites[i], 16);
+        sfAnimatedSprite_setFrameRate(world.sprites[i], 10);
+        sfSnapshotBuffer_addAnimatedSprite(world.buffer, world.sprites[i]);
+    }
+    atomic_init(&world.done, 0);
+    if (!SF_TEST_CHECK(pthread_create(&writer, NULL, sfSnapshotBufferTest_writer, &world) == 0))
+        return;
+    while (!atomic_load(&world.done)) {
+        snapshot = sfSnapshotBuffer_acquire(world.buffer);
+        stale += snapshot->sequence < last;
+        last = snapshot->sequence;
+        if (snapshot->sequence == 0)
+            continue;
+        reads++;
+        for (size_t i = 0; i < snapshot->curveCount; i++) {
+            sfVector2f point = snapshot->curves[i].points[0];
+            torn += point.x != (float)snapshot->sequence || point.y != (float)(i + snapshot->sequence);
+        }
+        for (size_t i = 0; i < snapshot->spriteCount; i++)
+            torn += snapshot->vertices[i * 4].position.x != (float)snapshot->sequence;
+    }
+    pthread_join(writer, NULL);
+    snapshot = sfSnapshotBuffer_acquire(world.buffer);
+    SF_TEST_CHECK(reads > 0);
+    SF_TEST_CHECK(stale == 0);
+    SF_TEST_CHECK(torn == 0);
+    SF_TEST_CHECK(snapshot->sequence == SF_SNAPSHOTBUFFERTEST_TICKS);
+    SF_TEST_CHECK(snapshot->curveCount == world.curveCount);
+    SF_TEST_CHECK(snapshot->spriteCount == SF_SNAPSHOTBUFFERTEST_SPRITES);
+    sfSnapshotBuffer_destroy(world.buffer);
+    for (size_t i = 0; i < world.curveCount; i++)
+        sfBezierCurve_destroy(world.curves[i]);
+    for (size_t i = 0; i < SF_SNAPSHOTBUFFERTEST_SPRITES; i++)
+        sfAnimatedSprite_destroy(world.sprites[i]);
+    sfTexture_destroy(world.texture);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("snapshotBuffer.writerAndReader", sfSnapshotBufferTest_writerAndReader);
+    return (sfTest_finish());
+}
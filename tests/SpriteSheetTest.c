@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include <SFML/Addition/SpriteSheet.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+/// Sheet with its frames as an array, as exported by Aseprite
+////////////////////////////////////////////////////////////
+static const char sfSpriteSheetTest_arraySheet[] =
+    "{\"frames\": ["
+    " {\"filename\": \"idle 0\", \"frame\": {\"x\":0,\"y\":0,\"w\":8,\"h\":8}, \"rotated\": false, \"duration\": 120},"
+    " {\"filename\": \"idle 1\", \"frame\": {\"x\":8,\"y\":0,\"w\":8,\"h\":6}, \"rotated\": true,"
+    "  \"spriteSourceSize\": {\"x\":0,\"y\":2,\"w\":8,\"h\":6}, \"sourceSize\": {\"w\":8,\"h\":8}, \"duration\": 80},"
+    " {\"filename\": \"run 0\", \"frame\": {\"x\":16,\"y\":0,\"w\":8,\"h\":8}, \"duration\": 50}],"
+    " \"meta\": {\"app\": \"aseprite\", \"image\": \"hero.png\", \"layers\": [{\"name\": \"a\", \"opacity\": 255}],"
+    "  \"frameTags\": [{\"name\": \"idle\", \"from\": 0, \"to\": 1}, {\"name\": \"run\", \"from\": 2, \"to\": 2.0}]}}";
+
+////////////////////////////////////////////////////////////
+static sfSpriteSheet *sfSpriteSheetTest_create(const char *text)
+{
+    return (sfSpriteSheet_createFromMemory(text, strlen(text)));
+}
+
+////////////////////////////////////////////////////////////
+/// Frames given as an array keep their order, members that
+/// are not known are skipped
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetTest_array(void)
+{
+    sfSpriteSheet *sheet = sfSpriteSheetTest_create(sfSpriteSheetTest_arraySheet);
+    const sfSpriteSheetTag *tag = NULL;
+
+    if (!SF_TEST_CHECK(sheet != NULL))
+        return;
+    SF_TEST_CHECK(sheet->frameCount == 3);
+    SF_TEST_CHECK(sheet->tagCount == 2);
+    SF_TEST_CHECK(sheet->image != NULL && strcmp(sheet->image, "hero.png") == 0);
+    SF_TEST_CHECK(sheet->frames[0].duration == 120000);
+    SF_TEST_CHECK(!sheet->frames[0].rotated);
+    SF_TEST_CHECK(sheet->frames[0].sourceSize.x == 8 && sheet->frames[0].sourceSize.y == 8);
+    SF_TEST_CHECK(sheet->frames[1].rect.left == 8 && sheet->frames[1].rect.height == 6);
+    SF_TEST_CHECK(sheet->frames[1].rotated);
+    SF_TEST_CHECK_NEAR(sheet->frames[1].offset.y, 2, 1e-6);
+    SF_TEST_CHECK(sheet->frames[2].rect.left == 16 && sheet->frames[2].duration == 50000);
+    tag = sfSpriteSheet_getTag(sheet, "idle");
+    SF_TEST_CHECK(tag != NULL && tag->from == 0 && tag->to == 1);
+    tag = sfSpriteSheet_getTag(sheet, "run");
+    SF_TEST_CHECK(tag != NULL && tag->from == 2 && tag->to == 2);
+    SF_TEST_CHECK(sfSpriteSheet_getTag(sheet, "jump") == NULL);
+    sfSpriteSheet_destroy(sheet);
+}
+
+////////////////////////////////////////////////////////////
+/// Escapes of names are decoded, unicode ones to UTF-8
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetTest_escapes(void)
+{
+    static const char text[] =
+        "{\"frames\": {\"a\\\"b\": {\"frame\": {\"x\":0,\"y\":0,\"w\":4,\"h\":4}}},"
+        " \"meta\": {\"image\": \"dir\\/sheet\\\\1.png\","
+        "  \"frameTags\": [{\"name\": \"tab\\there\\n\", \"from\": 0, \"to\": 0},"
+        "   {\"name\": \"caf\\u00e9 \\u20AC\", \"from\": 0, \"to\": 0}]}}";
+    sfSpriteSheet *sheet = sfSpriteSheetTest_create(text);
+
+    if (!SF_TEST_CHECK(sheet != NULL))
+        return;
+    SF_TEST_CHECK(sheet->frameCount == 1);
+    SF_TEST_CHECK(strcmp(sheet->image, "dir/sheet\\1.png") == 0);
+    SF_TEST_CHECK(strcmp(sheet->tags[0].name, "tab\there\n") == 0);
+    SF_TEST_CHECK(strcmp(sheet->tags[1].name, "caf\xC3\xA9 \xE2\x82\xAC") == 0);
+    SF_TEST_CHECK(sfSpriteSheet_getTag(sheet, "caf\xC3\xA9 \xE2\x82\xAC") == &sheet->tags[1]);
+    sfSpriteSheet_destroy(sheet);
+}
+
+////////////////////////////////////////////////////////////
+/// Truncated or malformed text loads nothing
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetTest_malformed(void)
+{
+    static const char *texts[] = {
+        "",
+        "[]",
+        "{\"frames\": ",
+        "{\"frames\": 3}",
+        "{\"frames\": [{\"frame\": {\"x\":0,\"y\":0,\"w\":4,\"h\":4}}",
+        "{\"frames\": [{\"frame\": {\"x\":0,\"y\":0,\"w\":4,\"h\":4}}], \"meta\": {\"image\": \"sheet.png}}",
+        "{\"frames\": [], \"meta\": {\"frameTags\": [{\"name\": \"a\", \"from\": }]}}",
+        "{\"frames\": [], \"meta\": {\"frameTags\": {\"name\": \"a\"}}}",
+    };
+
+    for (size_t i = 0; i < sizeof(texts) / sizeof(*texts); i++) {
+        sfSpriteSheet *sheet = sfSpriteSheetTest_create(texts[i]);
+
+        if (!SF_TEST_CHECK(sheet == NULL))
+            sfSpriteSheet_destroy(sheet);
+    }
+    SF_TEST_CHECK(sfSpriteSheet_createFromMemory(NULL, 0) == NULL);
+    SF_TEST_CHECK(sfSpriteSheet_createFromFile("missing.json") == NULL);
+}
+
+////////////////////////////////////////////////////////////
+/// Tags must be ranges of existing frames given as whole
+/// numbers
+////////////////////////////////////////////////////////////
+static void sfSpriteSheetTest_tagRanges(void)
+{
+    static const char *ranges[] = {
+        "\"from\": 0, \"to\": 2",
+        "\"from\": 1, \"to\": 0",
+        "\"from\": -1, \"to\": 1",
+        "\"from\": 0.5, \"to\": 1",
+        "\"from\": 0, \"to\": 1e30",
+        "\"from\": 0, \"to\": 18446744073709551616",
+    };
+    char text[256];
+
+    for (size_t i = 0; i < sizeof(ranges) / sizeof(*ranges); i++) {
+        sfSpriteSheet *sheet = NULL;
+
+        snprintf(text, sizeof(text),
+            "{\"frames\": [{\"frame\": {\"x\":0,\"y\":0,\"w\":4,\"h\":4}}, {\"frame\": {\"x\":4,\"y\":0,\"w\":4,\"h\":4}}],"
+            " \"meta\": {\"frameTags\": [{\"name\": \"a\", %s}]}}", ranges[i]);
+        sheet = sfSpriteSheetTest_create(text);
+        if (!SF_TEST_CHECK(sheet == NULL))
+            sfSpriteSheet_destroy(sheet);
+    }
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTest_run("spriteSheet.array", sfSpriteSheetTest_array);
+    sfTest_run("spriteSheet.escapes", sfSpriteSheetTest_escapes);
+    sfTest_run("spriteSheet.malformed", sfSpriteSheetTest_malformed);
+    sfTest_run("spriteSheet.tagRanges", sfSpriteSheetTest_tagRanges);
+    return (sfTest_finish());
+}
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <string.h>
+#include <SFML/Addition/Tessellator.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+#define SF_TESSELLATORTEST_CURVES 300
+
+////////////////////////////////////////////////////////////
+/// Curves of 2 to 20 points, from a fixed seed
+////////////////////////////////////////////////////////////
+static sfBezierCurve *sfTessellatorTest_curves[SF_TESSELLATORTEST_CURVES];
+
+////////////////////////////////////////////////////////////
+static float sfTessellatorTest_random(unsigned int *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return ((float)((*seed >> 8) & 0xFFFF) / 0xFFFF);
+}
+
+////////////////////////////////////////////////////////////
+static void sfTessellatorTest_createCurves(void)
+{
+    unsigned int seed = 36;
+
+    for (size_t i = 0; i < SF_TESSELLATORTEST_CURVES; i++) {
+        size_t pointCount = 2 + i % 19;
+
+        sfTessellatorTest_curves[i] = sfBezierCurve_create();
+        sfBezierCurve_setCurveColor(sfTessellatorTest_curves[i], (sfColor){i % 256, (i * 7) % 256, 255, 255});
+        for (size_t j = 0; j < pointCount; j++) {
+            sfBezierCurve_addPoint(sfTessellatorTest_curves[i], (sfVector2f){
+                sfTessellatorTest_random(&seed) * 480.f, sfTessellatorTest_random(&seed) * 270.f});
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////
+/// Tessellate every curve with some number of threads and
+/// return a copy of the vertex buffer
+////////////////////////////////////////////////////////////
+static sfVertex *sfTessellatorTest_tessellate(unsigned int threadCount, size_t sampleCount, sfBool background, size_t *vertexCount)
+{
+    sfTessellator *tessellator = sfTessellator_create(threadCount);
+    sfVertex *vertices = NULL;
+    sfBool done = sfFalse;
+
+    *vertexCount = 0;
+    if (!SF_TEST_CHECK(tessellator != NULL))
+        return (NULL);
+    for (size_t i = 0; i < SF_TESSELLATORTEST_CURVES; i++)
+        sfTessellator_addCurve(tessellator, sfTessellatorTest_curves[i]);
+    if (background) {
+        done = sfTessellator_launch(tessellator, sampleCount);
+        sfTessellator_wait(tessellator);
+    } else {
+        done = sfTessellator_run(tessellator, sampleCount);
+    }
+    if (SF_TEST_CHECK(done) && tessellator->vertexCount > 0) {
+        vertices = malloc(tessellator->vertexCount * sizeof(sfVertex));
+        memcpy(vertices, tessellator->vertices, tessellator->vertexCount * sizeof(sfVertex));
+        *vertexCount = tessellator->vertexCount;
+    }
+    sfTessellator_destroy(tessellator);
+    return (vertices);
+}
+
+////////////////////////////////////////////////////////////
+/// The buffer is the same byte for byte whatever the number
+/// of threads, with fixed and adaptive sample counts
+////////////////////////////////////////////////////////////
+static void sfTessellatorTest_compareThreadCounts(size_t sampleCount)
+{
+    static const unsigned int threadCounts[] = {2, 4, 7, 16};
+    size_t referenceCount = 0;
+    size_t vertexCount = 0;
+    sfVertex *reference = sfTessellatorTest_tessellate(1, sampleCount, sfFalse, &referenceCount);
+    sfVertex *vertices = NULL;
+
+    if (!SF_TEST_CHECK(reference != NULL))
+        return;
+    for (size_t i = 0; i < sizeof(threadCounts) / sizeof(*threadCounts); i++) {
+        for (int background = 0; background < 2; background++) {
+            vertices = sfTessellatorTest_tessellate(threadCounts[i], sampleCount, background, &vertexCount);
+            if (SF_TEST_CHECK(vertices != NULL && vertexCount == referenceCount))
+                SF_TEST_CHECK(memcmp(vertices, reference, vertexCount * sizeof(sfVertex)) == 0);
+            free(vertices);
+        }
+    }
+    free(reference);
+}
+
+////////////////////////////////////////////////////////////
+static void sfTessellatorTest_fixedSamples(void)
+{
+    sfTessellatorTest_compareThreadCounts(64);
+}
+
+////////////////////////////////////////////////////////////
+static void sfTessellatorTest_adaptiveSamples(void)
+{
+    sfTessellatorTest_compareThreadCounts(SF_TESSELLATOR_ADAPTIVE);
+}
+
+////////////////////////////////////////////////////////////
+/// The parked threads run any number of tessellations, in
+/// the background or with the calling thread, one after the
+/// other
+////////////////////////////////////////////////////////////
+static void sfTessellatorTest_reuse(void)
+{
+    size_t referenceCount = 0;
+    sfVertex *reference = sfTessellatorTest_tessellate(1, 32, sfFalse, &referenceCount);
+    sfTessellator *tessellator = sfTessellator_create(4);
+
+    if (!SF_TEST_CHECK(reference != NULL && tessellator != NULL))
+        return;
+    SF_TEST_CHECK(sfTessellator_addCurve(NULL, sfTessellatorTest_curves[0]) == SF_TESSELLATOR_NO_CURVE);
+    SF_TEST_CHECK(sfTessellator_addCurve(tessellator, NULL) == SF_TESSELLATOR_NO_CURVE);
+    for (int i = 0; i < 20; i++) {
+        sfTessellator_clear(tessellator);
+        for (size_t j = 0; j < SF_TESSELLATORTEST_CURVES; j++)
+            sfTessellator_addCurve(tessellator, sfTessellatorTest_curves[j]);
+        if (i % 3 == 0) {
+            SF_TEST_CHECK(sfTessellator_launch(tessellator, 32));
+            SF_TEST_CHECK(sfTessellator_addCurve(tessellator, sfTessellatorTest_curves[0]) == SF_TESSELLATOR_NO_CURVE);
+            SF_TEST_CHECK(!sfTessellator_run(tessellator, 32));
+            sfTessellator_wait(tessellator);
+        } else {
+            SF_TEST_CHECK(sfTessellator_run(tessellator, 32));
+        }
+        if (SF_TEST_CHECK(tessellator->vertexCount == referenceCount))
+            SF_TEST_CHECK(memcmp(tessellator->vertices, reference, referenceCount * sizeof(sfVertex)) == 0);
+    }
+    // Destroyed while a tessellation runs in the background
+    SF_TEST_CHECK(sfTessellator_launch(tessellator, 32));
+    sfTessellator_destroy(tessellator);
+    free(reference);
+}
+
+////////////////////////////////////////////////////////////
+int main(void)
+{
+    sfTessellatorTest_createCurves();
+    sfTest_run("tessellator.fixedSamples", sfTessellatorTest_fixedSamples);
+    sfTest_run("tessellator.adaptiveSamples", sfTessellatorTest_adaptiveSamples);
+    sfTest_run("tessellator.reuse", sfTessellatorTest_reuse);
+    for (size_t i = 0; i < SF_TESSELLATORTEST_CURVES; i++)
+        sfBezierCurve_destroy(sfTessellatorTest_curves[i]);
+    return (sfTest_finish());
+}
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <math.h>
+#include <stdio.h>
+#include "Test.h"
+
+////////////////////////////////////////////////////////////
+static size_t sfTest_failedChecks = 0;
+static size_t sfTest_passedCases = 0;
+static size_t sfTest_failedCases = 0;
+
+////////////////////////////////////////////////////////////
+sfBool sfTest_check(sfBool result, const char *expression, const char *file, int line)
+{
+    if (!result) {
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expression);
+        sfTest_failedChecks++;
+    }
+    return (result);
+}
+
+////////////////////////////////////////////////////////////
+sfBool sfTest_checkNear(double value, double expected, double tolerance, const char *expression, const char *file, int line)
+{
+    if (fabs(value - expected) > tolerance || isnan(value)) {
+        fprintf(stderr, "%s:%d: check failed: %s is %g, expected %g (tolerance %g)\n",
+            file, line, expression, value, expected, tolerance);
+        sfTest_failedChecks++;
+        return (sfFalse);
+    }
+    return (sfTrue);
+}
+
+////////////////////////////////////////////////////////////
+void sfTest_run(const char *name, sfTestFunction function)
+{
+    size_t failedChecks = sfTest_failedChecks;
+
+    function();
+    if (sfTest_failedChecks == failedChecks) {
+        printf("[ pass ] %s\n", name);
+        sfTest_passedCases++;
+    } else {
+        printf("[ FAIL ] %s\n", name);
+        sfTest_failedCases++;
+    }
+    fflush(stdout);
+}
+
+////////////////////////////////////////////////////////////
+int sfTest_finish(void)
+{
+    printf("%zu passed, %zu failed\n", sfTest_passedCases, sfTest_failedCases);
+    return (sfTest_failedCases == 0 ? 0 : 1);
+}
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////
+//
+// CSFML-ADDITION - Simple and Fast Multimedia Library addon
+// Copyright (C) 2023 Mallory Scotton (mscotton.pro@gmail.com)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+////////////////////////////////////////////////////////////
+
+#ifndef SFML_ADDITION_TEST_H
+    #define SFML_ADDITION_TEST_H
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <SFML/Config.h>
+
+////////////////////////////////////////////////////////////
+/// \brief Check a condition, report it and go on when it fails
+///
+////////////////////////////////////////////////////////////
+#define SF_TEST_CHECK(condition) \
+    sfTest_check((condition) ? sfTrue : sfFalse, #condition, __FILE__, __LINE__)
+
+////////////////////////////////////////////////////////////
+/// \brief Check that two floats are closer than a tolerance
+///
+////////////////////////////////////////////////////////////
+#define SF_TEST_CHECK_NEAR(value, expected, tolerance) \
+    sfTest_checkNear((double)(value), (double)(expected), (double)(tolerance), #value, __FILE__, __LINE__)
+
+////////////////////////////////////////////////////////////
+/// \brief Test case, a function checking one behaviour
+///
+////////////////////////////////////////////////////////////
+typedef void (*sfTestFunction)(void);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the result of a check
+///
+/// \param result     Result of the check
+/// \param expression Text of the checked expression
+/// \param file       File of the check
+/// \param line       Line of the check
+///
+/// \return The result of the check
+///
+////////////////////////////////////////////////////////////
+sfBool sfTest_check(sfBool result, const char *expression, const char *file, int line);
+
+////////////////////////////////////////////////////////////
+/// \brief Record the result of a comparison between two floats
+///
+/// \param value      Value computed by the test
+/// \param expected   Expected value
+/// \param tolerance  Largest difference accepted
+/// \param expression Text of the computed expression
+/// \param file       File of the check
+/// \param line       Line of the check
+///
+/// \return sfTrue if the values are close enough
+///
+////////////////////////////////////////////////////////////
+sfBool sfTest_checkNear(double value, double expected, double tolerance, const char *expression, const char *file, int line);
+
+////////////////////////////////////////////////////////////
+/// \brief Run a test case and print its result
+///
+/// \param name     Name of the case
+/// \param function Function of the case
+///
+////////////////////////////////////////////////////////////
+void sfTest_run(const char *name, sfTestFunction function);
+
+////////////////////////////////////////////////////////////
+/// \brief Print the summary of the cases run so far
+///
+/// \return The exit status of the test program, 0 when every
+///         case passed and 1 otherwise
+///
+////////////////////////////////////////////////////////////
+int sfTest_finish(void);
+
+#endif // SFML_ADDITION_TEST_H